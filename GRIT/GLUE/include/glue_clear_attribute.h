@@ -41,7 +41,7 @@ namespace glue
     {
       grit::Simplex0 const s = *it;
 
-      std::vector<unsigned int> const & labels = engine.attributes().get_simplex0_labels(s);
+      grit::Simplex0LabelRange const labels = engine.attributes().get_simplex0_labels(s);
 
       for(unsigned int i = 0; i < labels.size(); ++i)
         engine.attributes().set_attribute_value( name, s, labels[i], value);
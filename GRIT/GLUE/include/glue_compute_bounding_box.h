@@ -29,11 +29,9 @@ namespace glue
 
     p_min[0u] = t_max;
     p_min[1u] = t_max;
-    p_min[2u] = 0.;
 
     p_max[0u] = t_min;
     p_max[1u] = t_min;
-    p_max[2u] = 0.;
 
     for( unsigned int i=0u; i<n_verts; ++i )
     {
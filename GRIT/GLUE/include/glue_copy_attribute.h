@@ -52,7 +52,7 @@ namespace glue
         //T const & value = engine.attributes().current()[s](index);
         T const & value = engine.attributes().get_current_value(s)(index);
 
-        std::vector<unsigned int> const & labels = engine.attributes().get_simplex0_labels(s);
+        grit::Simplex0LabelRange const labels = engine.attributes().get_simplex0_labels(s);
 
         for(unsigned int i = 0; i < labels.size(); ++i)
           engine.attributes().set_attribute_value(to, s, labels[i], value);
@@ -113,7 +113,7 @@ namespace glue
     {
       grit::Simplex0 const s = *it;
 
-      std::vector<unsigned int> const & labels = engine.attributes().get_simplex0_labels(s);
+      grit::Simplex0LabelRange const labels = engine.attributes().get_simplex0_labels(s);
 
       for(unsigned int i = 0; i < labels.size(); ++i)
       {
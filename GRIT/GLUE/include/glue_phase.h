@@ -8,6 +8,7 @@
 
 #include <vector>
 #include <map>
+#include <utility>  // Needed for std::move
 #include <cassert>
 
 namespace glue
@@ -89,6 +90,36 @@ namespace glue
       return *this;
     }
 
+    Phase(Phase && A)
+    : m_labels(    std::move(A.m_labels)    )
+    , m_vertices(  std::move(A.m_vertices)  )
+    , m_indices(   std::move(A.m_indices)   )
+    , m_edges(     std::move(A.m_edges)     )
+    , m_triangles( std::move(A.m_triangles) )
+    {}
+
+    Phase const & operator=(Phase && A)
+    {
+      if(this != &A)
+      {
+        this->m_labels    = std::move(A.m_labels);
+        this->m_vertices  = std::move(A.m_vertices);
+        this->m_indices   = std::move(A.m_indices);
+        this->m_edges     = std::move(A.m_edges);
+        this->m_triangles = std::move(A.m_triangles);
+      }
+      return *this;
+    }
+
+    void swap(Phase & A)
+    {
+      this->m_labels.swap(A.m_labels);
+      this->m_vertices.swap(A.m_vertices);
+      this->m_indices.swap(A.m_indices);
+      this->m_edges.swap(A.m_edges);
+      this->m_triangles.swap(A.m_triangles);
+    }
+
   public:
 
     unsigned int get_local_index( grit::Simplex0 const & global) const
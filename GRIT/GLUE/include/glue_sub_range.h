@@ -420,6 +420,7 @@ namespace glue
                                             )
     {
       typedef grit::default_grit_types::vector3_type V;
+      typedef V::value_type                          T;
 
       if(phase.m_vertices.size() != x.size())
       {
@@ -469,8 +470,8 @@ namespace glue
         unsigned int const N = entire_phase.m_vertices.size();
         
         // Default target value is current
-        std::vector<double> target_x( N, 0.);
-        std::vector<double> target_y( N, 0.);
+        std::vector<T> target_x( N, T(0) );
+        std::vector<T> target_y( N, T(0) );
 
         get_sub_range_current_native( engine, entire_phase, target_x, target_y );
 
@@ -525,19 +526,19 @@ namespace glue
     details::get_sub_range_native( engine, phase, name, values, VERTEX_ATTRIBUTE() );
   }
 
-  template<>
-  inline void get_sub_range<typename std::vector<double> >(
-                                                           grit::engine2d_type   const & engine
-                                                           , glue::Phase         const & phase
-                                                           , std::string         const & name
-                                                           , std::vector<double>       & values
-                                                           , VERTEX_ATTRIBUTE    const & /*tag*/
-                                                           )
+  template<typename T>
+  inline void get_sub_range(
+                            grit::engine2d_type   const & engine
+                            , glue::Phase         const & phase
+                            , std::string         const & name
+                            , std::vector<T>            & values
+                            , VERTEX_ATTRIBUTE    const & /*tag*/
+                            )
   {
     unsigned int const N = phase.m_vertices.size();
 
     values.clear();
-    values.resize(N,0.0);
+    values.resize(N,T(0));
 
     details::get_sub_range_native( engine, phase, name, values, VERTEX_ATTRIBUTE() );
   }
@@ -554,19 +555,19 @@ namespace glue
     details::get_sub_range_native( engine, phase, name, values, EDGE_ATTRIBUTE() );
   }
 
-  template<>
-  inline void get_sub_range<typename std::vector<double> >(
-                                                           grit::engine2d_type   const & engine
-                                                           , glue::Phase         const & phase
-                                                           , std::string         const & name
-                                                           , std::vector<double>       & values
-                                                           , EDGE_ATTRIBUTE      const & /*tag*/
-                                                           )
+  template<typename T>
+  inline void get_sub_range(
+                            grit::engine2d_type   const & engine
+                            , glue::Phase         const & phase
+                            , std::string         const & name
+                            , std::vector<T>            & values
+                            , EDGE_ATTRIBUTE      const & /*tag*/
+                            )
   {
     unsigned int const N = phase.m_edges.size();
 
     values.clear();
-    values.resize(N,0.0);
+    values.resize(N,T(0));
 
     details::get_sub_range_native( engine, phase, name, values, EDGE_ATTRIBUTE() );
   }
@@ -583,19 +584,19 @@ namespace glue
     details::get_sub_range_native( engine, phase, name, values, FACE_ATTRIBUTE() );
   }
 
-  template<>
-  inline void get_sub_range<typename std::vector<double> >(
-                                                           grit::engine2d_type   const & engine
-                                                           , glue::Phase         const & phase
-                                                           , std::string         const & name
-                                                           , std::vector<double>       & values
-                                                           , FACE_ATTRIBUTE      const & /*tag*/
-                                                           )
+  template<typename T>
+  inline void get_sub_range(
+                            grit::engine2d_type   const & engine
+                            , glue::Phase         const & phase
+                            , std::string         const & name
+                            , std::vector<T>            & values
+                            , FACE_ATTRIBUTE      const & /*tag*/
+                            )
   {
     unsigned int const N = phase.m_triangles.size();
 
     values.clear();
-    values.resize(N,0.0);
+    values.resize(N,T(0));
 
     details::get_sub_range_native( engine, phase, name, values, glue::FACE_ATTRIBUTE() );
   }
@@ -611,21 +612,21 @@ namespace glue
     details::get_sub_range_current_native( engine, phase, x, y );
   }
 
-  template<>
-  inline void get_sub_range_current<std::vector<double> >(
-                                                          grit::engine2d_type   const & engine
-                                                          , glue::Phase         const & phase
-                                                          , std::vector<double>       & x
-                                                          , std::vector<double>       & y
-                                                          )
+  template<typename T>
+  inline void get_sub_range_current(
+                                    grit::engine2d_type   const & engine
+                                    , glue::Phase         const & phase
+                                    , std::vector<T>            & x
+                                    , std::vector<T>            & y
+                                    )
   {
     unsigned int const N = phase.m_vertices.size();
 
     x.clear();
-    x.resize(N,0.0);
+    x.resize(N,T(0));
 
     y.clear();
-    y.resize(N,0.0);
+    y.resize(N,T(0));
 
     details::get_sub_range_current_native( engine, phase, x, y );
   }
@@ -641,21 +642,21 @@ namespace glue
     details::get_sub_range_target_native( engine, phase, x, y );
   }
 
-  template<>
-  inline void get_sub_range_target<std::vector<double> >(
-                                                         grit::engine2d_type   const & engine
-                                                         , glue::Phase         const & phase
-                                                         , std::vector<double>       & x
-                                                         , std::vector<double>       & y
-                                                         )
+  template<typename T>
+  inline void get_sub_range_target(
+                                   grit::engine2d_type   const & engine
+                                   , glue::Phase         const & phase
+                                   , std::vector<T>            & x
+                                   , std::vector<T>            & y
+                                   )
   {
     unsigned int const N = phase.m_vertices.size();
 
     x.clear();
-    x.resize(N,0.0);
+    x.resize(N,T(0));
 
     y.clear();
-    y.resize(N,0.0);
+    y.resize(N,T(0));
 
     details::get_sub_range_target_native( engine, phase, x, y );
   }
@@ -37,6 +37,7 @@ namespace grit
       typedef typename types::attributes_type              AT;
       typedef typename types::attribute_manager_type       AMT;
       typedef typename types::param_type                   PT;
+      typedef typename types::mesh_impl                    MI;
 
       typedef typename AT::name_iterator                   name_iterator;
       typedef typename AT::name_vector                     name_vector;
@@ -49,7 +50,7 @@ namespace grit
       void operator()(
                       SimplexSet          const & new_simplices
                       , SimplexSet        const & old_simplices
-                      , InterfaceMesh     const & mesh
+                      , MI                const & mesh
                       , PT                const & parameters
                       , AT                      & attributes
                       , simplex1_lut_type const & simplex1_lut
@@ -82,20 +83,19 @@ namespace grit
         {
           Simplex1      const & s               = *it;
           name_vector   const & attribute_names = attributes.simplex1_attribute_names();
-          name_iterator         name_it         = attribute_names.begin();
 
-          for( ; name_it != attribute_names.end(); ++name_it)
+          for( unsigned int n = 0u; n < attribute_names.size(); ++n)
           {
-            std::string const & name = *name_it;
+            AttributeHandle const h( 1u, n);
 
             if( simplex1_lut.find(s) != simplex1_lut.end())
             {
               Simplex1  const & parent = simplex1_lut.at(s);
 
-              if( attributes.exist_attribute_value( name, parent))
+              if( attributes.exist_attribute_value( h, parent))
               {
-                T const value = attributes.get_attribute_value( name, parent );
-                attributes.set_attribute_value( name, s, value);
+                T const value = attributes.get_attribute_value( h, parent );
+                attributes.set_attribute_value( h, s, value);
               }
             }
           }
@@ -124,20 +124,19 @@ namespace grit
         {
           Simplex2      const & s               = *it;
           name_vector   const & attribute_names = attributes.simplex2_attribute_names();
-          name_iterator         name_it         = attribute_names.begin();
 
-          for( ; name_it != attribute_names.end(); ++name_it)
+          for( unsigned int n = 0u; n < attribute_names.size(); ++n)
           {
-            std::string const & name = *name_it;
+            AttributeHandle const h( 2u, n);
 
             if( simplex2_lut.find(s) != simplex2_lut.end())
             {
               Simplex2 const & parent = simplex2_lut.at(s);
 
-              if( attributes.exist_attribute_value( name, parent))
+              if( attributes.exist_attribute_value( h, parent))
               {
-                T const value = attributes.get_attribute_value( name, parent );
-                attributes.set_attribute_value( name, s, value);
+                T const value = attributes.get_attribute_value( h, parent );
+                attributes.set_attribute_value( h, s, value);
               }
             }
           }
@@ -153,7 +152,7 @@ namespace grit
        */
       label_set compute_all_nonambient_labels(
                                               SimplexSet      const & simplex_set
-                                              , InterfaceMesh const & mesh
+                                              , MI            const & mesh
                                               , Parameters    const & parameters
                                               ) const
       {
@@ -40,6 +40,7 @@ namespace grit
       typedef typename types::attributes_type         AT;
       typedef typename types::attribute_manager_type  AMT;
       typedef typename types::param_type              PT;
+      typedef typename types::mesh_impl               MI;
 
       typedef typename V::value_traits                VT;
 
@@ -67,7 +68,7 @@ namespace grit
       void operator()(
                       SimplexSet          const & new_simplices
                       , SimplexSet        const & old_simplices
-                      , InterfaceMesh     const & mesh
+                      , MI                const & mesh
                       , PT                const & parameters
                       , AT                      & attributes
                       , simplex1_lut_type const & simplex1_lut
@@ -114,16 +115,15 @@ namespace grit
           for( ; it!=labels_new.end(); ++it)
           {
             unsigned int  const label   = *it;
-            name_iterator       name_it = attribute_names.begin();
 
             AMT::add_simplex0_label( vn, label, attributes);
 
-            for( ; name_it!=attribute_names.end(); ++name_it)
+            for( unsigned int n = 0u; n < attribute_names.size(); ++n)
             {
-              std::string const & name = *name_it;
-              T           const   val  = attributes.get_attribute_value( name, vo, label);
+              AttributeHandle const h( 0u, n);
+              T               const val = attributes.get_attribute_value( h, vo, label);
 
-              attributes.set_attribute_value( name, vn, label, val);
+              attributes.set_attribute_value( h, vn, label, val);
             }
           }
         }
@@ -159,7 +159,7 @@ namespace grit
                               Simplex0        const & vn
                               , Simplex0      const & vo
                               , SimplexSet    const & old_simplices
-                              , InterfaceMesh const & mesh
+                              , MI            const & mesh
                               , Parameters    const & parameters
                               , label_set           & labels_new
                               , label_set           & labels_rem
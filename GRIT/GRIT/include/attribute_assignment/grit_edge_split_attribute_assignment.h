@@ -43,6 +43,7 @@ namespace grit
       typedef typename types::attributes_type         AT;
       typedef typename types::attribute_manager_type  AMT;
       typedef typename types::param_type              PT;
+      typedef typename types::mesh_impl               MI;
 
       typedef typename AT::name_vector                name_vector;
       typedef typename AT::name_iterator              name_iterator;
@@ -67,7 +68,7 @@ namespace grit
       void operator()(
                       SimplexSet          const & new_simplices
                       , SimplexSet        const & old_simplices
-                      , InterfaceMesh     const & mesh
+                      , MI                const & mesh
                       , PT                const & parameters
                       , AT                      & attributes
                       , simplex1_lut_type const & simplex1_lut
@@ -117,17 +118,15 @@ namespace grit
 
           AMT::add_simplex0_label( vertex, label, attributes);
 
-          name_iterator name_it = attribute_names.begin();
-
-          for ( ; name_it!=attribute_names.end(); ++name_it)
+          for ( unsigned int n = 0u; n < attribute_names.size(); ++n)
           {
-            std::string const & name = *name_it;
+            AttributeHandle const h( 0u, n);
 
-            T const val0  = attributes.get_attribute_value( name, idx0, label);
-            T const val1  = attributes.get_attribute_value( name, idx1, label);
+            T const val0  = attributes.get_attribute_value( h, idx0, label);
+            T const val1  = attributes.get_attribute_value( h, idx1, label);
             T const value = VT::half() * ( val0 + val1 );
 
-            attributes.set_attribute_value( *name_it, vertex, label, value);
+            attributes.set_attribute_value( h, vertex, label, value);
           }
         }
 
@@ -22,6 +22,7 @@ namespace grit
 
       typedef typename types::attributes_type              AT;
       typedef typename types::param_type                   PT;
+      typedef typename types::mesh_impl                    MI;
 
       typedef typename base_class::simplex1_lut_type       simplex1_lut_type;
       typedef typename base_class::simplex2_lut_type       simplex2_lut_type;
@@ -31,7 +32,7 @@ namespace grit
       void operator()(
                       SimplexSet          const & new_simplices
                       , SimplexSet        const & old_simplices
-                      , InterfaceMesh     const & mesh
+                      , MI                const & mesh
                       , PT                const & parameters
                       , AT                      & attributes
                       , simplex1_lut_type const & simplex1_lut
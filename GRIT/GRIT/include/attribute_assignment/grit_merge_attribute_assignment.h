@@ -39,6 +39,7 @@ namespace grit
       typedef typename types::attributes_type         AT;
       typedef typename types::attribute_manager_type  AMT;
       typedef typename types::param_type              PT;
+      typedef typename types::mesh_impl               MI;
 
       typedef typename V::value_traits                VT;
 
@@ -66,7 +67,7 @@ namespace grit
       void operator()(
                       SimplexSet          const & new_simplices
                       , SimplexSet        const & old_simplices
-                      , InterfaceMesh     const & mesh
+                      , MI                const & mesh
                       , PT                const & parameters
                       , AT                      & attributes
                       , simplex1_lut_type const & simplex1_lut
@@ -123,19 +124,18 @@ namespace grit
           for( ; it!=labels_new.end(); ++it)
           {
             unsigned int  const label   = *it;
-            name_iterator       name_it = attribute_names.begin();
 
             AMT::add_simplex0_label( v0, label, attributes);
 
-            for( ; name_it != attribute_names.end(); ++name_it)
+            for( unsigned int n = 0u; n < attribute_names.size(); ++n)
             {
-              std::string const & name = *name_it;
+              AttributeHandle const h( 0u, n);
 
-              T const val1 = attributes.get_attribute_value( name, v1, label);
-              T const val2 = attributes.get_attribute_value( name, v2, label);
+              T const val1 = attributes.get_attribute_value( h, v1, label);
+              T const val2 = attributes.get_attribute_value( h, v2, label);
               T const val  = w1 * val1 + w2 * val2;
 
-              attributes.set_attribute_value( name, v0, label, val);
+              attributes.set_attribute_value( h, v0, label, val);
             }
           }
         }
@@ -147,18 +147,17 @@ namespace grit
           for( ; it!=labels_int.end(); ++it)
           {
             unsigned int  const label   = *it;
-            name_iterator       name_it = attribute_names.begin();
 
-            for( ; name_it != attribute_names.end(); ++name_it)
+            for( unsigned int n = 0u; n < attribute_names.size(); ++n)
             {
-              std::string const & name = *name_it;
+              AttributeHandle const h( 0u, n);
 
-              T const val0 = attributes.get_attribute_value( name, v0, label);
-              T const val1 = attributes.get_attribute_value( name, v1, label);
-              T const val2 = attributes.get_attribute_value( name, v2, label);
+              T const val0 = attributes.get_attribute_value( h, v0, label);
+              T const val1 = attributes.get_attribute_value( h, v1, label);
+              T const val2 = attributes.get_attribute_value( h, v2, label);
               T const vali = w1 * val1 + w2 * val2;
 
-              attributes.set_attribute_value( name, v0, label, VT::half()*(val0+vali));
+              attributes.set_attribute_value( h, v0, label, VT::half()*(val0+vali));
             }
           }
 
@@ -187,7 +186,7 @@ namespace grit
                               Simplex0        const & v0
                               , Simplex2      const & parent
                               , SimplexSet    const & old_simplices
-                              , InterfaceMesh const & mesh
+                              , MI            const & mesh
                               , Parameters    const & parameters
                               , label_set           & labels_new
                               , label_set           & labels_rem
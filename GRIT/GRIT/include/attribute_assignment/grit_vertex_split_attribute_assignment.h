@@ -27,6 +27,7 @@ namespace grit
       typedef typename types::attributes_type         AT;
       typedef typename types::attribute_manager_type  AMT;
       typedef typename types::param_type              PT;
+      typedef typename types::mesh_impl               MI;
 
       typedef typename V::value_traits                VT;
 
@@ -52,7 +53,7 @@ namespace grit
       void operator()(
                       SimplexSet          const & new_simplices
                       , SimplexSet        const & old_simplices
-                      , InterfaceMesh     const & mesh
+                      , MI                const & mesh
                       , PT                const & parameters
                       , AT                      & attributes
                       , simplex1_lut_type const & simplex1_lut
@@ -90,11 +91,11 @@ namespace grit
         AMT::add_simplex0_label( v_new, label, attributes);
 
         name_vector const & att_names = attributes.simplex0_attribute_names();
-        for( name_iterator it = att_names.begin(); it != att_names.end(); ++it)
+        for( unsigned int n = 0u; n < att_names.size(); ++n)
         {
-          std::string const & name = *it;
-          T const & val = attributes.get_attribute_value( name, v_old, label);
-          attributes.set_attribute_value( name, v_new, label, val);
+          AttributeHandle const h( 0u, n);
+          T const val = attributes.get_attribute_value( h, v_old, label);
+          attributes.set_attribute_value( h, v_new, label, val);
         }
 
         AMT::erase_simplex0_label( v_old, label, attributes);
@@ -111,7 +112,7 @@ namespace grit
                              , Simplex2      const & triangle
                              , Simplex0            & v_old
                              , Simplex0            & v_new
-                             , InterfaceMesh const & mesh
+                             , MI            const & mesh
                              ) const
       {
         Simplex0 v1, v2;
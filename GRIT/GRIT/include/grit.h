@@ -3,19 +3,29 @@
 
 #include <grit_simplex.h>
 #include <grit_simplex_set.h>
+#include <grit_simplex_lut.h>
 #include <grit_logic_expressions.h>
 #include <grit_simplex_set_functions.h>
 #include <grit_attribute_vector.h>
+#include <grit_attribute_handle.h>
+#include <grit_simplex0_multi_attribute_table.h>
+#include <grit_spatial_hash.h>
 #include <grit_opentissue_math_types.h>
+#include <grit_vector2_math_types.h>
 #include <grit_opentissue_mesh.h>
+#include <grit_polymesh_list_kernel.h>
+#include <grit_polymesh_vector_kernel.h>
 
 #include <grit_domain_manager.h>
+#include <grit_mesh_regions.h>
 #include <grit_attribute_manager.h>
 
 #include <grit_parameters.h>
 #include <grit_pthread_scheduler.h>
 #include <grit_quality_analyzer.h>
 #include <grit_slab_decomposition.h>
+#include <grit_bisection_decomposition.h>
+#include <grit_graph_decomposition.h>
 #include <grit_subdomain.h>
 #include <grit_default_algorithm.h>
 #include <grit_do_operations.h>
@@ -71,6 +81,7 @@
 #include <utilities/grit_relabel_phase.h>
 #include <utilities/grit_accumulate_attributes.h>
 #include <utilities/grit_compute_bounding_box.h>
+#include <utilities/grit_compact.h>
 #include <utilities/grit_compute_midpoint.h>
 #include <utilities/grit_compute_phase_labels.h>
 #include <utilities/grit_extract_simplices.h>
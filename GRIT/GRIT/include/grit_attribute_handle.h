@@ -0,0 +1,64 @@
+#ifndef GRIT_ATTRIBUTE_HANDLE_H
+#define GRIT_ATTRIBUTE_HANDLE_H
+
+#include <limits>   // Needed for std::numeric_limits
+
+namespace grit
+{
+
+  /**
+   * An attribute handle identifies a named attribute of an Attributes
+   * object. It is obtained once from the name of the attribute, using
+   * Attributes::get_attribute_handle, and can then be used to access
+   * the attribute values without any name lookup.
+   *
+   * The index of a handle is the position of the attribute name in
+   * Attributes::simplex0_attribute_names() (or simplex1/simplex2), so
+   * AttributeHandle(d, n) refers to the n'th attribute of dimension d.
+   *
+   * A handle stays valid until the attribute names of the Attributes
+   * object are reset (i.e. by AttributeManager::copy_attribute_names).
+   */
+  class AttributeHandle
+  {
+  protected:
+
+    unsigned int m_dimension;   ///< The dimension of the simplices the attribute is defined on.
+    unsigned int m_index;       ///< The index of the attribute among attributes of the same dimension.
+
+  public:
+
+    AttributeHandle()
+    : m_dimension( std::numeric_limits<unsigned int>::max() )
+    , m_index( std::numeric_limits<unsigned int>::max() )
+    {}
+
+    AttributeHandle(unsigned int const & dimension, unsigned int const & index)
+    : m_dimension(dimension)
+    , m_index(index)
+    {}
+
+    unsigned int const & dimension() const { return m_dimension; }
+    unsigned int const & index()     const { return m_index;     }
+
+    bool is_null() const
+    {
+      return m_index == std::numeric_limits<unsigned int>::max();
+    }
+
+    friend bool operator== (AttributeHandle const & a, AttributeHandle const & b)
+    {
+      return a.m_dimension == b.m_dimension && a.m_index == b.m_index;
+    }
+
+    friend bool operator!= (AttributeHandle const & a, AttributeHandle const & b)
+    {
+      return !(a == b);
+    }
+
+  };
+
+}//end namespace grit
+
+// GRIT_ATTRIBUTE_HANDLE_H
+#endif
@@ -2,6 +2,7 @@
 #define GRIT_ATTRIBUTE_MANAGER_H
 
 #include <grit_attribute_vector.h>
+#include <grit_attribute_handle.h>
 #include <grit_simplex.h>
 #include <grit_simplex_set.h>
 
@@ -99,7 +100,7 @@ namespace grit
                                         , AT           & attributes
                                         )
       {
-        attributes.simplex0_labels(s).clear();
+        attributes.clear_simplex0_labels(s);
       }
 
       static void erase_simplex0_label(
@@ -108,52 +109,7 @@ namespace grit
                                        , AT                 & attributes
                                        )
       {
-        std::vector<std::string>  const & names = attributes.simplex0_attribute_names();
-
-        std::vector<unsigned int> const & old_labels = attributes.simplex0_labels(s);
-        std::vector<unsigned int>         new_labels(0u);
-
-        std::map< std::string, std::vector<T> > values;
-
-        {
-          std::vector<unsigned int>::const_iterator it = old_labels.begin();
-          for( ; it != old_labels.end(); ++it)
-          {
-            unsigned int const & l = *it;
-
-            if( l != label)
-            {
-              new_labels.push_back(l);
-
-              name_iterator name_it = names.begin();
-              for( ; name_it != names.end(); ++name_it)
-              {
-                std::string const & name = *name_it;
-                T const & val = attributes.get_attribute_value( name, s, l);
-                values[name].push_back(val);
-              }
-            }
-          }
-        }
-
-        attributes.clear(s);
-
-        {
-          for( unsigned int i = 0u ; i < new_labels.size(); ++i)
-          {
-            unsigned int const & l = new_labels[i];
-            attributes.add_simplex0_label( s, l);
-
-            name_iterator name_it = names.begin();
-            for( ; name_it != names.end(); ++name_it)
-            {
-              std::string const & name = *name_it;
-              T const & val = values[name][i];
-              attributes.set_attribute_value( name, s, l, val);
-            }
-          }
-        }
-
+        attributes.erase_simplex0_label( s, label);
       }
 
     public:
@@ -4,10 +4,12 @@
 #include <grit_simplex.h>
 #include <grit_simplex_set.h>
 
-#include <map>
+#include <unordered_map>
 #include <vector>
+#include <stdexcept> // Needed for std::out_of_range
 #include <algorithm> // Needed for std::min and std::max
 #include <limits>    // Needed for std::numeric_limits
+#include <utility>   // Needed for std::move
 
 namespace grit
 {
@@ -57,6 +59,24 @@ namespace grit
       return *this;
     }
 
+    Simplex0AttributeVector( Simplex0AttributeVector && v)
+    : m_data( std::move(v.m_data) )
+    {}
+
+    Simplex0AttributeVector & operator=( Simplex0AttributeVector && v )
+    {
+      if(this!=&v)
+      {
+        this->m_data = std::move(v.m_data);
+      }
+      return *this;
+    }
+
+    void swap( Simplex0AttributeVector & v )
+    {
+      this->m_data.swap(v.m_data);
+    }
+
   public:
 
     T & operator[](Simplex0 const & s)
@@ -142,88 +162,123 @@ namespace grit
     }
   }
 
-  template<typename T>
-  class Simplex1AttributeVector
+  /**
+   * Dense Simplex Attribute Vector.
+   * Stores one value of type T per simplex of type S. The values are kept
+   * in a contiguous array of slots, and a hash table maps each simplex to
+   * its slot, so reads and writes are O(1). Slots of erased simplices are
+   * recycled.
+   */
+  template<typename S, typename T>
+  class DenseSimplexAttributeVector
     : public SimplexAttributeVector<T>
   {
   protected:
 
-    std::map<Simplex1, T> m_data;
+    std::unordered_map<S, unsigned int> m_lut;          ///< Maps a simplex to its slot.
+    std::vector<T>                      m_values;       ///< The value stored in each slot.
+    std::vector<unsigned int>           m_free_slots;   ///< Released slots ready for reuse.
 
-  public:
+  protected:
 
-    T & operator[](Simplex1 const & s)
+    unsigned int allocate_slot()
     {
-      return m_data[s];
-    }
+      if (!m_free_slots.empty())
+      {
+        unsigned int const slot = m_free_slots.back();
+        m_free_slots.pop_back();
+        return slot;
+      }
 
-    T const & operator[](Simplex1 const & s) const
-    {
-      return m_data.at(s);//C++11 feature
-    }
+      m_values.push_back( T() );
 
-    size_t size() const
-    {
-      return m_data.size();
+      return static_cast<unsigned int>( m_values.size() - 1u );
     }
 
-    void erase(Simplex1 const & s)
+  public:
+
+    T & operator[](S const & s)
     {
-      m_data.erase(s);
+      typename std::unordered_map<S, unsigned int>::const_iterator lookup = m_lut.find(s);
+
+      if (lookup != m_lut.end())
+        return m_values[lookup->second];
+
+      unsigned int const slot = allocate_slot();
+
+      m_lut.insert( std::make_pair(s, slot) );
+
+      return m_values[slot];
     }
 
-    void clear()
+    T const & operator[](S const & s) const
     {
-      m_data.clear();
+      return m_values[ m_lut.at(s) ];
     }
 
-    bool has_value(Simplex1 const & s) const
+    size_t size() const
     {
-      return (m_data.find(s) != m_data.end());
+      return m_lut.size();
     }
 
-  };
+    void erase(S const & s)
+    {
+      typename std::unordered_map<S, unsigned int>::iterator lookup = m_lut.find(s);
 
-  template<typename T>
-  class Simplex2AttributeVector
-    : public SimplexAttributeVector<T>
-  {
-  protected:
+      if (lookup == m_lut.end())
+        return;
 
-    std::map<Simplex2, T> m_data;
+      unsigned int const slot = lookup->second;
 
-  public:
+      m_lut.erase(lookup);
 
-    T const & operator[](Simplex2 const & s) const
-    {
-      return m_data.at(s);//C++11 feature
+      m_values[slot] = T();
+      m_free_slots.push_back(slot);
     }
 
-    T       & operator[](Simplex2 const & s)
+    void clear()
     {
-      return m_data[s];
+      m_lut.clear();
+      m_values.clear();
+      m_free_slots.clear();
     }
 
-    size_t size() const
+    void swap(DenseSimplexAttributeVector & v)
     {
-      return m_data.size();
+      m_lut.swap(v.m_lut);
+      m_values.swap(v.m_values);
+      m_free_slots.swap(v.m_free_slots);
     }
 
-    void erase(Simplex2 const & s)
+    bool has_value(S const & s) const
     {
-      m_data.erase(s);
+      return (m_lut.find(s) != m_lut.end());
     }
 
-    void clear()
-    {
-      m_data.clear();
-    }
+  };
 
-    bool has_value(Simplex2 const & s) const
-    {
-      return (m_data.find(s) != m_data.end());
-    }
+  template<typename T>
+  inline void swap(Simplex0AttributeVector<T> & a, Simplex0AttributeVector<T> & b)
+  {
+    a.swap(b);
+  }
 
+  template<typename S, typename T>
+  inline void swap(DenseSimplexAttributeVector<S,T> & a, DenseSimplexAttributeVector<S,T> & b)
+  {
+    a.swap(b);
+  }
+
+  template<typename T>
+  class Simplex1AttributeVector
+    : public DenseSimplexAttributeVector<Simplex1, T>
+  {
+  };
+
+  template<typename T>
+  class Simplex2AttributeVector
+    : public DenseSimplexAttributeVector<Simplex2, T>
+  {
   };
 
 }// end namespace grit
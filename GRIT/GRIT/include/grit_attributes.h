@@ -2,6 +2,7 @@
 #define GRIT_ATTRIBUTES_H
 
 #include <grit_attribute_vector.h>
+#include <grit_attribute_handle.h>
 #include <grit_attribute_manager.h>
 #include <grit_logic_expressions.h>
 #include <grit_simplex.h>
@@ -9,12 +10,11 @@
 #include <grit_simplex_set_functions.h>
 
 #include <util_log.h>
-#include <util_find_index.h>
 
 #include <vector>
-#include <map>
 #include <string>
 #include <algorithm>  // Needed for std::find
+#include <cassert>
 #include <stdexcept>  // Needed for std::logic_error
 
 namespace grit
@@ -37,6 +37,12 @@ namespace grit
      * phase the 0-simplex belongs to (except for the ambient phase).
      * Custom attributes for 1- and 2-simplices a single-valued and defined also
      * on purely ambient simplices.
+     *
+     * Attributes can be accessed either by name or by an AttributeHandle. The
+     * name based functions resolve the handle on every call, so code that
+     * accesses the same attribute many times (i.e. per vertex in a loop)
+     * should get the handle once using get_attribute_handle and use the
+     * handle based functions.
      */
     template<typename types>
     class Attributes
@@ -54,12 +60,13 @@ namespace grit
       typedef typename V::value_traits                   VT;
 
       typedef          Simplex0AttributeVector<V>        CT;  ///< special attribute vector type used to store current (i.e. mesh) positions of 0-simplices;
-      typedef typename types::sim0_attributes_uint_type  AI0;
 
       typedef typename types::sim2_attributes_real_type  AR2;
       typedef typename types::sim1_attributes_real_type  AR1;
       typedef typename types::sim0_attributes_real_type  AR0;
 
+      typedef typename AR0::label_range                  label_range;  ///< read-only view of the labels of a 0-simplex
+
       typedef typename types::mesh_impl                  MI;
 
       typedef          std::vector<std::string>          name_vector;
@@ -68,16 +75,18 @@ namespace grit
     protected:
 
       CT         m_current;          ///< current positions of the mesh's vertices
-      AI0        m_simplex0_labels;  ///< identifies all labels associated with each vertex.
 
-      std::map< std::string, AR0>  m_simplex0_real_attributes; ///< Associative map of all custom (named) Simplex0 attributes
-      std::map< std::string, AR1>  m_simplex1_real_attributes; ///< Associative map of all custom (named) Simplex1 attributes
-      std::map< std::string, AR2>  m_simplex2_real_attributes; ///< Associative map of all custom (named) Simplex2 attributes
+      AR0                          m_simplex0_real_attributes; ///< Labels of all vertices and all custom (named) Simplex0 attributes, one column per attribute handle
+      std::vector< AR1>            m_simplex1_real_attributes; ///< All custom (named) Simplex1 attributes, indexed by attribute handle
+      std::vector< AR2>            m_simplex2_real_attributes; ///< All custom (named) Simplex2 attributes, indexed by attribute handle
 
       std::vector< std::string>    m_simplex0_attribute_names; ///< vector of all names of custom Simplex0 attributes
       std::vector< std::string>    m_simplex1_attribute_names; ///< vector of all names of custom Simplex1 attributes
       std::vector< std::string>    m_simplex2_attribute_names; ///< vector of all names of custom Simplex2 attributes
 
+      AttributeHandle              m_target_x;                 ///< Handle of the "__target_x" attribute, null until it is created.
+      AttributeHandle              m_target_y;                 ///< Handle of the "__target_y" attribute, null until it is created.
+
     public:
 
       std::vector< std::string> const & simplex0_attribute_names() const { return m_simplex0_attribute_names; }
@@ -99,8 +108,10 @@ namespace grit
        * @param dimension              The dimension of the simplex type that the attribute
        *                               should be created for. Current legal values are 0 (a
        *                               vertex attribute) and 2 (a "triangle" attribute).
+       *
+       * @return                       The handle of the new attribute.
        */
-      void create_attribute(std::string const & attribute_name, unsigned int const dimension)
+      AttributeHandle create_attribute(std::string const & attribute_name, unsigned int const dimension)
       {
         if (exist_attribute(attribute_name, dimension))
         {
@@ -114,74 +125,126 @@ namespace grit
         if (dimension == 0u)
         {
           m_simplex0_attribute_names.push_back(attribute_name);
-          m_simplex0_real_attributes[attribute_name].clear();
+          m_simplex0_real_attributes.add_column();
+
+          AttributeHandle const h(0u, m_simplex0_real_attributes.columns() - 1u);
+
+          if (attribute_name == "__target_x")
+            m_target_x = h;
+
+          if (attribute_name == "__target_y")
+            m_target_y = h;
 
-          return;
+          return h;
         }
 
         if (dimension == 1u)
         {
           m_simplex1_attribute_names.push_back(attribute_name);
-          m_simplex1_real_attributes[attribute_name].clear();
+          m_simplex1_real_attributes.push_back(AR1());
 
-          return;
+          return AttributeHandle(1u, m_simplex1_real_attributes.size() - 1u);
         }
 
         if (dimension == 2u)
         {
           m_simplex2_attribute_names.push_back(attribute_name);
-          m_simplex2_real_attributes[attribute_name].clear();
+          m_simplex2_real_attributes.push_back(AR2());
 
-          return;
+          return AttributeHandle(2u, m_simplex2_real_attributes.size() - 1u);
         }
-      }
 
-    public:
+        return AttributeHandle();
+      }
 
       /**
-       * This function tests if a specified named attribute of given dimension
-       * exist in the attribute manager.
+       * Removes a named attribute and all its values. Handles of attributes
+       * of the same dimension created after the removed attribute become
+       * invalid, handles of attributes created before it stay valid.
+       *
+       * @return                       False if the attribute does not exist.
        */
-      bool exist_attribute(std::string const & attribute_name, unsigned int const & dimension) const
+      bool destroy_attribute(std::string const & attribute_name, unsigned int const & dimension)
       {
-        if (dimension == 0u)
-        {
-          std::vector<std::string>::const_iterator lookup = find(
-                                                                 m_simplex0_attribute_names.begin()
-                                                                 , m_simplex0_attribute_names.end()
-                                                                 , attribute_name);
+        AttributeHandle const h = get_attribute_handle(attribute_name, dimension);
 
-          if(lookup == m_simplex0_attribute_names.end() )
-            return false;
+        if (h.is_null())
+          return false;
 
-          return true;
+        if (dimension == 0u)
+        {
+          m_simplex0_attribute_names.erase(m_simplex0_attribute_names.begin() + h.index());
+          m_simplex0_real_attributes.remove_column(h.index());
 
+          m_target_x = get_attribute_handle("__target_x", 0u);
+          m_target_y = get_attribute_handle("__target_y", 0u);
         }
 
         if (dimension == 1u)
         {
-          std::vector<std::string>::const_iterator lookup = find(
-                                                                 m_simplex1_attribute_names.begin()
-                                                                 , m_simplex1_attribute_names.end()
-                                                                 , attribute_name);
-
-          if(lookup == m_simplex1_attribute_names.end() )
-            return false;
-
-          return true;
+          m_simplex1_attribute_names.erase(m_simplex1_attribute_names.begin() + h.index());
+          m_simplex1_real_attributes.erase(m_simplex1_real_attributes.begin() + h.index());
         }
 
         if (dimension == 2u)
         {
-          std::vector<std::string>::const_iterator lookup = find(
-                                                                 m_simplex2_attribute_names.begin()
-                                                                 , m_simplex2_attribute_names.end()
-                                                                 , attribute_name);
+          m_simplex2_attribute_names.erase(m_simplex2_attribute_names.begin() + h.index());
+          m_simplex2_real_attributes.erase(m_simplex2_real_attributes.begin() + h.index());
+        }
+
+        return true;
+      }
 
-          if(lookup == m_simplex2_attribute_names.end() )
-            return false;
+    public:
 
-          return true;
+      /**
+       * This function resolves the name of an attribute into an attribute
+       * handle. If no attribute with the given name and dimension exist
+       * a null handle is returned.
+       */
+      AttributeHandle get_attribute_handle(std::string const & attribute_name, unsigned int const & dimension) const
+      {
+        std::vector<std::string> const * names = 0;
+
+        switch (dimension)
+        {
+          case 0: names = &m_simplex0_attribute_names; break;
+          case 1: names = &m_simplex1_attribute_names; break;
+          case 2: names = &m_simplex2_attribute_names; break;
+          default: return AttributeHandle();
+        }
+
+        std::vector<std::string>::const_iterator lookup = find(
+                                                               names->begin()
+                                                               , names->end()
+                                                               , attribute_name);
+
+        if(lookup == names->end() )
+          return AttributeHandle();
+
+        return AttributeHandle(dimension, lookup - names->begin());
+      }
+
+      /**
+       * This function tests if a specified named attribute of given dimension
+       * exist in the attribute manager.
+       */
+      bool exist_attribute(std::string const & attribute_name, unsigned int const & dimension) const
+      {
+        return !get_attribute_handle(attribute_name, dimension).is_null();
+      }
+
+      /**
+       * This function tests if an attribute handle refers to an existing
+       * attribute.
+       */
+      bool exist_attribute(AttributeHandle const & h) const
+      {
+        switch (h.dimension())
+        {
+          case 0: return h.index() < m_simplex0_real_attributes.columns();
+          case 1: return h.index() < m_simplex1_real_attributes.size();
+          case 2: return h.index() < m_simplex2_real_attributes.size();
         }
 
         return false;
@@ -189,15 +252,39 @@ namespace grit
 
     public:
 
+      /**
+       * This function tests if the value for a specified attribute
+       * exist in the attribute manager, for a given simplex.
+       */
+      bool exist_attribute_value(AttributeHandle const & h, Simplex1 const & simplex) const
+      {
+        assert( (h.dimension() == 1u && h.index() < m_simplex1_real_attributes.size()) || !"exist_attribute_value(): invalid attribute handle");
+
+        return m_simplex1_real_attributes[h.index()].has_value(simplex);
+      }
+
+      /**
+       * This function tests if the value for a specified attribute
+       * exist in the attribute manager, for a given simplex.
+       */
+      bool exist_attribute_value(AttributeHandle const & h, Simplex2 const & simplex) const
+      {
+        assert( (h.dimension() == 2u && h.index() < m_simplex2_real_attributes.size()) || !"exist_attribute_value(): invalid attribute handle");
+
+        return m_simplex2_real_attributes[h.index()].has_value(simplex);
+      }
+
       /**
        * This function tests if the value for a specified named attribute
        * exist in the attribute manager, for a given simplex.
        */
       bool exist_attribute_value(std::string const & attribute_name, Simplex1 const & simplex) const
       {
-        if( exist_attribute( attribute_name, 1u))
+        AttributeHandle const h = get_attribute_handle( attribute_name, 1u);
+
+        if( !h.is_null())
         {
-          return m_simplex1_real_attributes.at(attribute_name).has_value(simplex);
+          return exist_attribute_value(h, simplex);
         }
 
         return false;
@@ -209,9 +296,11 @@ namespace grit
        */
       bool exist_attribute_value(std::string const & attribute_name, Simplex2 const & simplex) const
       {
-        if( exist_attribute( attribute_name, 2u))
+        AttributeHandle const h = get_attribute_handle( attribute_name, 2u);
+
+        if( !h.is_null())
         {
-          return m_simplex2_real_attributes.at(attribute_name).has_value(simplex);
+          return exist_attribute_value(h, simplex);
         }
 
         return false;
@@ -256,39 +345,26 @@ namespace grit
                          , unsigned int const & label
                          ) const
       {
-        std::string const name_x("__target_x");
-        std::string const name_y("__target_y");
-
-        if( !exist_attribute( "__target_x", 0u) || !exist_attribute( "__target_y", 0u))
+        if( m_target_x.is_null() || m_target_y.is_null())
         {
           util::Log logging;
           logging << "get_target_value() Warning! target vector was not defined / using current value" << util::Log::newline();
           return m_current[s];
         }
 
-        std::vector< unsigned int> const & labels = m_simplex0_labels[s];
+        unsigned int const slot = m_simplex0_real_attributes.slot( s, label);
 
-        unsigned int const idx = util::find_index( label, labels);
-        if( idx > labels.size())
+        if( slot == AR0::no_slot())
         {
           util::Log logging;
           logging << "get_target_value() Warning! label not found / using current value" << util::Log::newline();
           return m_current[s];
         }
 
-        if( idx < m_simplex0_real_attributes.at(name_x)[s].size()
-         && idx < m_simplex0_real_attributes.at(name_y)[s].size())
-        {
-          V result(VT::zero());
-          result[0u] = m_simplex0_real_attributes.at(name_x)[s][idx];
-          result[1u] = m_simplex0_real_attributes.at(name_y)[s][idx];
-          return result;
-        }
-
-        util::Log logging;
-        logging << "get_target_value() Warning! mismatch between the number of labels and attribute size / using current value" << util::Log::newline();
-
-        return m_current[s];
+        V result(VT::zero());
+        result[0u] = m_simplex0_real_attributes.value( m_target_x.index(), slot);
+        result[1u] = m_simplex0_real_attributes.value( m_target_y.index(), slot);
+        return result;
       }
 
 
@@ -308,56 +384,100 @@ namespace grit
                             , V            const & value
                             )
       {
-        std::string const name_x("__target_x");
-        std::string const name_y("__target_y");
-
-        if( !exist_attribute( name_x, 0u))
+        if( m_target_x.is_null())
         {
-          create_attribute( name_x, 0u);
+          create_attribute( "__target_x", 0u);
         }
 
-        if( !exist_attribute( name_y, 0u))
+        if( m_target_y.is_null())
         {
-          create_attribute( name_y, 0u);
+          create_attribute( "__target_y", 0u);
         }
 
-        set_attribute_value(name_x, s, label, value[0u]);
-        set_attribute_value(name_y, s, label, value[1u]);
+        set_attribute_value(m_target_x, s, label, value[0u]);
+        set_attribute_value(m_target_y, s, label, value[1u]);
       }
 
     public:
 
       /**
-       * This function returns the value of a custom (named) attribute at a given 0-simplex,
+       * This function returns the value of an attribute at a given 0-simplex,
        * associated with specified phase.
        *
+       * @param h           handle of the attribute
        * @param label       label identifying the phase
        */
       T const & get_attribute_value(
-                                    std::string    const & name
-                                    , Simplex0     const & s
-                                    , unsigned int const & label
+                                    AttributeHandle const & h
+                                    , Simplex0      const & s
+                                    , unsigned int  const & label
                                     ) const
       {
-        if (!exist_attribute( name, 0u))
+        assert( (h.dimension() == 0u && h.index() < m_simplex0_real_attributes.columns()) || !"get_attribute_value(): invalid attribute handle");
+
+        unsigned int const slot = m_simplex0_real_attributes.slot( s, label);
+
+        if( slot == AR0::no_slot())
         {
           util::Log logging;
-          logging << "get_attribute_value() Error! Attribute " << name << " does not exist!" << util::Log::newline();
-          throw std::logic_error("Trying to get attribute value from an undefined attribute");
+          logging << "get_attribute_value() Error! Label " << label << " does not exist for simplex s" << util::Log::newline();
+          throw std::logic_error("Label does not exist for simplex s");
         }
 
-        std::vector< unsigned int> const & labels = m_simplex0_labels[s];
+        return m_simplex0_real_attributes.value( h.index(), slot);
+      }
+
+      /**
+       * This function sets the value of an attribute at a given 0-simplex,
+       * associated with specified phase.
+       *
+       * @param h           handle of the attribute
+       * @param label       label identifying the phase
+       * @param att_value   the new value of the attribute.
+       */
+      void set_attribute_value(
+                               AttributeHandle const & h
+                               , Simplex0      const & s
+                               , unsigned int  const & label
+                               , T             const & att_value
+                               )
+      {
+        assert( (h.dimension() == 0u && h.index() < m_simplex0_real_attributes.columns()) || !"set_attribute_value(): invalid attribute handle");
 
-        unsigned int const idx = util::find_index( label, labels);
+        unsigned int const slot = m_simplex0_real_attributes.slot( s, label);
 
-        if( idx > labels.size())
+        if( slot == AR0::no_slot())
         {
           util::Log logging;
-          logging << "get_attribute_value() Error! Label " << label << " does not exist for simplex s" << util::Log::newline();
-          throw std::logic_error("Label does not exist for simplex s");
+          logging << "set_attribute_value() Error! Label " << label << " does not exist for simplex s" << util::Log::newline();
+          throw std::logic_error("Trying to set set target value to an undefined label at s");
+        }
+
+        m_simplex0_real_attributes.value( h.index(), slot) = att_value;
+      }
+
+      /**
+       * This function returns the value of a custom (named) attribute at a given 0-simplex,
+       * associated with specified phase.
+       *
+       * @param label       label identifying the phase
+       */
+      T const & get_attribute_value(
+                                    std::string    const & name
+                                    , Simplex0     const & s
+                                    , unsigned int const & label
+                                    ) const
+      {
+        AttributeHandle const h = get_attribute_handle( name, 0u);
+
+        if (h.is_null())
+        {
+          util::Log logging;
+          logging << "get_attribute_value() Error! Attribute " << name << " does not exist!" << util::Log::newline();
+          throw std::logic_error("Trying to get attribute value from an undefined attribute");
         }
 
-        return m_simplex0_real_attributes.at(name)[s][idx];
+        return get_attribute_value( h, s, label);
       }
 
       /**
@@ -374,33 +494,46 @@ namespace grit
                                , T            const & att_value
                                )
       {
-        if (!exist_attribute( name, 0u))
+        AttributeHandle const h = get_attribute_handle( name, 0u);
+
+        if (h.is_null())
         {
           util::Log logging;
           logging << "set_attribute_value() Error! Attribute " << name << " does not exist!" << util::Log::newline();
           throw std::logic_error("Trying to set attribute value in an undefined attribute");
         }
 
-        std::vector< unsigned int> const & labels = m_simplex0_labels[s];
-
-        if (m_simplex0_real_attributes[name][s].size() < labels.size())
-        {
-          m_simplex0_real_attributes[name][s].resize(labels.size());
-        }
+        set_attribute_value( h, s, label, att_value);
+      }
 
-        unsigned int const idx = util::find_index( label, labels );
+    public:
 
-        if( idx > labels.size())
-        {
-          util::Log logging;
-          logging << "set_attribute_value() Error! Label " << label << " does not exist for simplex s" << util::Log::newline();
-          throw std::logic_error("Trying to set set target value to an undefined label at s");
-        }
+      /**
+       * This function returns the value of an attribute at a given 1-simplex.
+       */
+      T const & get_attribute_value(
+                                    AttributeHandle const & h
+                                    , Simplex1      const & s
+                                    ) const
+      {
+        assert( (h.dimension() == 1u && h.index() < m_simplex1_real_attributes.size()) || !"get_attribute_value(): invalid attribute handle");
 
-        m_simplex0_real_attributes[name][s][idx] = att_value;
+        return m_simplex1_real_attributes[h.index()][s];
       }
 
-    public:
+      /**
+       * This function sets the value of an attribute at a given 1-simplex.
+       */
+      void set_attribute_value(
+                               AttributeHandle const & h
+                               , Simplex1      const & s
+                               , T             const & att_value
+                               )
+      {
+        assert( (h.dimension() == 1u && h.index() < m_simplex1_real_attributes.size()) || !"set_attribute_value(): invalid attribute handle");
+
+        m_simplex1_real_attributes[h.index()][s] = att_value;
+      }
 
       /**
        * This function returns the value of a custom (named) attribute at a given 1-simplex.
@@ -410,7 +543,9 @@ namespace grit
                                     , Simplex1     const & s
                                     ) const
       {
-        if (!exist_attribute(name, 1u))
+        AttributeHandle const h = get_attribute_handle( name, 1u);
+
+        if (h.is_null())
         {
           util::Log logging;
 
@@ -419,7 +554,7 @@ namespace grit
           throw std::logic_error("Trying to access an attribute value from an undefined attribute");
         }
 
-        return m_simplex1_real_attributes.at(name)[s];
+        return get_attribute_value( h, s);
       }
 
       /**
@@ -431,7 +566,9 @@ namespace grit
                                , T            const & att_value
                                )
       {
-        if (!exist_attribute(name, 1u))
+        AttributeHandle const h = get_attribute_handle( name, 1u);
+
+        if (h.is_null())
         {
           util::Log logging;
 
@@ -440,12 +577,39 @@ namespace grit
           throw std::logic_error("Trying to set an attribute value in an undefined attribute");
         }
 
-        m_simplex1_real_attributes[name][s] = att_value;
+        set_attribute_value( h, s, att_value);
       }
 
 
     public:
 
+      /**
+       * This function returns the value of an attribute at a given 2-simplex.
+       */
+      T const & get_attribute_value(
+                                    AttributeHandle const & h
+                                    , Simplex2      const & s
+                                    ) const
+      {
+        assert( (h.dimension() == 2u && h.index() < m_simplex2_real_attributes.size()) || !"get_attribute_value(): invalid attribute handle");
+
+        return m_simplex2_real_attributes[h.index()][s];
+      }
+
+      /**
+       * This function sets the value of an attribute at a given 2-simplex.
+       */
+      void set_attribute_value(
+                               AttributeHandle const & h
+                               , Simplex2      const & s
+                               , T             const & att_value
+                               )
+      {
+        assert( (h.dimension() == 2u && h.index() < m_simplex2_real_attributes.size()) || !"set_attribute_value(): invalid attribute handle");
+
+        m_simplex2_real_attributes[h.index()][s] = att_value;
+      }
+
       /**
        * This function returns the value of a custom (named) attribute at a given 2-simplex.
        */
@@ -454,7 +618,9 @@ namespace grit
                                     , Simplex2     const & s
                                     ) const
       {
-        if (!exist_attribute(name, 2u))
+        AttributeHandle const h = get_attribute_handle( name, 2u);
+
+        if (h.is_null())
         {
           util::Log logging;
 
@@ -463,7 +629,7 @@ namespace grit
           throw std::logic_error("Trying to access an attribute value from an undefined attribute");
         }
 
-        return m_simplex2_real_attributes.at(name)[s];
+        return get_attribute_value( h, s);
       }
 
       /**
@@ -475,7 +641,9 @@ namespace grit
                                , T            const & att_value
                                )
       {
-        if (!exist_attribute(name, 2u))
+        AttributeHandle const h = get_attribute_handle( name, 2u);
+
+        if (h.is_null())
         {
           util::Log logging;
 
@@ -484,7 +652,7 @@ namespace grit
           throw std::logic_error("Trying to set an attribute value in an undefined attribute");
         }
 
-        m_simplex2_real_attributes[name][s] = att_value;
+        set_attribute_value( h, s, att_value);
       }
 
 
@@ -494,19 +662,11 @@ namespace grit
       /**
        * This function returns the vector of all phase labels adjacent at a specified 0-simplex.
        */
-      std::vector< unsigned int> const & get_simplex0_labels( Simplex0 const & s) const
+      label_range get_simplex0_labels( Simplex0 const & s) const
       {
-        return m_simplex0_labels[s];
+        return m_simplex0_real_attributes.labels(s);
       }
 
-    private:
-
-      std::vector< unsigned int> & simplex0_labels( Simplex0 const & s)
-      {
-        return m_simplex0_labels[s];
-      }
-
-
     private:
 
       void add_simplex0_label(
@@ -514,7 +674,20 @@ namespace grit
                               , unsigned int const & label
                               )
       {
-        m_simplex0_labels[s].push_back(label);
+        m_simplex0_real_attributes.add_label( s, label);
+      }
+
+      void erase_simplex0_label(
+                                Simplex0     const & s
+                                , unsigned int const & label
+                                )
+      {
+        m_simplex0_real_attributes.erase_label( s, label);
+      }
+
+      void clear_simplex0_labels( Simplex0 const & s)
+      {
+        m_simplex0_real_attributes.clear_labels(s);
       }
 
     private:
@@ -522,7 +695,10 @@ namespace grit
       void copy_attribute_names( Attributes<types> const & from_attributes)
       {
         m_simplex0_attribute_names.clear();
-        m_simplex0_real_attributes.clear();
+        m_simplex0_real_attributes.clear_columns();
+
+        m_target_x = AttributeHandle();
+        m_target_y = AttributeHandle();
 
         name_iterator name_it = from_attributes.simplex0_attribute_names().begin();
         for ( ; name_it != from_attributes.simplex0_attribute_names().end(); ++name_it)
@@ -559,40 +735,34 @@ namespace grit
       {
         m_current[to] = from_attributes.m_current[from];
 
-        std::vector<unsigned int> const & from_labels = from_attributes.m_simplex0_labels[from];
-        std::vector<unsigned int>       & to_labels   = m_simplex0_labels[to];
+        label_range const from_labels = from_attributes.get_simplex0_labels(from);
+        name_vector const & from_names = from_attributes.simplex0_attribute_names();
 
-        name_vector               const & from_names  = from_attributes.simplex0_attribute_names();
+        //--- Labels have to be initialized for every vertex, needed to avoid SegFaults
+        m_simplex0_real_attributes.clear_labels(to);
 
-        if (from_labels.size() > 0u)
+        for (unsigned int i = 0u; i < from_labels.size(); ++i)
         {
-          to_labels.clear();
-          to_labels.insert( to_labels.begin(), from_labels.begin(), from_labels.end());
-
-          for (unsigned int i = 0u; i < to_labels.size(); ++i)
-          {
-            unsigned int const label = to_labels[i];
+          m_simplex0_real_attributes.add_label( to, from_labels[i]);
+        }
 
-            name_iterator name_it = from_names.begin();
+        for (unsigned int n = 0u; n < from_names.size() && !from_labels.empty(); ++n)
+        {
+          AttributeHandle const to_handle = get_attribute_handle( from_names[n], 0u);
 
-            for ( ; name_it != from_names.end(); ++name_it)
-            {
-              std::string const & name = *name_it;
+          if( to_handle.is_null())
+            continue;
 
-              if( exist_attribute( name, 0u))
-              {
-                T const val = from_attributes.get_attribute_value( name, from, label);
+          for (unsigned int i = 0u; i < from_labels.size(); ++i)
+          {
+            unsigned int const label     = from_labels[i];
+            unsigned int const from_slot = from_attributes.m_simplex0_real_attributes.slot( from, label);
+            unsigned int const to_slot   = m_simplex0_real_attributes.slot( to, label);
 
-                set_attribute_value( name, to, label, val);
-              }
-            }
+            m_simplex0_real_attributes.value( to_handle.index(), to_slot)
+              = from_attributes.m_simplex0_real_attributes.value( n, from_slot);
           }
         }
-        else
-        {
-          //--- Labels have to be initialized for every vertex, needed to avoid SegFaults
-          m_simplex0_labels[to].clear();
-        }
       }
 
 
@@ -602,16 +772,19 @@ namespace grit
                                  , Attributes<types> const & from_attributes
                                  )
       {
-        name_iterator name_it = from_attributes.simplex1_attribute_names().begin();
-        for ( ; name_it != from_attributes.simplex1_attribute_names().end(); ++name_it)
+        name_vector const & from_names = from_attributes.simplex1_attribute_names();
+
+        for (unsigned int n = 0u; n < from_names.size(); ++n)
         {
-          std::string const & name = *name_it;
-          if( exist_attribute( name, 1u))
+          AttributeHandle const to_handle   = get_attribute_handle( from_names[n], 1u);
+          AttributeHandle const from_handle = AttributeHandle( 1u, n);
+
+          if( !to_handle.is_null())
           {
-            if( from_attributes.exist_attribute_value( name, from))
+            if( from_attributes.exist_attribute_value( from_handle, from))
             {
-              T const val = from_attributes.get_attribute_value( name, from);
-              set_attribute_value( name, to, val);
+              T const val = from_attributes.get_attribute_value( from_handle, from);
+              set_attribute_value( to_handle, to, val);
             }
           }
         }
@@ -623,16 +796,19 @@ namespace grit
                                  , Attributes<types> const & from_attributes
                                  )
       {
-        name_iterator name_it = from_attributes.simplex2_attribute_names().begin();
-        for ( ; name_it != from_attributes.simplex2_attribute_names().end(); ++name_it)
+        name_vector const & from_names = from_attributes.simplex2_attribute_names();
+
+        for (unsigned int n = 0u; n < from_names.size(); ++n)
         {
-          std::string const & name = *name_it;
-          if( exist_attribute( name, 2u))
+          AttributeHandle const to_handle   = get_attribute_handle( from_names[n], 2u);
+          AttributeHandle const from_handle = AttributeHandle( 2u, n);
+
+          if( !to_handle.is_null())
           {
-            if( from_attributes.exist_attribute_value( name, from))
+            if( from_attributes.exist_attribute_value( from_handle, from))
             {
-              T const val = from_attributes.get_attribute_value( name, from);
-              set_attribute_value( name, to, val);
+              T const val = from_attributes.get_attribute_value( from_handle, from);
+              set_attribute_value( to_handle, to, val);
             }
           }
         }
@@ -642,14 +818,7 @@ namespace grit
 
       void clear( Simplex0 const s)
       {
-        m_simplex0_labels[s].clear();
-
-        name_iterator name_it = m_simplex0_attribute_names.begin();
-        for( ; name_it != m_simplex0_attribute_names.end(); ++name_it)
-        {
-          std::string const & name = *name_it;
-          m_simplex0_real_attributes[name][s].clear();
-        }
+        m_simplex0_real_attributes.clear(s);
       }
 
       void remove( SimplexSet const & S)
@@ -659,25 +828,16 @@ namespace grit
           Simplex0 const & s = *it;
           // 2016-01-18 Marek: this is unnecessary and sometimes gets in the way
           //m_current[s] = V( VT::zero());
-          m_simplex0_labels[s].clear();
-
-          name_iterator name_it = m_simplex0_attribute_names.begin();
-          for ( ; name_it != m_simplex0_attribute_names.end(); ++name_it)
-          {
-            std::string const & name = *name_it;
-            m_simplex0_real_attributes[name][s].clear();
-          }
+          m_simplex0_real_attributes.release(s);
         }
 
         for( SimplexSet::simplex1_const_iterator it = S.begin1(); it != S.end1(); ++it)
         {
           Simplex1 const & s = *it;
 
-          name_iterator name_it = m_simplex1_attribute_names.begin();
-          for ( ; name_it != m_simplex1_attribute_names.end(); ++name_it)
+          for( unsigned int n = 0u; n < m_simplex1_real_attributes.size(); ++n)
           {
-            std::string const & name = *name_it;
-            m_simplex1_real_attributes[name].erase(s);
+            m_simplex1_real_attributes[n].erase(s);
           }
         }
 
@@ -685,11 +845,9 @@ namespace grit
         {
           Simplex2 const & s = *it;
 
-          name_iterator name_it = m_simplex2_attribute_names.begin();
-          for ( ; name_it != m_simplex2_attribute_names.end(); ++name_it)
+          for( unsigned int n = 0u; n < m_simplex2_real_attributes.size(); ++n)
           {
-            std::string const & name = *name_it;
-            m_simplex2_real_attributes[name].erase(s);
+            m_simplex2_real_attributes[n].erase(s);
           }
         }
       }
@@ -710,14 +868,9 @@ namespace grit
           //                   vertices passed through new_simplices (VertexSplit does that),
           //                   if they already exist. I guess it's not a very pretty solution,
           //                   and we should use parent_lut for Simplex0 too.
-          if( m_simplex0_labels[s].size() == 0u)
+          if( m_simplex0_real_attributes.labels(s).empty())
           {
-            name_iterator name_it = m_simplex0_attribute_names.begin();
-            for ( ; name_it != m_simplex0_attribute_names.end(); ++name_it)
-            {
-              std::string const & name = *name_it;
-              m_simplex0_real_attributes[name][s].clear();
-            }
+            m_simplex0_real_attributes.clear(s);
           }
         }
       }
@@ -3,6 +3,7 @@
 
 #include <grit_quality_analyzer.h>
 #include <grit_do_operations.h>
+#include <grit_mesh_regions.h>
 
 #include <util_profiling.h>
 #include <util_log.h>
@@ -25,6 +26,10 @@ namespace grit
      * @tparam Operation       implements InterfaceMeshOperation<S>
      * @tparam Assignment      implements InterfaceAttributeAssignment<S>
      * @tparam types           type binder
+     *
+     * @param region           If not empty, the batch only works on the simplices
+     *                         of this region, and holds the lock of the regions
+     *                         whenever it touches the mesh or the attributes.
      */
     template<
               typename S
@@ -40,7 +45,8 @@ namespace grit
                               , LogicExpression<E>                     const & condition
                               , typename types::param_type             const & parameters
                               , typename types::attributes_type              & attributes
-                              , InterfaceMesh                                & mesh
+                              , typename types::mesh_impl                    & mesh
+                              , details::InRegion                      const & region = details::InRegion()
                               )
     {
       util::Log log;
@@ -63,13 +69,17 @@ namespace grit
 
         for (unsigned int iteration=0u; iteration< max_iterations; ++iteration)
         {
-          SimplexSet         const A         = compute_phase( mesh, label);
+          RegionLock               setup( region);
+
+          SimplexSet         const A         = region.is_null() ? compute_phase( mesh, label) : filter( compute_phase( mesh, label), region);
           Measure            const measure   = Measure( operation_name, label, parameters, mesh, attributes);
           QualityAnalyzer<S>       analyzer  = QualityAnalyzer<S>( A, measure);
           Operation                operation = Operation( operation_name, label, parameters);
           Assignment         const assign    = Assignment();
 
-          operations_done += do_operations( mesh, analyzer, operation, condition, assign, parameters, attributes );
+          setup.release();
+
+          operations_done += do_operations( mesh, analyzer, operation, condition, assign, parameters, attributes, region );
         }
 
       }
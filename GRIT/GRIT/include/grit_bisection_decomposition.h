@@ -0,0 +1,321 @@
+#ifndef GRIT_BISECTION_DECOMPOSITION_H
+#define GRIT_BISECTION_DECOMPOSITION_H
+
+#include <grit_simplex.h>
+#include <grit_simplex_set.h>
+#include <grit_logic_expressions.h>
+#include <grit_slab_decomposition.h>
+
+#include <vector>
+#include <cmath>
+#include <cassert>
+#include <algorithm>  // Needed for std::sort
+#include <utility>    // Needed for std::pair
+
+namespace grit
+{
+
+  namespace details
+  {
+
+    /**
+     * Helper function for recursive_bisection(...). Splits the points in
+     * [begin,end) into number_of_parts parts, numbered from first_part.
+     */
+    template<typename T>
+    inline void recursive_bisection(
+                                    std::vector<T>                   const & x
+                                    , std::vector<T>                 const & y
+                                    , std::vector<T>                 const & weights
+                                    , unsigned int                   const & number_of_parts
+                                    , unsigned int                   const & first_part
+                                    , bool                           const & inertial
+                                    , bool                           const & rotated
+                                    , std::vector<unsigned int>            & indices
+                                    , size_t                         const & begin
+                                    , size_t                         const & end
+                                    , std::vector<unsigned int>            & parts
+                                    )
+    {
+      if (number_of_parts == 1u)
+      {
+        for (size_t i = begin; i < end; ++i)
+          parts[ indices[i] ] = first_part;
+
+        return;
+      }
+
+      //--- Choose the cut direction
+      T const quarter_turn = std::atan(T(1.0));  // pi/4
+
+      T angle = T(0.0);
+
+      if (inertial)
+      {
+        T total = T(0.0);
+        T cx    = T(0.0);
+        T cy    = T(0.0);
+
+        for (size_t i = begin; i < end; ++i)
+        {
+          unsigned int const k = indices[i];
+
+          total += weights[k];
+          cx    += weights[k] * x[k];
+          cy    += weights[k] * y[k];
+        }
+
+        cx /= total;
+        cy /= total;
+
+        T cxx = T(0.0);
+        T cxy = T(0.0);
+        T cyy = T(0.0);
+
+        for (size_t i = begin; i < end; ++i)
+        {
+          unsigned int const k = indices[i];
+
+          T const dx = x[k] - cx;
+          T const dy = y[k] - cy;
+
+          cxx += weights[k] * dx * dx;
+          cxy += weights[k] * dx * dy;
+          cyy += weights[k] * dy * dy;
+        }
+
+        // The principal axis, along which the points are spread the most
+        angle = T(0.5) * std::atan2( T(2.0) * cxy, cxx - cyy );
+
+        if (rotated)
+          angle += quarter_turn;
+      }
+      else
+      {
+        // Cut along the coordinate axis (or diagonal when rotated) with the
+        // largest extent
+        T const first_angle = rotated ? quarter_turn : T(0.0);
+
+        T extent[2];
+
+        for (unsigned int a = 0u; a < 2u; ++a)
+        {
+          T const ux = std::cos( first_angle + a * T(2.0) * quarter_turn );
+          T const uy = std::sin( first_angle + a * T(2.0) * quarter_turn );
+
+          T lower = ux * x[ indices[begin] ] + uy * y[ indices[begin] ];
+          T upper = lower;
+
+          for (size_t i = begin; i < end; ++i)
+          {
+            T const d = ux * x[ indices[i] ] + uy * y[ indices[i] ];
+
+            lower = std::min(lower, d);
+            upper = std::max(upper, d);
+          }
+
+          extent[a] = upper - lower;
+        }
+
+        angle = first_angle + (extent[1] > extent[0] ? T(2.0) * quarter_turn : T(0.0));
+      }
+
+      T const ux = std::cos(angle);
+      T const uy = std::sin(angle);
+
+      //--- Sort the points along the cut direction
+      std::vector< std::pair<T, unsigned int> > order;
+
+      order.reserve(end - begin);
+
+      for (size_t i = begin; i < end; ++i)
+        order.push_back( std::make_pair( ux * x[ indices[i] ] + uy * y[ indices[i] ], indices[i] ) );
+
+      std::sort( order.begin(), order.end() );
+
+      for (size_t i = begin; i < end; ++i)
+        indices[i] = order[i - begin].second;
+
+      //--- Cut where the weight on each side matches its number of parts
+      unsigned int const left_parts  = number_of_parts / 2u;
+      unsigned int const right_parts = number_of_parts - left_parts;
+
+      T total = T(0.0);
+
+      for (size_t i = begin; i < end; ++i)
+        total += weights[ indices[i] ];
+
+      T const target = total * left_parts / number_of_parts;
+
+      size_t middle = begin;
+      T      left   = T(0.0);
+
+      while (middle < end && left + T(0.5) * weights[ indices[middle] ] < target)
+      {
+        left += weights[ indices[middle] ];
+        ++middle;
+      }
+
+      // Every part gets at least one point
+      middle = std::max( middle, begin + left_parts );
+      middle = std::min( middle, end - right_parts );
+
+      recursive_bisection( x, y, weights, left_parts,  first_part,              inertial, rotated, indices, begin,  middle, parts);
+      recursive_bisection( x, y, weights, right_parts, first_part + left_parts, inertial, rotated, indices, middle, end,    parts);
+    }
+
+    /**
+     * Recursive Bisection.
+     * Splits a set of weighted points into parts of about equal weight.
+     * The points are cut in two along a straight line, the two halves are
+     * cut again, and so on until there are number_of_parts parts. An odd
+     * number of parts is split into two uneven halves.
+     *
+     * Coordinate bisection cuts across the coordinate axis along which the
+     * points have the largest extent. Inertial bisection cuts across the
+     * principal axis of the points, which gives shorter cuts when the
+     * points form a long shape that is not aligned with the axes.
+     *
+     * @param x                 The 0-coordinates of the points.
+     * @param y                 The 1-coordinates of the points.
+     * @param weights           The positive weight of each point.
+     * @param number_of_parts   The number of parts, at most the number of points.
+     * @param inertial          If true the points are cut across their principal axis.
+     * @param rotated           If true all cut directions are turned by 45
+     *                          degrees, which moves the cuts away from the
+     *                          cuts made without rotation.
+     * @param parts             Upon return, the part of each point.
+     */
+    template<typename T>
+    inline void recursive_bisection(
+                                    std::vector<T>                   const & x
+                                    , std::vector<T>                 const & y
+                                    , std::vector<T>                 const & weights
+                                    , unsigned int                   const & number_of_parts
+                                    , bool                           const & inertial
+                                    , bool                           const & rotated
+                                    , std::vector<unsigned int>            & parts
+                                    )
+    {
+      assert(x.size() == y.size()       || !"recursive_bisection(): Coordinate sizes differ");
+      assert(x.size() == weights.size() || !"recursive_bisection(): Weight size differs");
+      assert(number_of_parts > 0u       || !"recursive_bisection(): No parts");
+      assert(number_of_parts <= x.size() || !"recursive_bisection(): More parts than points");
+
+      std::vector<unsigned int> indices( x.size() );
+
+      for (size_t i = 0u; i < indices.size(); ++i)
+        indices[i] = i;
+
+      parts.resize( x.size() );
+
+      recursive_bisection( x, y, weights, number_of_parts, 0u, inertial, rotated, indices, 0u, indices.size(), parts);
+    }
+
+    /**
+     * Computes the centroid of each triangle in @triangles.
+     */
+    template<typename types>
+    inline void compute_centroids(
+                                  std::vector<Simplex2>                      const & triangles
+                                  , typename types::attributes_type          const & attributes
+                                  , std::vector<typename types::real_type>         & x
+                                  , std::vector<typename types::real_type>         & y
+                                  )
+    {
+      typedef typename types::vector3_type  V;
+      typedef typename types::real_type     T;
+
+      x.resize( triangles.size() );
+      y.resize( triangles.size() );
+
+      for (size_t i = 0u; i < triangles.size(); ++i)
+      {
+        V const & p0 = attributes.get_current_value( triangles[i].get_simplex0_idx0() );
+        V const & p1 = attributes.get_current_value( triangles[i].get_simplex0_idx1() );
+        V const & p2 = attributes.get_current_value( triangles[i].get_simplex0_idx2() );
+
+        x[i] = (p0[0] + p1[0] + p2[0]) / T(3.0);
+        y[i] = (p0[1] + p1[1] + p2[1]) / T(3.0);
+      }
+    }
+
+    /*! Implementation of recursive bisection decomposition.
+     *
+     * The triangles are split by recursive coordinate bisection of their
+     * centroids, or by recursive inertial bisection when
+     * parameters.inertial_bisection() is true. The centroids are weighted by
+     * the estimated work of their triangles. Unlike slabs, the subdomains
+     * stay compact when there are many of them, so fewer vertices are frozen
+     * on submesh boundaries. Every second call all cut directions are turned
+     * by 45 degrees, so vertices frozen on a cut are processed in the next
+     * scheduler iteration.
+     */
+    template <typename types>
+    class BisectionDecomposition
+    : public SlabDecomposition<types>
+    {
+    public:
+
+      typedef typename types::mesh_impl               MI;
+      typedef typename types::attributes_type         AT;
+      typedef typename types::param_type              PT;
+
+      typedef typename types::real_type               T;
+
+    protected:
+
+      bool m_is_black;   ///< Whether the next call uses unturned cuts.
+
+    public:
+
+      BisectionDecomposition()
+      : m_is_black(true)
+      {}
+
+    protected:
+
+      void partition(
+                     PT                                     const & parameters
+                     , MI                                   const & mesh
+                     , AT                                   const & attributes
+                     , std::vector< std::vector<Simplex2> >       & parts
+                     )
+      {
+        unsigned int const number_of_subdomains = parameters.number_of_subdomains();
+
+        SimplexSet const simplex_set = filter(mesh.get_all_simplices(), IsDimension(mesh,2));
+
+        std::vector<Simplex2> triangles( simplex_set.begin2(), simplex_set.end2() );
+
+        assert(triangles.size() >= number_of_subdomains || !"BisectionDecomposition::partition(): Fewer triangles than subdomains");
+
+        std::vector<T> x;
+        std::vector<T> y;
+
+        compute_centroids<types>(triangles, attributes, x, y);
+
+        std::vector<T> weights;
+
+        this->compute_work(parameters, mesh, triangles, weights);
+
+        std::vector<unsigned int> part;
+
+        recursive_bisection( x, y, weights, number_of_subdomains, parameters.inertial_bisection(), !m_is_black, part);
+
+        parts.resize( number_of_subdomains );
+
+        for (size_t i = 0u; i < triangles.size(); ++i)
+          parts[ part[i] ].push_back( triangles[i] );
+
+        m_is_black = !m_is_black;
+      }
+
+    }; // class BisectionDecomposition
+
+  } // namespace details
+
+} // namespace grit
+
+// GRIT_BISECTION_DECOMPOSITION_H
+#endif
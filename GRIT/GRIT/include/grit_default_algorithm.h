@@ -58,6 +58,8 @@ namespace grit
 
       typedef          std::vector<unsigned int>  LV; //!< labels vector
 
+      typedef          BasicIsInterface<MI>       IsInterface;
+
     public:
 
       /**
@@ -69,6 +71,9 @@ namespace grit
        * 4) move all vertices as far as possible without inverting any triangles.
        * 5) perform merge (if needed) and coarsen the mesh.
        * 6) improve mesh with smoothing, interface smoothing and edge flips.
+       *
+       * If region() is not empty, other algorithms run on the same mesh at
+       * the same time, and this one only changes the simplices of its region.
        */
       unsigned int run(
                        MI         & mesh
@@ -102,6 +107,7 @@ namespace grit
                                      , parameters
                                      , attributes
                                      , mesh
+                                     , base_class::region()
                                      );
 
           operations_done += batch<
@@ -118,6 +124,7 @@ namespace grit
                                      , parameters
                                      , attributes
                                      , mesh
+                                     , base_class::region()
                                      );
 
           operations_done += batch<
@@ -134,19 +141,28 @@ namespace grit
                                      , parameters
                                      , attributes
                                      , mesh
+                                     , base_class::region()
                                      );
         }
 
-        MoveMonitor<types> monitor( mesh, attributes, parameters);
+        RegionLock monitor_setup( base_class::region());
+
+        MoveMonitor<types> monitor( mesh, attributes, parameters, base_class::region());
         monitor.init(parameters);
 
+        monitor_setup.release();
+
         //--- Main loop: mesh improvement using smoothing, interface smoothing and edge flips,
         //--- and moving the vertices towards their final positions.
         do
         {
           operations_done += mesh_improvement( mesh, attributes, parameters, labels);
 
-          monitor.update();
+          {
+            RegionLock const lock( base_class::region());
+
+            monitor.update();
+          }
 
           operations_done += batch<
                                     Simplex0
@@ -162,6 +178,7 @@ namespace grit
                                     , parameters
                                     , attributes
                                     , mesh
+                                    , base_class::region()
                                     );
 
           operations_done += mesh_improvement( mesh, attributes, parameters, labels);
@@ -185,6 +202,7 @@ namespace grit
                                      , parameters
                                      , attributes
                                      , mesh
+                                     , base_class::region()
                                      );
         operations_done += batch<
                                  Simplex0
@@ -200,6 +218,7 @@ namespace grit
                                    , parameters
                                    , attributes
                                    , mesh
+                                   , base_class::region()
                                    );
 
           operations_done += batch<
@@ -217,6 +236,7 @@ namespace grit
                                     , parameters
                                     , attributes
                                     , mesh
+                                    , base_class::region()
                                     );
 
           operations_done += batch<
@@ -233,6 +253,7 @@ namespace grit
                                      , parameters
                                      , attributes
                                      , mesh
+                                     , base_class::region()
                                      );
 
           operations_done += batch<
@@ -249,6 +270,7 @@ namespace grit
                                      , parameters
                                      , attributes
                                      , mesh
+                                     , base_class::region()
                                      );
 
           if( parameters.no_ears() )
@@ -267,6 +289,7 @@ namespace grit
                                        , parameters
                                        , attributes
                                        , mesh
+                                       , base_class::region()
                                        );
           }
         }
@@ -307,6 +330,7 @@ namespace grit
                                    , parameters
                                    , attributes
                                    , mesh
+                                   , base_class::region()
                                    );
 
         operations_done += batch<
@@ -323,6 +347,7 @@ namespace grit
                                    , parameters
                                    , attributes
                                    , mesh
+                                   , base_class::region()
                                    );
 
         operations_done += batch<
@@ -339,6 +364,7 @@ namespace grit
                                    , parameters
                                    , attributes
                                    , mesh
+                                   , base_class::region()
                                    );
 
         return operations_done;
@@ -5,16 +5,22 @@
 
 #include <grit_default_algorithm.h>
 #include <grit_attribute_vector.h>
+#include <grit_simplex0_multi_attribute_table.h>
 #include <grit_pthread_scheduler.h>
 #include <grit_domain_manager.h>
 #include <grit_subdomain.h>
 #include <grit_slab_decomposition.h>
+#include <grit_bisection_decomposition.h>
+#include <grit_graph_decomposition.h>
 #include <grit_interface_monitor.h>
 #include <grit_default_algorithm.h>
 #include <grit_attribute_manager.h>
 
 #include <grit_opentissue_mesh.h>
 #include <grit_opentissue_math_types.h>
+#include <grit_vector2_math_types.h>
+#include <grit_polymesh_list_kernel.h>
+#include <grit_polymesh_vector_kernel.h>
 
 #include <monitors/grit_count_monitor.h>
 
@@ -44,6 +50,9 @@ namespace grit
   , template< typename > class domain_decomposition_class
   , template< typename > class monitor_class
   , template< typename > class algorithm_class
+  , template< typename, typename, typename, typename > class mesh_kernel_class = PolyMeshListKernel
+  , template< typename > class math_types_class = OpenTissueMathTypes
+  , typename real_value_type = double
   >
   class GRITTypes
   {
@@ -58,15 +67,34 @@ namespace grit
             , domain_decomposition_class
             , monitor_class
             , algorithm_class
+            , mesh_kernel_class
+            , math_types_class
+            , real_value_type
             >  types;
 
-    typedef OpenTissue::polymesh::PolyMesh<>                 mesh_type;
+    typedef OpenTissue::math::BasicMathTypes<
+              real_value_type
+            , size_t
+            >                                                mesh_math_types;   ///< real_value_type is double, or float in single precision builds.
 
-    typedef OpenTissueMesh<mesh_type>                        mesh_impl;
-    typedef OpenTissueMathTypes<mesh_type>                   math_types;
+    typedef OpenTissue::polymesh::PolyMesh<
+              mesh_math_types
+            , OpenTissue::mesh::DefaultVertexTraits<mesh_math_types>
+            , OpenTissue::mesh::DefaultHalfEdgeTraits
+            , OpenTissue::mesh::DefaultEdgeTraits
+            , OpenTissue::mesh::DefaultFaceTraits
+            , OpenTissue::mesh::DefaultMeshTraits
+            , mesh_kernel_class
+            >                                                mesh_type;
 
-    typedef math_types::vector3_type                         vector3_type;
-    typedef math_types::real_type                            real_type;
+    typedef Simplex::index_type                              index_type;
+
+    typedef math_types_class<mesh_type>                      math_types;
+
+    typedef typename math_types::vector3_type                vector3_type;    ///< The coordinate type, it may have 2 or 3 components.
+    typedef typename math_types::real_type                   real_type;
+
+    typedef OpenTissueMesh<mesh_type, vector3_type>          mesh_impl;
 
   public:
 
@@ -76,7 +104,7 @@ namespace grit
     //typedef Simplex1MultiAttributeVector<vector3_type>        sim1_attributes_v3_type;
     typedef Simplex2AttributeVector<vector3_type>            sim2_attributes_v3_type;
 
-    typedef Simplex0MultiAttributeVector<real_type>          sim0_attributes_real_type;
+    typedef Simplex0MultiAttributeTable<real_type>           sim0_attributes_real_type;
     // 2016-01-11 Marek: should we use a multiphase attribute with edges, or single phase?
     typedef Simplex1AttributeVector<real_type>               sim1_attributes_real_type;
     typedef Simplex2AttributeVector<real_type>               sim2_attributes_real_type;
@@ -105,9 +133,30 @@ namespace grit
   , details::AttributeManager
   , details::DomainManager
   , details::SubDomain
+#if defined(GRIT_USE_GRAPH_DECOMPOSITION)
+  , details::GraphDecomposition
+#elif defined(GRIT_USE_BISECTION_DECOMPOSITION)
+  , details::BisectionDecomposition
+#else
   , details::SlabDecomposition
+#endif
   , details::CountMonitor
   , details::DefaultAlgorithm
+#ifdef GRIT_USE_VECTOR_MESH_KERNEL
+  , PolyMeshVectorKernel
+#else
+  , PolyMeshListKernel
+#endif
+#ifdef GRIT_USE_VECTOR2_COORDINATES
+  , Vector2MathTypes
+#else
+  , OpenTissueMathTypes
+#endif
+#ifdef GRIT_USE_SINGLE_PRECISION
+  , float
+#else
+  , double
+#endif
   >  default_grit_types;
 
   typedef default_grit_types::math_types  math_types;
@@ -8,15 +8,17 @@
 
 #include <grit_simplex.h>
 #include <grit_simplex_set.h>
+#include <grit_simplex_lut.h>
 #include <grit_quality_analyzer.h>
 #include <grit_logic_expressions.h>
 #include <grit_attributes.h>
+#include <grit_mesh_regions.h>
 
 #include <utilities/grit_debug_render.h>
 
 #include <util_log.h>
+#include <util_arena.h>
 
-#include <map>
 
 namespace grit
 {
@@ -29,26 +31,47 @@ namespace grit
       , typename types
     >
     inline unsigned int do_operations(
-                                      InterfaceMesh                        & mesh
+                                      typename types::mesh_impl            & mesh
                                       , QualityAnalyzer<S>                 & analyzer
                                       , InterfaceMeshOperation<S,types>    & operation
                                       , LogicExpression<E>           const & condition
                                       , InterfaceAttributeAssignment<types>   const & assign
                                       , typename types::param_type   const & parameters
                                       , Attributes<types>                  & attributes
+                                      , InRegion                     const & region = InRegion()
     )
     {
       typedef AttributeManager<types>  attribute_manager;
 
       unsigned int operations_done = 0u;
 
-      operation.init(mesh,attributes);   // Make sure any global initialization has occured if needed
+      {
+        RegionLock const lock(region);
+
+        operation.init(mesh,attributes);   // Make sure any global initialization has occured if needed
+      }
+
+      // The temporaries of a single operation are drawn from storage that
+      // is reused by all operations: the parent lookup tables allocate from
+      // an arena that is reset before each operation, and the simplex sets
+      // are cleared rather than recreated so they keep their capacity.
+      util::MonotonicArena arena;
+
+      SimplexSet new_simplices;
+      SimplexSet old_simplices;     // Does not exist in old design, might be needed to clean up AttributeVectors?
 
       while (analyzer.has_next())
       {
+        // Other regions may change the mesh between two operations, but
+        // never while this one is done
+        RegionLock const lock(region);
+
         S const s = analyzer.pop();
 
-        if (! IsValid(mesh)(s) )   // Make sure isValid is tested or we might run the risk of working on non-existing s
+        if (! mesh.is_valid_simplex(s) )   // Make sure isValid is tested or we might run the risk of working on non-existing s
+          continue;
+
+        if (! region(s))   // The slot of a removed vertex may have been reused by another region
           continue;
 
         if (! condition(s))
@@ -59,8 +82,8 @@ namespace grit
           debug_render( s, mesh, parameters, attributes);
         }
 
-        SimplexSet new_simplices;
-        SimplexSet old_simplices;     // Does not exist in old design, might be needed to clean up AttributeVectors?
+        new_simplices.clear();
+        old_simplices.clear();
 
         // 2015-11-08 Kenny: If coordinates are attributes then there is really no
         //                   need to do a "mesh operation"... This more like a AttributeUpdate
@@ -74,8 +97,10 @@ namespace grit
           continue;
         }
 
-        std::map<Simplex1, Simplex1> simplex1_lut;   // Lookup table of parenting info, if it exist
-        std::map<Simplex2, Simplex2> simplex2_lut;   // Lookup table of parenting info, if it exist
+        arena.reset();   // The lookup tables of the previous operation are gone by now
+
+        Simplex1LUT simplex1_lut = SimplexLUTTypes<Simplex1>::make(arena);   // Lookup table of parenting info, if it exist
+        Simplex2LUT simplex2_lut = SimplexLUTTypes<Simplex2>::make(arena);   // Lookup table of parenting info, if it exist
 
         if (! operation.plan_local_connectivity_changes(s, mesh, attributes, new_simplices, old_simplices, simplex1_lut, simplex2_lut))
           continue;
@@ -88,6 +113,8 @@ namespace grit
 
         attribute_manager::remove( old_simplices, attributes);
 
+        region.take( new_simplices);
+
         ++operations_done;
       }
 
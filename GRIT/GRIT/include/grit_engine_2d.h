@@ -2,6 +2,7 @@
 #define GRIT_ENGINE_2D_H
 
 #include <grit_default_types.h>
+#include <utilities/grit_compact.h>
 
 #include <string>
 #include <vector>
@@ -61,6 +62,21 @@ namespace grit
         m_scheduler.run(parameters);
       }
 
+      /**
+       * Renumbers the vertices and triangles of the mesh in Morton order of
+       * their coordinates, and remaps all attributes and labels. This keeps
+       * attribute storage proportional to the mesh size and nearby simplices
+       * close in memory, so long simulations should call it every now and
+       * then between updates.
+       *
+       * All Simplex0, Simplex1 and Simplex2 values held by the caller are
+       * invalid after compacting. Attribute handles stay valid.
+       */
+      void compact()
+      {
+        details::compact<types>( mesh(), attributes() );
+      }
+
       // 2015-09-28 Marek: Have to think how to configure default remeshing parameters (per phase)
       // 2015-03-13 Marek: I don't think that make_default_parameters() is something that we can
       //                   make sensibly in a short amount of time, I'd say we should ditch it for now.
@@ -0,0 +1,626 @@
+#ifndef GRIT_GRAPH_DECOMPOSITION_H
+#define GRIT_GRAPH_DECOMPOSITION_H
+
+#include <grit_simplex.h>
+#include <grit_simplex_set.h>
+#include <grit_logic_expressions.h>
+#include <grit_slab_decomposition.h>
+#include <grit_bisection_decomposition.h>
+
+#include <vector>
+#include <limits>
+#include <cassert>
+#include <algorithm>  // Needed for std::sort
+#include <utility>    // Needed for std::pair
+
+namespace grit
+{
+
+  namespace details
+  {
+
+    /**
+     * A weighted undirected graph in compressed row storage. The nodes have
+     * a weight and a position, the position is only used to find a first
+     * partition of the graph.
+     */
+    template<typename T>
+    class FaceGraph
+    {
+    public:
+
+      std::vector<unsigned int>  m_offsets;       ///< The neighbours of node i are at m_offsets[i] up to m_offsets[i+1].
+      std::vector<unsigned int>  m_neighbours;    ///< The neighbours of all nodes.
+      std::vector<T>             m_edge_weights;  ///< The weight of the edge to each neighbour.
+      std::vector<T>             m_weights;       ///< The weight of each node.
+      std::vector<T>             m_x;             ///< The 0-coordinate of each node.
+      std::vector<T>             m_y;             ///< The 1-coordinate of each node.
+
+    public:
+
+      size_t size() const { return m_weights.size(); }
+
+      T total_weight() const
+      {
+        T total = T(0.0);
+
+        for (size_t i = 0u; i < m_weights.size(); ++i)
+          total += m_weights[i];
+
+        return total;
+      }
+    };
+
+    /**
+     * Builds the dual graph of a triangle mesh. There is one node per
+     * triangle and an edge between two triangles when they share an edge.
+     *
+     * Graph edges have weight one, except where the shared mesh edge has a
+     * vertex in @frozen, those get weight @frozen_weight. Heavier edges are
+     * less likely to be cut, so the vertices in @frozen are kept inside the
+     * parts.
+     *
+     * @param frozen          Sorted vertices to keep away from the cut.
+     * @param frozen_weight   The weight of edges next to these vertices.
+     */
+    template<typename T>
+    inline void make_face_graph(
+                                std::vector<Simplex2>    const & triangles
+                                , std::vector<T>         const & x
+                                , std::vector<T>         const & y
+                                , std::vector<T>         const & weights
+                                , FaceGraph<T>                 & graph
+                                , std::vector<Simplex0>  const & frozen        = std::vector<Simplex0>()
+                                , T                      const & frozen_weight = T(1.0)
+                                )
+    {
+      typedef std::pair<Simplex1, unsigned int>  edge_type;
+      typedef std::pair<unsigned int, unsigned int>  node_pair_type;
+
+      std::vector<edge_type> edges;
+
+      edges.reserve( 3u*triangles.size() );
+
+      for (size_t i = 0u; i < triangles.size(); ++i)
+      {
+        Simplex0 const v0 = triangles[i].get_simplex0_idx0();
+        Simplex0 const v1 = triangles[i].get_simplex0_idx1();
+        Simplex0 const v2 = triangles[i].get_simplex0_idx2();
+
+        edges.push_back( edge_type( Simplex1(v0, v1), i ) );
+        edges.push_back( edge_type( Simplex1(v1, v2), i ) );
+        edges.push_back( edge_type( Simplex1(v2, v0), i ) );
+      }
+
+      std::sort( edges.begin(), edges.end() );
+
+      std::vector< std::pair<node_pair_type, T> > adjacent;
+
+      for (size_t i = 1u; i < edges.size(); ++i)
+      {
+        if (edges[i].first == edges[i-1u].first)
+        {
+          Simplex1 const & e = edges[i].first;
+
+          bool const is_frozen = std::binary_search( frozen.begin(), frozen.end(), e.get_simplex0_idx0() )
+                              || std::binary_search( frozen.begin(), frozen.end(), e.get_simplex0_idx1() );
+
+          T const weight = is_frozen ? frozen_weight : T(1.0);
+
+          adjacent.push_back( std::make_pair( node_pair_type( edges[i-1u].second, edges[i].second ), weight ) );
+          adjacent.push_back( std::make_pair( node_pair_type( edges[i].second, edges[i-1u].second ), weight ) );
+        }
+      }
+
+      std::sort( adjacent.begin(), adjacent.end() );
+
+      graph.m_offsets.assign( triangles.size() + 1u, 0u );
+      graph.m_neighbours.resize( adjacent.size() );
+      graph.m_edge_weights.resize( adjacent.size() );
+
+      for (size_t i = 0u; i < adjacent.size(); ++i)
+      {
+        ++graph.m_offsets[ adjacent[i].first.first + 1u ];
+
+        graph.m_neighbours[i]   = adjacent[i].first.second;
+        graph.m_edge_weights[i] = adjacent[i].second;
+      }
+
+      for (size_t i = 0u; i < triangles.size(); ++i)
+        graph.m_offsets[i + 1u] += graph.m_offsets[i];
+
+      graph.m_weights = weights;
+      graph.m_x       = x;
+      graph.m_y       = y;
+    }
+
+    /**
+     * Coarsens a graph by heavy edge matching. Each node is merged with the
+     * unmatched neighbour it has the heaviest edge to, unless the merged
+     * node would weigh more than max_node_weight.
+     *
+     * @param fine              The graph to coarsen.
+     * @param coarse            Upon return, the coarse graph.
+     * @param map               Upon return, the coarse node of each fine node.
+     * @param max_node_weight   The largest weight of a coarse node.
+     */
+    template<typename T>
+    inline void coarsen(
+                        FaceGraph<T>                   const & fine
+                        , FaceGraph<T>                       & coarse
+                        , std::vector<unsigned int>          & map
+                        , T                            const & max_node_weight
+                        )
+    {
+      unsigned int const UNSET = std::numeric_limits<unsigned int>::max();
+
+      size_t const n = fine.size();
+
+      //--- Match the nodes
+      map.assign( n, UNSET );
+
+      unsigned int m = 0u;
+
+      for (size_t u = 0u; u < n; ++u)
+      {
+        if (map[u] != UNSET)
+          continue;
+
+        unsigned int best        = u;
+        T            best_weight = T(0.0);
+
+        for (unsigned int j = fine.m_offsets[u]; j < fine.m_offsets[u + 1u]; ++j)
+        {
+          unsigned int const v = fine.m_neighbours[j];
+
+          if (map[v] == UNSET
+              && fine.m_edge_weights[j] > best_weight
+              && fine.m_weights[u] + fine.m_weights[v] <= max_node_weight)
+          {
+            best        = v;
+            best_weight = fine.m_edge_weights[j];
+          }
+        }
+
+        map[u]    = m;
+        map[best] = m;
+
+        ++m;
+      }
+
+      //--- Sum the weights and positions of the matched nodes
+      coarse.m_weights.assign( m, T(0.0) );
+      coarse.m_x.assign( m, T(0.0) );
+      coarse.m_y.assign( m, T(0.0) );
+
+      std::vector<unsigned int> member_offsets( m + 1u, 0u );
+
+      for (size_t u = 0u; u < n; ++u)
+      {
+        unsigned int const c = map[u];
+
+        coarse.m_weights[c] += fine.m_weights[u];
+        coarse.m_x[c]       += fine.m_weights[u] * fine.m_x[u];
+        coarse.m_y[c]       += fine.m_weights[u] * fine.m_y[u];
+
+        ++member_offsets[c + 1u];
+      }
+
+      for (unsigned int c = 0u; c < m; ++c)
+      {
+        coarse.m_x[c] /= coarse.m_weights[c];
+        coarse.m_y[c] /= coarse.m_weights[c];
+
+        member_offsets[c + 1u] += member_offsets[c];
+      }
+
+      std::vector<unsigned int> members( n );
+      std::vector<unsigned int> next( member_offsets.begin(), member_offsets.end() - 1u );
+
+      for (size_t u = 0u; u < n; ++u)
+        members[ next[ map[u] ]++ ] = u;
+
+      //--- Collapse the edges, parallel edges are merged into one edge
+      coarse.m_offsets.assign( m + 1u, 0u );
+      coarse.m_neighbours.clear();
+      coarse.m_edge_weights.clear();
+
+      std::vector<unsigned int> where( m, UNSET );
+
+      for (unsigned int c = 0u; c < m; ++c)
+      {
+        unsigned int const first = coarse.m_neighbours.size();
+
+        for (unsigned int k = member_offsets[c]; k < member_offsets[c + 1u]; ++k)
+        {
+          unsigned int const u = members[k];
+
+          for (unsigned int j = fine.m_offsets[u]; j < fine.m_offsets[u + 1u]; ++j)
+          {
+            unsigned int const d = map[ fine.m_neighbours[j] ];
+
+            if (d == c)
+              continue;
+
+            if (where[d] == UNSET)
+            {
+              where[d] = coarse.m_neighbours.size();
+
+              coarse.m_neighbours.push_back( d );
+              coarse.m_edge_weights.push_back( T(0.0) );
+            }
+
+            coarse.m_edge_weights[ where[d] ] += fine.m_edge_weights[j];
+          }
+        }
+
+        for (unsigned int j = first; j < coarse.m_neighbours.size(); ++j)
+          where[ coarse.m_neighbours[j] ] = UNSET;
+
+        coarse.m_offsets[c + 1u] = coarse.m_neighbours.size();
+      }
+    }
+
+    /**
+     * Improves a partition of a graph by moving nodes on the boundary of
+     * their part to a neighbouring part. A node is moved when this lowers
+     * the weight of the cut edges without making the parts heavier than
+     * max_part_weight or lighter than min_part_weight, or when the cut
+     * stays the same and the two parts become more even.
+     *
+     * @param graph             The graph.
+     * @param number_of_parts   The number of parts.
+     * @param max_passes        The largest number of sweeps over all nodes.
+     * @param parts             The part of each node, updated upon return.
+     */
+    template<typename T>
+    inline void refine(
+                       FaceGraph<T>                   const & graph
+                       , unsigned int                 const & number_of_parts
+                       , unsigned int                 const & max_passes
+                       , std::vector<unsigned int>          & parts
+                       )
+    {
+      T const imbalance = T(0.05);
+
+      std::vector<T>            part_weights( number_of_parts, T(0.0) );
+      std::vector<unsigned int> part_sizes( number_of_parts, 0u );
+
+      for (size_t u = 0u; u < graph.size(); ++u)
+      {
+        part_weights[ parts[u] ] += graph.m_weights[u];
+        part_sizes[ parts[u] ]   += 1u;
+      }
+
+      T const average         = graph.total_weight() / number_of_parts;
+      T const max_part_weight = (T(1.0) + imbalance) * average;
+      T const min_part_weight = (T(1.0) - imbalance) * average;
+
+      std::vector< std::pair<unsigned int, T> > connections;
+
+      for (unsigned int pass = 0u; pass < max_passes; ++pass)
+      {
+        unsigned int moves = 0u;
+
+        for (size_t u = 0u; u < graph.size(); ++u)
+        {
+          unsigned int const own    = parts[u];
+          T            const weight = graph.m_weights[u];
+
+          if (part_sizes[own] <= 1u)
+            continue;
+
+          //--- Sum the edge weights from u to each part
+          T internal = T(0.0);
+
+          connections.clear();
+
+          for (unsigned int j = graph.m_offsets[u]; j < graph.m_offsets[u + 1u]; ++j)
+          {
+            unsigned int const p = parts[ graph.m_neighbours[j] ];
+
+            if (p == own)
+            {
+              internal += graph.m_edge_weights[j];
+              continue;
+            }
+
+            size_t k = 0u;
+
+            while (k < connections.size() && connections[k].first != p)
+              ++k;
+
+            if (k == connections.size())
+              connections.push_back( std::make_pair( p, T(0.0) ) );
+
+            connections[k].second += graph.m_edge_weights[j];
+          }
+
+          //--- Pick the part with the largest gain, ties go to the lightest part
+          unsigned int best      = own;
+          T            best_gain = T(0.0);
+
+          for (size_t k = 0u; k < connections.size(); ++k)
+          {
+            unsigned int const p    = connections[k].first;
+            T            const gain = connections[k].second - internal;
+
+            if (best == own || gain > best_gain || (gain == best_gain && part_weights[p] < part_weights[best]))
+            {
+              best      = p;
+              best_gain = gain;
+            }
+          }
+
+          if (best == own)
+            continue;
+
+          bool const lowers_cut = best_gain > T(0.0)
+                               && part_weights[best] + weight <= max_part_weight
+                               && part_weights[own]  - weight >= min_part_weight;
+
+          bool const evens_out  = best_gain == T(0.0)
+                               && part_weights[best] + weight < part_weights[own];
+
+          if (!lowers_cut && !evens_out)
+            continue;
+
+          parts[u] = best;
+
+          part_weights[own]  -= weight;
+          part_weights[best] += weight;
+          part_sizes[own]    -= 1u;
+          part_sizes[best]   += 1u;
+
+          ++moves;
+        }
+
+        if (moves == 0u)
+          break;
+      }
+    }
+
+    /**
+     * Multilevel Graph Partitioning.
+     * Splits the nodes of a graph into parts of about equal weight, while
+     * keeping the weight of the edges between parts low.
+     *
+     * The graph is coarsened by heavy edge matching until it has a few
+     * nodes per part. The coarsest graph is split by recursive coordinate
+     * bisection of the node positions. The partition is then projected back
+     * through the levels, and refined on each level by moving boundary nodes
+     * between parts.
+     *
+     * @param graph             The graph.
+     * @param number_of_parts   The number of parts, at most the number of nodes.
+     * @param rotated           Passed on to recursive_bisection(...) for the
+     *                          first partition of the coarsest graph.
+     * @param parts             Upon return, the part of each node.
+     */
+    template<typename T>
+    inline void graph_partition(
+                                FaceGraph<T>                   const & graph
+                                , unsigned int                 const & number_of_parts
+                                , bool                         const & rotated
+                                , std::vector<unsigned int>          & parts
+                                )
+    {
+      assert(number_of_parts > 0u            || !"graph_partition(): No parts");
+      assert(number_of_parts <= graph.size() || !"graph_partition(): More parts than nodes");
+
+      unsigned int const passes          = 4u;
+      size_t       const coarsest_size   = 16u * number_of_parts;
+      T            const max_node_weight = graph.total_weight() / (8u * number_of_parts);
+
+      //--- Coarsen
+      std::vector< FaceGraph<T> >              levels(1u, graph);
+      std::vector< std::vector<unsigned int> > maps;
+
+      while (levels.back().size() > coarsest_size)
+      {
+        FaceGraph<T>              coarse;
+        std::vector<unsigned int> map;
+
+        coarsen( levels.back(), coarse, map, max_node_weight );
+
+        // Stop when hardly any nodes could be matched
+        if (20u * coarse.size() > 19u * levels.back().size())
+          break;
+
+        levels.push_back( coarse );
+        maps.push_back( map );
+      }
+
+      //--- Partition the coarsest graph
+      recursive_bisection( levels.back().m_x, levels.back().m_y, levels.back().m_weights, number_of_parts, false, rotated, parts);
+
+      refine( levels.back(), number_of_parts, passes, parts );
+
+      //--- Project the partition back and refine it on each level
+      for (size_t level = maps.size(); level > 0u; --level)
+      {
+        std::vector<unsigned int> const & map = maps[level - 1u];
+
+        std::vector<unsigned int> fine_parts( map.size() );
+
+        for (size_t u = 0u; u < map.size(); ++u)
+          fine_parts[u] = parts[ map[u] ];
+
+        parts.swap( fine_parts );
+
+        refine( levels[level - 1u], number_of_parts, passes, parts );
+      }
+    }
+
+    /*! Implementation of multilevel graph partition decomposition.
+     *
+     * The triangles are split by partitioning the graph of triangles that
+     * share an edge, see graph_partition(...). This keeps the number of
+     * edges between subdomains, and so the number of vertices frozen on
+     * submesh boundaries, low. The nodes are weighted by the estimated work
+     * of their triangles.
+     *
+     * Refinement alone would move the cuts back to the same lowest cut on
+     * every call, so vertices frozen on a submesh boundary would never be
+     * processed. The decomposition therefore remembers where the frozen
+     * vertices of the previous call are, and makes the graph edges next to
+     * them heavier. In addition, every second call the first partition of
+     * the coarsest graph is made with cuts turned by 45 degrees.
+     */
+    template <typename types>
+    class GraphDecomposition
+    : public SlabDecomposition<types>
+    {
+    public:
+
+      typedef typename types::mesh_impl               MI;
+      typedef typename types::attributes_type         AT;
+      typedef typename types::param_type              PT;
+
+      typedef typename types::real_type               T;
+      typedef typename types::vector3_type            V;
+
+      typedef std::pair<T, T>                         point_type;
+
+    protected:
+
+      bool                      m_is_black;   ///< Whether the next call uses unturned cuts.
+      std::vector<point_type>   m_frozen;     ///< Sorted positions of the vertices frozen by the previous call.
+
+    public:
+
+      GraphDecomposition()
+      : m_is_black(true)
+      {}
+
+    protected:
+
+      /**
+       * The weight of graph edges next to a vertex frozen by the previous
+       * call, the other edges have weight one.
+       */
+      static T frozen_weight() { return T(8.0); }
+
+      /**
+       * Finds the vertices of the mesh that were frozen by the previous
+       * call. Vertices are renumbered when the subdomains are merged, but
+       * frozen vertices do not move, so they are found by their position.
+       */
+      void find_frozen(
+                       MI                        const & mesh
+                       , AT                      const & attributes
+                       , std::vector<Simplex0>         & frozen
+                       ) const
+      {
+        frozen.clear();
+
+        if (m_frozen.empty())
+          return;
+
+        SimplexSet const vertices = filter(mesh.get_all_simplices(), IsDimension(mesh,0));
+
+        for (SimplexSet::simplex0_const_iterator it = vertices.begin0(); it != vertices.end0(); ++it)
+        {
+          V const & p = attributes.get_current_value(*it);
+
+          if (std::binary_search( m_frozen.begin(), m_frozen.end(), point_type( p[0], p[1] ) ))
+            frozen.push_back(*it);
+        }
+      }
+
+      /**
+       * Remembers the positions of the vertices shared by triangles in
+       * different parts, those are frozen on a submesh boundary.
+       */
+      void remember_frozen(
+                           std::vector<Simplex2>            const & triangles
+                           , std::vector<unsigned int>      const & part
+                           , AT                             const & attributes
+                           )
+      {
+        std::vector< std::pair<Simplex0, unsigned int> > corners;
+
+        corners.reserve( 3u*triangles.size() );
+
+        for (size_t i = 0u; i < triangles.size(); ++i)
+        {
+          corners.push_back( std::make_pair( triangles[i].get_simplex0_idx0(), part[i] ) );
+          corners.push_back( std::make_pair( triangles[i].get_simplex0_idx1(), part[i] ) );
+          corners.push_back( std::make_pair( triangles[i].get_simplex0_idx2(), part[i] ) );
+        }
+
+        std::sort( corners.begin(), corners.end() );
+        corners.erase( std::unique( corners.begin(), corners.end() ), corners.end() );
+
+        m_frozen.clear();
+
+        for (size_t i = 1u; i < corners.size(); ++i)
+        {
+          if (corners[i].first != corners[i-1u].first)
+            continue;
+
+          V const & p = attributes.get_current_value( corners[i].first );
+
+          m_frozen.push_back( point_type( p[0], p[1] ) );
+        }
+
+        std::sort( m_frozen.begin(), m_frozen.end() );
+        m_frozen.erase( std::unique( m_frozen.begin(), m_frozen.end() ), m_frozen.end() );
+      }
+
+    protected:
+
+      void partition(
+                     PT                                     const & parameters
+                     , MI                                   const & mesh
+                     , AT                                   const & attributes
+                     , std::vector< std::vector<Simplex2> >       & parts
+                     )
+      {
+        unsigned int const number_of_subdomains = parameters.number_of_subdomains();
+
+        SimplexSet const simplex_set = filter(mesh.get_all_simplices(), IsDimension(mesh,2));
+
+        std::vector<Simplex2> triangles( simplex_set.begin2(), simplex_set.end2() );
+
+        assert(triangles.size() >= number_of_subdomains || !"GraphDecomposition::partition(): Fewer triangles than subdomains");
+
+        std::vector<T> x;
+        std::vector<T> y;
+
+        compute_centroids<types>(triangles, attributes, x, y);
+
+        std::vector<T> weights;
+
+        this->compute_work(parameters, mesh, triangles, weights);
+
+        std::vector<Simplex0> frozen;
+
+        find_frozen( mesh, attributes, frozen );
+
+        FaceGraph<T> graph;
+
+        make_face_graph( triangles, x, y, weights, graph, frozen, frozen_weight() );
+
+        std::vector<unsigned int> part;
+
+        graph_partition( graph, number_of_subdomains, !m_is_black, part );
+
+        parts.resize( number_of_subdomains );
+
+        for (size_t i = 0u; i < triangles.size(); ++i)
+          parts[ part[i] ].push_back( triangles[i] );
+
+        remember_frozen( triangles, part, attributes );
+
+        m_is_black = !m_is_black;
+      }
+
+    }; // class GraphDecomposition
+
+  } // namespace details
+
+} // namespace grit
+
+// GRIT_GRAPH_DECOMPOSITION_H
+#endif
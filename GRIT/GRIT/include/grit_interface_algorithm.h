@@ -1,6 +1,8 @@
 #ifndef GRIT_INTERFACE_ALGORITHM_H
 #define GRIT_INTERFACE_ALGORITHM_H
 
+#include <grit_mesh_regions.h>
+
 #include <util_log.h>
 
 #include <vector>
@@ -21,15 +23,18 @@ namespace grit
 
     public:
 
-      unsigned int     m_id; ///< Identifier of the subdomain to which this Algorithm is assigned.
+      unsigned int     m_id;     ///< Identifier of the subdomain to which this Algorithm is assigned.
+      InRegion         m_region; ///< The part of a shared mesh this Algorithm may change, empty if it has the mesh to itself.
 
     public:
 
       unsigned int const & id()        const { return m_id; }
+      InRegion     const & region()    const { return m_region; }
 
     public:
 
       unsigned int       & id()              { return m_id; }
+      InRegion           & region()          { return m_region; }
 
     public:
 
@@ -3,9 +3,9 @@
 
 #include <grit_simplex.h>
 #include <grit_simplex_set.h>
+#include <grit_simplex_lut.h>
 #include <grit_interface_mesh.h>
 
-#include <map>
 
 // 2015-10-08 Marek: very important - remember to assing submesh_boundary values, if time allows, move it to attribute vector...
 
@@ -31,16 +31,17 @@ namespace grit
 
       typedef typename types::attributes_type       AT;
       typedef typename types::param_type            PT;
+      typedef typename types::mesh_impl             MI;
 
-      typedef          std::map<Simplex1,Simplex1>  simplex1_lut_type;
-      typedef          std::map<Simplex2,Simplex2>  simplex2_lut_type;
+      typedef          Simplex1LUT                  simplex1_lut_type;
+      typedef          Simplex2LUT                  simplex2_lut_type;
 
     public:
 
       virtual void operator()(
                               SimplexSet          const & new_simplices
                               , SimplexSet        const & old_simplices
-                              , InterfaceMesh     const & mesh
+                              , MI                const & mesh
                               , PT                const & parameters
                               , AT                      & attributes
                               , simplex1_lut_type const & simplex1_lut
@@ -1,6 +1,8 @@
 #ifndef GRIT_INTERFACE_DOMAIN_DECOMPOSITION_H
 #define GRIT_INTERFACE_DOMAIN_DECOMPOSITION_H
 
+#include <grit_mesh_regions.h>
+
 namespace grit
 {
 
@@ -9,7 +11,8 @@ namespace grit
     /**
      * An interface for domain decomposition classes, responsible for
      * creating subdomains for parallel processing from a global mesh,
-     * and merging them into a single mesh.
+     * and merging them into a single mesh, or for splitting the global
+     * mesh into regions for parallel processing in place.
      */
     template<typename types>
     class InterfaceDomainDecomposition
@@ -45,6 +48,19 @@ namespace grit
                                     , AMT               & attributes ///< global attribute manager
       ) = 0;
 
+      /**
+       * Splits @mesh into @parameters.number_of_subdomains regions, which
+       * algorithms work on in place, instead of creating subdomains. The
+       * vertices where regions meet are marked as submesh boundary, until
+       * @regions.release(mesh) is called.
+       */
+      virtual void create_regions(
+                                  PT          const & parameters ///< simulation parameters (for number_of_subdomains)
+                                  , MI              & mesh       ///< global mesh
+                                  , AMT       const & attributes ///< global attribute manager
+                                  , MeshRegions     & regions    ///< upon return, the owner of every vertex
+                                  ) = 0;
+
     }; // class InterfaceDomainDecomposition
 
   } // namespace details
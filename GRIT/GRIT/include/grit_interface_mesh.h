@@ -3,9 +3,11 @@
 
 #include <grit_simplex.h>
 #include <grit_simplex_set.h>
+#include <grit_simplex_lut.h>
 #include <grit_parameters.h>
 
-#include <map>
+#include <vector>
+
 
 namespace grit
 {
@@ -21,28 +23,65 @@ namespace grit
 
   public:
 
-    virtual SimplexSet boundary(Simplex0 const & s) const = 0;
-    virtual SimplexSet boundary(Simplex1 const & s) const = 0;
-    virtual SimplexSet boundary(Simplex2 const & s) const = 0;
+    /**
+     * Topology queries writing into a caller provided simplex set. The
+     * set is cleared first, so the same set can be reused for many
+     * queries. The storage of a reused set is kept, so in steady state
+     * these queries do not touch the heap.
+     */
+    virtual void boundary(Simplex0 const & s, SimplexSet & result) const = 0;
+    virtual void boundary(Simplex1 const & s, SimplexSet & result) const = 0;
+    virtual void boundary(Simplex2 const & s, SimplexSet & result) const = 0;
+
+    virtual void full_boundary(Simplex0 const & s, SimplexSet & result) const = 0;
+    virtual void full_boundary(Simplex1 const & s, SimplexSet & result) const = 0;
+    virtual void full_boundary(Simplex2 const & s, SimplexSet & result) const = 0;
+
+    virtual void star(Simplex0 const & s, SimplexSet & result) const = 0;
+    virtual void star(Simplex1 const & s, SimplexSet & result) const = 0;
+    virtual void star(Simplex2 const & s, SimplexSet & result) const = 0;
+    virtual void star(SimplexSet const & simplex_set, SimplexSet & result) const = 0;
+
+    virtual void closure(Simplex0 const & s, SimplexSet & result) const = 0;
+    virtual void closure(Simplex1 const & s, SimplexSet & result) const = 0;
+    virtual void closure(Simplex2 const & s, SimplexSet & result) const = 0;
+    virtual void closure(SimplexSet const & simplex_set, SimplexSet & result) const = 0;
 
-    virtual SimplexSet full_boundary(Simplex0 const & s) const = 0;
-    virtual SimplexSet full_boundary(Simplex1 const & s) const = 0;
-    virtual SimplexSet full_boundary(Simplex2 const & s) const = 0;
+    virtual void link(Simplex0 const & s, SimplexSet & result) const = 0;
 
-    virtual SimplexSet star(Simplex0 const & s) const = 0;
-    virtual SimplexSet star(Simplex1 const & s) const = 0;
-    virtual SimplexSet star(Simplex2 const & s) const = 0;
-    virtual SimplexSet star(SimplexSet const & simplex_set) const = 0;
+    SimplexSet boundary(Simplex0 const & s) const { SimplexSet result; boundary(s, result); return result; }
+    SimplexSet boundary(Simplex1 const & s) const { SimplexSet result; boundary(s, result); return result; }
+    SimplexSet boundary(Simplex2 const & s) const { SimplexSet result; boundary(s, result); return result; }
 
-    virtual SimplexSet closure(Simplex0 const & s) const = 0;
-    virtual SimplexSet closure(Simplex1 const & s) const = 0;
-    virtual SimplexSet closure(Simplex2 const & s) const = 0;
-    virtual SimplexSet closure(SimplexSet const & simplex_set) const = 0;
+    SimplexSet full_boundary(Simplex0 const & s) const { SimplexSet result; full_boundary(s, result); return result; }
+    SimplexSet full_boundary(Simplex1 const & s) const { SimplexSet result; full_boundary(s, result); return result; }
+    SimplexSet full_boundary(Simplex2 const & s) const { SimplexSet result; full_boundary(s, result); return result; }
 
-    virtual SimplexSet link(Simplex0 const & s) const = 0;
+    SimplexSet star(Simplex0 const & s) const { SimplexSet result; star(s, result); return result; }
+    SimplexSet star(Simplex1 const & s) const { SimplexSet result; star(s, result); return result; }
+    SimplexSet star(Simplex2 const & s) const { SimplexSet result; star(s, result); return result; }
+    SimplexSet star(SimplexSet const & simplex_set) const { SimplexSet result; star(simplex_set, result); return result; }
+
+    SimplexSet closure(Simplex0 const & s) const { SimplexSet result; closure(s, result); return result; }
+    SimplexSet closure(Simplex1 const & s) const { SimplexSet result; closure(s, result); return result; }
+    SimplexSet closure(Simplex2 const & s) const { SimplexSet result; closure(s, result); return result; }
+    SimplexSet closure(SimplexSet const & simplex_set) const { SimplexSet result; closure(simplex_set, result); return result; }
+
+    SimplexSet link(Simplex0 const & s) const { SimplexSet result; link(s, result); return result; }
 
     virtual SimplexSet get_all_simplices() const = 0;
-    virtual SimplexSet get_simplices(unsigned int const & label) const = 0;
+    /**
+     * @return  All 2-simplices with the given label. The set is owned by
+     *          the mesh and is only valid until the mesh is changed.
+     */
+    virtual SimplexSet const & get_simplices(unsigned int const & label) const = 0;
+
+    /**
+     * @return  All 2-simplices with the given label and their edges and
+     *          vertices. The set is owned by the mesh and is only valid
+     *          until the mesh is changed.
+     */
+    virtual SimplexSet const & get_phase(unsigned int const & label) const = 0;
 
     virtual void remove_all_simplices() = 0;
     virtual void remove(Simplex0 const & s) = 0;
@@ -53,13 +92,26 @@ namespace grit
     virtual void replace(
                          SimplexSet const & old_simplices
                          , SimplexSet const & new_simplices
-                         , std::map<Simplex2,Simplex2> const & parent_lut
+                         , Simplex2LUT const & parent_lut
                          , details::Parameters const & parameters
                          ) = 0;
 
     virtual Simplex2 insert(Simplex0 const & s0, Simplex0 const & s1, Simplex0 const & s2) = 0;
     virtual Simplex0 insert() = 0;
 
+    /**
+     * Inserts many triangles at once. The vertices must already be in the
+     * mesh. Building a mesh this way is much faster than inserting the
+     * triangles one by one when the mesh has no triangles yet.
+     *
+     * @param triangles   Three vertices per triangle, in any order.
+     * @param labels      The label of each triangle.
+     */
+    virtual void insert(
+                        std::vector<Simplex0> const & triangles
+                        , std::vector<unsigned int> const & labels
+                        ) = 0;
+
     virtual bool & submesh_boundary(Simplex0 const & s) = 0;
 
     virtual bool is_submesh_boundary(Simplex0 const & s) const = 0;
@@ -83,9 +135,14 @@ namespace grit
     // 2015-11-08 Marek: I agree, the only problem is that IsInterface() logical
     //                   expression would have to start depending on attributes object.
     //                   Some heavy refactoring might be needed.
-    virtual unsigned int       & label(Simplex2 const & s)       = 0;
     virtual unsigned int const & label(Simplex2 const & s) const = 0;
 
+    /**
+     * Gives a triangle a new label. Labels are only read through label(),
+     * so reading a label never counts as a change of the mesh.
+     */
+    virtual void set_label(Simplex2 const & s, unsigned int const & value) = 0;
+
     unsigned int label(Simplex0 const & ) const
     {
       assert(false || !"label(s0) is not defined");
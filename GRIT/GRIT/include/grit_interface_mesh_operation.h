@@ -3,9 +3,9 @@
 
 #include <grit_simplex.h>
 #include <grit_simplex_set.h>
+#include <grit_simplex_lut.h>
 #include <grit_interface_mesh.h>
 
-#include <map>
 
 namespace grit
 {
@@ -19,9 +19,10 @@ namespace grit
   protected:
 
     typedef typename types::attributes_type      AT;
+    typedef typename types::mesh_impl            MI;
 
-    typedef          std::map<Simplex1,Simplex1> simplex1_lut_type;
-    typedef          std::map<Simplex2,Simplex2> simplex2_lut_type;
+    typedef          Simplex1LUT                 simplex1_lut_type;
+    typedef          Simplex2LUT                 simplex2_lut_type;
 
   public:
 
@@ -34,7 +35,7 @@ namespace grit
      * moved sequentially afterwards.
      */
     virtual void init(
-                      InterfaceMesh  const & mesh
+                      MI             const & mesh
                       , AT                 & attributes
                       ) = 0;
 
@@ -47,7 +48,7 @@ namespace grit
      */
     virtual bool update_local_attributes(
                                           S               const & simplex
-                                          , InterfaceMesh const & mesh
+                                          , MI            const & mesh
                                           , AT                  & attributes
                                           ) = 0;
 
@@ -64,7 +65,7 @@ namespace grit
      */
     virtual bool plan_local_connectivity_changes(
                                                  S                   const & simplex
-                                                 , InterfaceMesh           & mesh
+                                                 , MI                      & mesh
                                                  , AT                const & attributes
                                                  , SimplexSet              & new_simplices
                                                  , SimplexSet              & old_simplices
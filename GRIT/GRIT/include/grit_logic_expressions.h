@@ -154,17 +154,24 @@ namespace grit
 
   };
 
-  class InPhase
-  : public LogicExpression<InPhase>
+  /**
+   * The expressions querying a mesh are templated on the mesh type M. The
+   * typedefs without the Basic prefix work on any InterfaceMesh. Inside the
+   * algorithm layer they are bound to the concrete mesh type instead, so the
+   * mesh queries are resolved at compile time and can be inlined.
+   */
+  template<typename M>
+  class BasicInPhase
+  : public LogicExpression< BasicInPhase<M> >
   {
   protected:
 
-    InterfaceMesh             const & m_mesh;
+    M                         const & m_mesh;
     unsigned int                m_label;
 
   public:
 
-    InPhase(InterfaceMesh const & mesh, unsigned int const & label )
+    BasicInPhase(M const & mesh, unsigned int const & label )
     : m_mesh(mesh)
     , m_label(label)
     {
@@ -210,6 +217,8 @@ namespace grit
 
   };
 
+  typedef BasicInPhase<InterfaceMesh>  InPhase;
+
   class IsDimension
   : public LogicExpression<IsDimension>
   {
@@ -237,16 +246,17 @@ namespace grit
 
   };
 
-  class IsBoundary
-  : public LogicExpression<IsBoundary>
+  template<typename M>
+  class BasicIsBoundary
+  : public LogicExpression< BasicIsBoundary<M> >
   {
   protected:
 
-    InterfaceMesh             const & m_mesh;
+    M                         const & m_mesh;
 
   public:
 
-    IsBoundary(InterfaceMesh const & mesh)
+    BasicIsBoundary(M const & mesh)
     : m_mesh(mesh)
     {
     }
@@ -259,16 +269,19 @@ namespace grit
 
   };
 
-  class IsInterface
-  : public LogicExpression<IsInterface>
+  typedef BasicIsBoundary<InterfaceMesh>  IsBoundary;
+
+  template<typename M>
+  class BasicIsInterface
+  : public LogicExpression< BasicIsInterface<M> >
   {
   protected:
 
-    InterfaceMesh             const & m_mesh;
+    M                         const & m_mesh;
 
   public:
 
-    IsInterface(InterfaceMesh const & mesh)
+    BasicIsInterface(M const & mesh)
     : m_mesh(mesh)
     {
     }
@@ -281,16 +294,19 @@ namespace grit
 
   };
 
-  class IsSubmeshBoundary
-  : public LogicExpression<IsSubmeshBoundary>
+  typedef BasicIsInterface<InterfaceMesh>  IsInterface;
+
+  template<typename M>
+  class BasicIsSubmeshBoundary
+  : public LogicExpression< BasicIsSubmeshBoundary<M> >
   {
   protected:
 
-    InterfaceMesh             const & m_mesh;
+    M                         const & m_mesh;
 
   public:
 
-    IsSubmeshBoundary(InterfaceMesh const & mesh)
+    BasicIsSubmeshBoundary(M const & mesh)
     : m_mesh(mesh)
     {
     }
@@ -303,16 +319,19 @@ namespace grit
 
   };
 
-  class IsManifold
-  : public LogicExpression<IsManifold>
+  typedef BasicIsSubmeshBoundary<InterfaceMesh>  IsSubmeshBoundary;
+
+  template<typename M>
+  class BasicIsManifold
+  : public LogicExpression< BasicIsManifold<M> >
   {
   protected:
 
-    InterfaceMesh             const & m_mesh;
+    M                         const & m_mesh;
 
   public:
 
-    IsManifold(InterfaceMesh const & mesh)
+    BasicIsManifold(M const & mesh)
     : m_mesh(mesh)
     {
     }
@@ -325,16 +344,19 @@ namespace grit
 
   };
 
-  class IsValid
-  : public LogicExpression<IsValid>
+  typedef BasicIsManifold<InterfaceMesh>  IsManifold;
+
+  template<typename M>
+  class BasicIsValid
+  : public LogicExpression< BasicIsValid<M> >
   {
   protected:
 
-    InterfaceMesh             const & m_mesh;
+    M                         const & m_mesh;
 
   public:
 
-    IsValid(InterfaceMesh const & mesh)
+    BasicIsValid(M const & mesh)
     : m_mesh(mesh)
     {
     }
@@ -347,6 +369,8 @@ namespace grit
 
   };
 
+  typedef BasicIsValid<InterfaceMesh>  IsValid;
+
   class IsNull
   : public LogicExpression<IsNull>
   {
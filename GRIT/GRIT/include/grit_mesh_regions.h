@@ -0,0 +1,330 @@
+#ifndef GRIT_MESH_REGIONS_H
+#define GRIT_MESH_REGIONS_H
+
+#include <grit_interface_mesh.h>
+#include <grit_simplex.h>
+#include <grit_simplex_set.h>
+#include <grit_logic_expressions.h>
+
+#include <util_use_pthreads.h>
+
+#include <vector>
+
+namespace grit
+{
+
+  namespace details
+  {
+
+    /**
+     * Vertex ownership for running several algorithms in place on one
+     * mesh. Every vertex belongs to one region, except the vertices where
+     * triangles of different regions meet. Those are shared, and are
+     * marked as submesh boundary for as long as the regions exist, so no
+     * region moves or removes them. A triangle belongs to the region of
+     * its vertices that are not shared, and no triangle has vertices of two
+     * regions. An algorithm only works on simplices whose triangles all
+     * belong to its own region, see InRegion, so two regions never change
+     * the same part of the mesh.
+     *
+     * The mesh and the attributes are still shared containers, they grow
+     * and shrink on every split and collapse, and even the const queries of
+     * the mesh write to cached data. The regions therefore also hold a
+     * lock, which an algorithm must hold whenever it touches the mesh or
+     * the attributes, see RegionLock.
+     */
+    class MeshRegions
+    {
+    public:
+
+      enum special_owners
+      {
+        shared   = 0xFFFFFFFFu   ///< Owner of the vertices on the border between regions.
+        , none   = 0xFFFFFFFEu   ///< Owner of the vertices no region has claimed or created.
+      };
+
+    protected:
+
+      pthread_mutex_t             m_mutex;
+      InterfaceMesh       const * m_mesh;             ///< The mesh given to claim().
+      std::vector<unsigned int>   m_owner;            ///< The region of each vertex, indexed by vertex index.
+      std::vector<Simplex0>       m_marked;           ///< Shared vertices marked as submesh boundary by claim().
+
+    public:
+
+      MeshRegions()
+      : m_mesh(0)
+      , m_owner()
+      , m_marked()
+      {
+        pthread_mutex_init( &m_mutex, NULL );
+      }
+
+      ~MeshRegions()
+      {
+        pthread_mutex_destroy( &m_mutex );
+      }
+
+    private:
+
+      MeshRegions(MeshRegions const &);
+      MeshRegions & operator=(MeshRegions const &);
+
+    public:
+
+      void lock()   { pthread_mutex_lock( &m_mutex );   }
+      void unlock() { pthread_mutex_unlock( &m_mutex ); }
+
+      /**
+       * The region of vertex @s, or shared, or none.
+       */
+      unsigned int owner(Simplex0 const & s) const
+      {
+        return s.get_idx0() < m_owner.size() ? m_owner[s.get_idx0()] : (unsigned int)none;
+      }
+
+      void set_owner(Simplex0 const & s, unsigned int const & region)
+      {
+        if (s.get_idx0() >= m_owner.size())
+          m_owner.resize(s.get_idx0() + 1u, (unsigned int)none);
+
+        m_owner[s.get_idx0()] = region;
+      }
+
+      /**
+       * Hands the vertices of the triangles in @parts[i] to region i. The
+       * vertices of triangles in more than one part are shared, and are
+       * marked as submesh boundary until release() is called.
+       */
+      template<typename MI>
+      void claim(
+                 std::vector< std::vector<Simplex2> > const & parts
+                 , MI                                       & mesh
+                 )
+      {
+        m_mesh = &mesh;
+
+        m_owner.clear();
+        m_marked.clear();
+
+        std::vector<bool> seen;
+
+        for (unsigned int i = 0u; i < parts.size(); ++i)
+        {
+          for (size_t j = 0u; j < parts[i].size(); ++j)
+          {
+            Simplex2 const & t = parts[i][j];
+
+            Simplex0 const vertices[3u] = { t.get_simplex0_idx0(), t.get_simplex0_idx1(), t.get_simplex0_idx2() };
+
+            for (unsigned int k = 0u; k < 3u; ++k)
+            {
+              size_t const v = vertices[k].get_idx0();
+
+              if (v >= seen.size())
+                seen.resize(v + 1u, false);
+
+              if (!seen[v])
+                set_owner(vertices[k], i);
+              else if (m_owner[v] != i)
+                m_owner[v] = (unsigned int)shared;
+
+              seen[v] = true;
+            }
+          }
+        }
+
+        for (size_t v = 0u; v < seen.size(); ++v)
+        {
+          Simplex0 const s(v);
+
+          if (!seen[v] || m_owner[v] != shared || mesh.is_submesh_boundary(s))
+            continue;
+
+          mesh.submesh_boundary(s) = true;
+          m_marked.push_back(s);
+        }
+      }
+
+      /**
+       * Removes the submesh boundary marks set by claim(), and drops the
+       * ownership of all vertices.
+       */
+      template<typename MI>
+      void release(MI & mesh)
+      {
+        for (size_t i = 0u; i < m_marked.size(); ++i)
+        {
+          if (mesh.is_valid_simplex(m_marked[i]))
+            mesh.submesh_boundary(m_marked[i]) = false;
+        }
+
+        m_mesh = 0;
+
+        m_owner.clear();
+        m_marked.clear();
+      }
+
+      /**
+       * True if every triangle of edge @s has a vertex of @region.
+       */
+      bool owns_star(Simplex1 const & s, unsigned int const & region) const
+      {
+        SimplexSet star;
+
+        m_mesh->star(s, star);
+
+        for (SimplexSet::simplex2_const_iterator t = star.begin2(); t != star.end2(); ++t)
+        {
+          if (   owner(t->get_simplex0_idx0()) != region
+              && owner(t->get_simplex0_idx1()) != region
+              && owner(t->get_simplex0_idx2()) != region)
+            return false;
+        }
+
+        return star.size(2) > 0u;
+      }
+
+    }; // class MeshRegions
+
+
+    /**
+     * True for the vertices and triangles whose vertices all belong to one
+     * region, and for the edges whose triangles all belong to it. An edge
+     * may thus join two shared vertices, so the region can flip and split
+     * the edges along its border. An empty InRegion stands for an
+     * algorithm which has the mesh to itself, it is true for every simplex
+     * and never locks.
+     */
+    class InRegion
+    : public LogicExpression<InRegion>
+    {
+    protected:
+
+      MeshRegions *   m_regions;
+      unsigned int    m_region;
+
+    public:
+
+      InRegion()
+      : m_regions(0)
+      , m_region(0u)
+      {}
+
+      InRegion(MeshRegions & regions, unsigned int const & region)
+      : m_regions(&regions)
+      , m_region(region)
+      {}
+
+    public:
+
+      MeshRegions * regions() const { return m_regions; }
+
+      bool is_null() const { return m_regions == 0; }
+
+      template<typename S>
+      bool operator()(S const & s) const;
+
+      bool operator()(Simplex0 const & s) const
+      {
+        return !m_regions || m_regions->owner(s) == m_region;
+      }
+
+      bool operator()(Simplex1 const & s) const
+      {
+        if (!m_regions)
+          return true;
+
+        unsigned int const a = m_regions->owner(s.get_simplex0_idx0());
+        unsigned int const b = m_regions->owner(s.get_simplex0_idx1());
+
+        if (a != m_region && a != MeshRegions::shared)
+          return false;
+
+        if (b != m_region && b != MeshRegions::shared)
+          return false;
+
+        return a == m_region || b == m_region || m_regions->owns_star(s, m_region);
+      }
+
+      bool operator()(Simplex2 const & s) const
+      {
+        return (*this)(s.get_simplex0_idx0()) && (*this)(s.get_simplex0_idx1()) && (*this)(s.get_simplex0_idx2());
+      }
+
+      /**
+       * True if at least one vertex of @s belongs to the region.
+       */
+      bool touches(Simplex2 const & s) const
+      {
+        return (*this)(s.get_simplex0_idx0()) || (*this)(s.get_simplex0_idx1()) || (*this)(s.get_simplex0_idx2());
+      }
+
+      /**
+       * Gives the 0-simplices inserted by a mesh operation to the region.
+       * Slots of removed vertices are reused for new ones, so a new vertex
+       * can have the index of a vertex another region owned. Shared
+       * vertices stay shared.
+       */
+      void take(SimplexSet const & new_simplices) const
+      {
+        if (!m_regions)
+          return;
+
+        for (SimplexSet::simplex0_const_iterator it = new_simplices.begin0(); it != new_simplices.end0(); ++it)
+        {
+          if (m_regions->owner(*it) != MeshRegions::shared)
+            m_regions->set_owner(*it, m_region);
+        }
+      }
+
+    }; // class InRegion
+
+
+    /**
+     * Holds the lock of the regions of @region from construction until
+     * release() or destruction. Does nothing for an empty InRegion.
+     */
+    class RegionLock
+    {
+    protected:
+
+      MeshRegions *   m_regions;
+
+    public:
+
+      explicit RegionLock(InRegion const & region)
+      : m_regions(region.regions())
+      {
+        if (m_regions)
+          m_regions->lock();
+      }
+
+      ~RegionLock()
+      {
+        release();
+      }
+
+    private:
+
+      RegionLock(RegionLock const &);
+      RegionLock & operator=(RegionLock const &);
+
+    public:
+
+      void release()
+      {
+        if (m_regions)
+          m_regions->unlock();
+
+        m_regions = 0;
+      }
+
+    }; // class RegionLock
+
+  } // namespace details
+
+} // namespace grit
+
+// GRIT_MESH_REGIONS_H
+#endif
@@ -7,6 +7,7 @@
 #include <grit_attribute_vector.h>
 #include <grit_simplex_set_functions.h>
 #include <grit_parameters.h>
+#include <grit_polymesh_builder.h>
 
 #include <util_is_ccw.h>
 #include <util_boolean.h>
@@ -15,11 +16,20 @@
 
 #include <OpenTissue/core/containers/mesh/polymesh/polymesh.h>
 
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <algorithm>  // Needed for std::sort, std::unique
+#include <stdexcept>  // Needed for std::out_of_range
+
 namespace grit
 {
 
-  template<typename mesh_type>
-  class OpenTissueMesh
+  template<
+    typename mesh_type
+  , typename coordinate_type = typename mesh_type::math_types::vector3_type
+  >
+  class OpenTissueMesh final
   : public InterfaceMesh
   {
   private:
@@ -34,13 +44,57 @@ namespace grit
     typedef typename mesh_type::vertex_type              vertex_type;
     typedef typename mesh_type::halfedge_type            halfedge_type;
     typedef typename mesh_type::math_types::real_type    real_type;
-    typedef typename mesh_type::math_types::vector3_type vector3_type;
+    typedef coordinate_type                              vector3_type;
 
   private:
 
     mesh_type                              m_mesh;
     Simplex0AttributeVector<util::Boolean> m_submesh_boundary;
-    Simplex2AttributeVector<unsigned int>  m_phase; // 2015-11-04 Marek: this should be refactored to "label"
+    std::vector<unsigned int>              m_labels;  ///< The label of every face, indexed by face handle index.
+
+    std::unordered_map<Simplex1, edge_handle>  m_edge_lut;   ///< Maps every edge of the mesh to its handle, kept up to date by insert and remove.
+    std::unordered_map<Simplex2, face_handle>  m_face_lut;   ///< Maps every face of the mesh to its handle, kept up to date by insert and remove.
+
+    /**
+     * Classification bits of vertices and edges. The bits of a vertex or
+     * an edge are computed on first use, and are cleared whenever a face
+     * touching it is inserted or removed, a face touching it is given a
+     * new label, or the submesh boundary flag of a nearby vertex changes.
+     */
+    enum classification_bits
+    {
+      classified_bit       = 1u   ///< The other bits are up to date.
+      , interface_bit        = 2u   ///< See is_interface.
+      , boundary_bit         = 4u   ///< See is_boundary.
+      , submesh_boundary_bit = 8u   ///< See is_submesh_boundary (edges only).
+    };
+
+    mutable std::vector<unsigned char>  m_vertex_bits;   ///< Classification of each vertex, indexed by vertex handle index.
+    mutable std::vector<unsigned char>  m_edge_bits;     ///< Classification of each edge, indexed by edge handle index.
+
+    /**
+     * The simplices of a single phase. The faces of the phase are counted
+     * on their edges and vertices, so the closure can be updated when
+     * faces enter or leave the phase.
+     */
+    class PhaseIndex
+    {
+    public:
+
+      SimplexSet                                  m_faces;          ///< All faces with the label.
+      SimplexSet                                  m_closure;        ///< All faces with the label and their edges and vertices.
+      std::unordered_map<Simplex1, unsigned int>  m_edge_count;     ///< Number of faces in the phase sharing each edge.
+      std::unordered_map<Simplex0, unsigned int>  m_vertex_count;   ///< Number of faces in the phase sharing each vertex.
+
+    };
+
+    mutable std::map<unsigned int, PhaseIndex>          m_phase_index;     ///< The phase of every label, updated on use.
+    mutable std::unordered_map<Simplex2, unsigned int>  m_indexed_label;   ///< The label each face is indexed under in m_phase_index.
+    mutable std::vector<Simplex2>                       m_unindexed;       ///< Faces inserted, removed or relabeled since the last update of m_phase_index.
+
+    mutable std::vector<Simplex0>  m_buffer0;   ///< Scratch space where the topology queries collect their 0-simplices.
+    mutable std::vector<Simplex1>  m_buffer1;   ///< Scratch space where the topology queries collect their 1-simplices.
+    mutable std::vector<Simplex2>  m_buffer2;   ///< Scratch space where the topology queries collect their 2-simplices.
 
   public:
 
@@ -73,49 +127,11 @@ namespace grit
       face1 = htype1.get_face_handle();
     }
 
-    bool simplex_is_face(Simplex2 const & s, face_handle const & f) const
-    {
-      vertex_handle v0, v1, v2;
-
-      get_vertices_from_face(f, v0, v1, v2);
-
-      // 2015-08-01 Kenny: There is no restrictions on the order of simplex 0
-      // in s. Hence, we need to test every possible combination. Although we
-      // do know that the base mesh type keeps faces in CCW order this can not
-      // really be exploited as any order is allowed for a Simplex2.
-
-      if (v0.get_idx() == s.get_idx0() && v1.get_idx() == s.get_idx1() && v2.get_idx() == s.get_idx2()) return true;
-      if (v0.get_idx() == s.get_idx0() && v1.get_idx() == s.get_idx2() && v2.get_idx() == s.get_idx1()) return true;
-      if (v0.get_idx() == s.get_idx1() && v1.get_idx() == s.get_idx0() && v2.get_idx() == s.get_idx2()) return true;
-      if (v0.get_idx() == s.get_idx1() && v1.get_idx() == s.get_idx2() && v2.get_idx() == s.get_idx0()) return true;
-      if (v0.get_idx() == s.get_idx2() && v1.get_idx() == s.get_idx0() && v2.get_idx() == s.get_idx1()) return true;
-      if (v0.get_idx() == s.get_idx2() && v1.get_idx() == s.get_idx1() && v2.get_idx() == s.get_idx0()) return true;
-
-      return false;
-    }
-
     face_handle simplex_to_face(Simplex2 const & s) const
     {
-      vertex_type v = *(m_mesh.get_vertex_iterator(s.get_idx0()));
-
-      typename mesh_type::const_vertex_edge_circulator e(v);
-      typename mesh_type::const_vertex_edge_circulator eend;
-
-      for (; e != eend; ++e)
-      {
-        edge_handle eh = e->get_handle();
-
-        face_handle f1, f2;
-
-        get_faces_from_edge(eh, f1, f2);
+      typename std::unordered_map<Simplex2, face_handle>::const_iterator lookup = m_face_lut.find(s);
 
-        if (m_mesh.is_valid_face_handle(f1) && simplex_is_face(s, f1))
-          return f1;
-        if (m_mesh.is_valid_face_handle(f2) && simplex_is_face(s, f2))
-          return f2;
-      }
-
-      return face_handle();
+      return lookup != m_face_lut.end() ? lookup->second : face_handle();
     }
 
     Simplex2 face_to_simplex(face_handle const & face) const
@@ -127,37 +143,18 @@ namespace grit
 
       typename mesh_type::const_face_vertex_circulator v(f);
 
-      Simplex2::index_type const v0 = v->get_handle().get_idx(); ++v;
-      Simplex2::index_type const v1 = v->get_handle().get_idx(); ++v;
-      Simplex2::index_type const v2 = v->get_handle().get_idx();
+      Simplex2::index_type const v0 = static_cast<Simplex2::index_type>( v->get_handle().get_idx() ); ++v;
+      Simplex2::index_type const v1 = static_cast<Simplex2::index_type>( v->get_handle().get_idx() ); ++v;
+      Simplex2::index_type const v2 = static_cast<Simplex2::index_type>( v->get_handle().get_idx() );
 
       return Simplex2(v0, v1, v2);
     }
 
     edge_handle simplex_to_edge(Simplex1 const & s) const
     {
-      vertex_type v = *( m_mesh.get_vertex_iterator(s.get_idx0()) );
-
-      typename mesh_type::const_vertex_halfedge_circulator h(v);
-      typename mesh_type::const_vertex_halfedge_circulator hend;
-
-      for (; h != hend; ++h)
-      {
-        halfedge_type htype = *(m_mesh.get_halfedge_iterator(h->get_handle()));
-
-        vertex_handle v0 = htype.get_destination_handle();
-        vertex_handle v1 = htype.get_origin_handle();
-
-        edge_handle e = htype.get_edge_handle();
-
-        if (v0.get_idx() == s.get_idx0() && v1.get_idx() == s.get_idx1())
-          return e;
+      typename std::unordered_map<Simplex1, edge_handle>::const_iterator lookup = m_edge_lut.find(s);
 
-        if (v0.get_idx() == s.get_idx1() && v1.get_idx() == s.get_idx0())
-          return e;
-      }
-
-      return edge_handle();
+      return lookup != m_edge_lut.end() ? lookup->second : edge_handle();
     }
 
     Simplex1 edge_to_simplex(edge_handle const & edge) const
@@ -173,7 +170,7 @@ namespace grit
       vertex_handle vertex0 = htype0.get_destination_handle();
       vertex_handle vertex1 = htype1.get_destination_handle();
 
-      return Simplex1(vertex0.get_idx(), vertex1.get_idx());
+      return Simplex1( vertex_to_simplex(vertex0), vertex_to_simplex(vertex1) );
     }
 
     vertex_handle simplex_to_vertex(Simplex0 const & s) const
@@ -183,7 +180,7 @@ namespace grit
 
     Simplex0 vertex_to_simplex(vertex_handle const & vertex) const
     {
-      return Simplex0(vertex.get_idx());
+      return Simplex0( static_cast<Simplex0::index_type>( vertex.get_idx() ) );
     }
 
     void get_vertices_from_face(
@@ -220,217 +217,591 @@ namespace grit
       vertex1 = htype1.get_destination_handle();
     }
 
-  public:
+    /**
+     * The label of a valid face. Every face gets its slot in m_labels when
+     * it is inserted, so the handle index can be used directly.
+     */
+    unsigned int       & face_label(face_handle const & face)       { return m_labels[face.get_idx()]; }
+    unsigned int const & face_label(face_handle const & face) const { return m_labels[face.get_idx()]; }
 
-    OpenTissueMesh()
-    {}
+    /**
+     * Adds a new face and its edges to the lookup tables. Edges shared
+     * with existing faces are already in the table and keep their handle.
+     */
+    void add_to_lookup_tables(face_handle const & face)
+    {
+      m_face_lut[face_to_simplex(face)] = face;
+
+      face_type ftype = *(m_mesh.get_face_iterator(face));
 
-    SimplexSet boundary(Simplex2 const & s) const
+      typename mesh_type::const_face_edge_circulator e(ftype), eend;
+
+      for (; e != eend; ++e)
+      {
+        m_edge_lut[edge_to_simplex(e->get_handle())] = e->get_handle();
+      }
+    }
+
+    /**
+     * Adds a face with the orientation given by the coordinates. The new
+     * face has label zero, and an invalid handle is returned if the face
+     * could not be added.
+     */
+    face_handle insert_face(Simplex0 const & s0, Simplex0 const & s1, Simplex0 const & s2)
     {
-      Simplex0 s0 = s.get_simplex0_idx0();
-      Simplex0 s1 = s.get_simplex0_idx1();
-      Simplex0 s2 = s.get_simplex0_idx2();
-      SimplexSet simplex_set;
-      simplex_set.insert(Simplex1(s0, s1));
-      simplex_set.insert(Simplex1(s1, s2));
-      simplex_set.insert(Simplex1(s2, s0));
+      vertex_handle v0 = vertex_handle(s0.get_idx0());
+      vertex_handle v1 = vertex_handle(s1.get_idx0());
+      vertex_handle v2 = vertex_handle(s2.get_idx0());
 
-      return simplex_set;
+      Simplex2 simplex = Simplex2(s0.get_idx0(), s1.get_idx0(), s2.get_idx0());
+
+      face_handle const face = (orientation(simplex) == negative)
+                             ? m_mesh.add_face(v0, v1, v2)
+                             : m_mesh.add_face(v0, v2, v1);
+
+      if (!m_mesh.is_valid_face_handle(face))
+        return face;
+
+      add_to_lookup_tables(face);
+
+      if (face.get_idx() >= m_labels.size())
+        m_labels.resize(face.get_idx() + 1u);
+
+      face_label(face) = 0u;
+
+      declassify(simplex);
+
+      m_unindexed.push_back(simplex);
+
+      return face;
     }
 
-    SimplexSet boundary(Simplex1 const & s) const
+    /**
+     * Computes the classification bits of a valid edge.
+     */
+    unsigned char classify(edge_handle const & e) const
     {
-      vertex_handle vertex0, vertex1;
+      face_handle f1, f2;
+      get_faces_from_edge(e, f1, f2);
 
-      get_vertices_from_edge(simplex_to_edge(s), vertex0, vertex1);
+      if (m_mesh.is_valid_face_handle(f1) && m_mesh.is_valid_face_handle(f2))
+      {
+        // 29-03-2015 Marek: only interface edges, which do not lie on the boundary, are interface edges.
+        return face_label(f1) != face_label(f2)
+             ? (classified_bit | interface_bit)
+             : classified_bit;
+      }
 
-      SimplexSet simplex_set;
+      Simplex1 const s = edge_to_simplex(e);
 
-      simplex_set.insert(vertex_to_simplex(vertex0));
-      simplex_set.insert(vertex_to_simplex(vertex1));
+      return is_submesh_boundary(s.get_simplex0_idx0()) && is_submesh_boundary(s.get_simplex0_idx1())
+           ? (classified_bit | submesh_boundary_bit)
+           : (classified_bit | boundary_bit);
+    }
 
-      return simplex_set;
+    /**
+     * Computes the classification bits of a valid vertex from the bits
+     * of its edges.
+     */
+    unsigned char classify(vertex_type const & v) const
+    {
+      typename mesh_type::const_vertex_edge_circulator e(v), eend;
+
+      unsigned char bits = classified_bit;
+
+      for (; e != eend; ++e)
+      {
+        bits |= classification(e->get_handle()) & (interface_bit | boundary_bit);
+      }
+
+      return bits;
     }
 
+    unsigned char classification(edge_handle const & e) const
+    {
+      size_t const i = e.get_idx();
+
+      if (i >= m_edge_bits.size())
+        m_edge_bits.resize(i + 1u, 0u);
 
-    SimplexSet boundary(Simplex0 const & s) const
+      if (!(m_edge_bits[i] & classified_bit))
+        m_edge_bits[i] = classify(e);
+
+      return m_edge_bits[i];
+    }
+
+    unsigned char classification(Simplex0 const & s) const
     {
-      return SimplexSet(); // Do nothing
+      size_t const i = s.get_idx0();
+
+      if (i >= m_vertex_bits.size())
+        m_vertex_bits.resize(i + 1u, 0u);
+
+      if (!(m_vertex_bits[i] & classified_bit))
+        m_vertex_bits[i] = classify( *m_mesh.get_vertex_iterator(s.get_idx0()) );
+
+      return m_vertex_bits[i];
     }
 
-    SimplexSet full_boundary(Simplex2 const & s) const
+    void declassify(Simplex0 const & s)
     {
-      face_type ftype = *m_mesh.get_face_iterator(simplex_to_face(s));
+      if (s.get_idx0() < m_vertex_bits.size())
+        m_vertex_bits[s.get_idx0()] = 0u;
+    }
 
-      typename mesh_type::const_face_vertex_circulator v(ftype), vend;
-      typename mesh_type::const_face_edge_circulator e(ftype), eend;
+    void declassify(edge_handle const & e)
+    {
+      if (m_mesh.is_valid_edge_handle(e) && e.get_idx() < m_edge_bits.size())
+        m_edge_bits[e.get_idx()] = 0u;
+    }
 
-      SimplexSet simplex_set;
+    /**
+     * Clears the classification of the vertices and edges of a face.
+     */
+    void declassify(Simplex2 const & s)
+    {
+      declassify(s.get_simplex0_idx0());
+      declassify(s.get_simplex0_idx1());
+      declassify(s.get_simplex0_idx2());
 
-      for (; e != eend; ++e) { simplex_set.insert(edge_to_simplex(e->get_handle())); }
-      for (; v != vend; ++v) { simplex_set.insert(vertex_to_simplex(v->get_handle())); }
+      declassify(simplex_to_edge(Simplex1(s.get_idx0(), s.get_idx1())));
+      declassify(simplex_to_edge(Simplex1(s.get_idx1(), s.get_idx2())));
+      declassify(simplex_to_edge(Simplex1(s.get_idx2(), s.get_idx0())));
+    }
 
-      return simplex_set;
+    /**
+     * Clears the classification of a vertex, its edges and its neighbours,
+     * as the classification of all these depends on the submesh boundary
+     * flag of the vertex.
+     */
+    void declassify_neighborhood(Simplex0 const & s)
+    {
+      declassify(s);
+
+      if (!m_mesh.is_valid_vertex_handle(simplex_to_vertex(s)))
+        return;
+
+      vertex_type v = *m_mesh.get_vertex_iterator(s.get_idx0());
+
+      typename mesh_type::const_vertex_halfedge_circulator h(v), hend;
+
+      for (; h != hend; ++h)
+      {
+        declassify(h->get_edge_handle());
+        declassify(vertex_to_simplex(h->get_destination_handle()));
+      }
     }
 
-    SimplexSet full_boundary(Simplex1 const & s) const
+    /**
+     * Brings m_phase_index up to date, by moving each face that changed
+     * since the last update out of the phase it was indexed under and into
+     * the phase of its current label. The cost is proportional to the
+     * number of changed faces and the size of the phases they touch.
+     */
+    void update_phase_index() const
     {
-      vertex_handle vertex0, vertex1;
+      if (m_unindexed.empty())
+        return;
 
-      get_vertices_from_edge(simplex_to_edge(s), vertex0, vertex1);
+      std::sort(m_unindexed.begin(), m_unindexed.end());
+      m_unindexed.erase( std::unique(m_unindexed.begin(), m_unindexed.end()), m_unindexed.end() );
 
-      SimplexSet simplex_set;
+      std::map<unsigned int, SimplexSet> added;
+      std::map<unsigned int, SimplexSet> removed;
 
-      simplex_set.insert(vertex_to_simplex(vertex0));
-      simplex_set.insert(vertex_to_simplex(vertex1));
+      for (size_t i = 0u; i < m_unindexed.size(); ++i)
+      {
+        Simplex2 const & t = m_unindexed[i];
 
-      return simplex_set;
+        typename std::unordered_map<Simplex2, unsigned int>::iterator old = m_indexed_label.find(t);
+
+        face_handle const face = simplex_to_face(t);
+
+        bool const is_indexed = old != m_indexed_label.end();
+        bool const is_labeled = m_mesh.is_valid_face_handle(face);
+
+        if (is_indexed && is_labeled && old->second == face_label(face))
+          continue;
+
+        if (is_indexed)
+        {
+          leave_phase(t, m_phase_index[old->second], removed[old->second]);
+          m_indexed_label.erase(old);
+        }
+
+        if (is_labeled)
+        {
+          unsigned int const l = face_label(face);
+
+          enter_phase(t, m_phase_index[l], added[l]);
+          m_indexed_label[t] = l;
+        }
+      }
+
+      m_unindexed.clear();
+
+      for (std::map<unsigned int, SimplexSet>::const_iterator it = removed.begin(); it != removed.end(); ++it)
+      {
+        PhaseIndex & phase = m_phase_index[it->first];
+
+        phase.m_faces   = difference(phase.m_faces,   it->second);
+        phase.m_closure = difference(phase.m_closure, it->second);
+      }
+
+      for (std::map<unsigned int, SimplexSet>::const_iterator it = added.begin(); it != added.end(); ++it)
+      {
+        PhaseIndex & phase = m_phase_index[it->first];
+
+        phase.m_faces   = set_union(phase.m_faces,   filter(it->second, IsDimension(*this, 2u)));
+        phase.m_closure = set_union(phase.m_closure, it->second);
+      }
     }
 
-    SimplexSet full_boundary(Simplex0 const & s) const
+    /**
+     * Counts face t on its edges and vertices in the phase, and adds the
+     * simplices that become part of the phase to the changes.
+     */
+    static void enter_phase(Simplex2 const & t, PhaseIndex & phase, SimplexSet & changes)
     {
-      // Do nothing
-      return SimplexSet();
+      Simplex1 const edges[3]    = { Simplex1(t.get_idx0(), t.get_idx1()), Simplex1(t.get_idx1(), t.get_idx2()), Simplex1(t.get_idx2(), t.get_idx0()) };
+      Simplex0 const vertices[3] = { t.get_simplex0_idx0(), t.get_simplex0_idx1(), t.get_simplex0_idx2() };
+
+      changes.insert(t);
+
+      for (unsigned int k = 0u; k < 3u; ++k)
+      {
+        if (phase.m_edge_count[edges[k]]++ == 0u)
+          changes.insert(edges[k]);
+
+        if (phase.m_vertex_count[vertices[k]]++ == 0u)
+          changes.insert(vertices[k]);
+      }
     }
 
-    SimplexSet star(Simplex2 const & s) const
+    /**
+     * Uncounts face t on its edges and vertices in the phase, and adds the
+     * simplices that are no longer part of the phase to the changes.
+     */
+    static void leave_phase(Simplex2 const & t, PhaseIndex & phase, SimplexSet & changes)
     {
-      SimplexSet simplex_set;
-      simplex_set.insert(s);
+      Simplex1 const edges[3]    = { Simplex1(t.get_idx0(), t.get_idx1()), Simplex1(t.get_idx1(), t.get_idx2()), Simplex1(t.get_idx2(), t.get_idx0()) };
+      Simplex0 const vertices[3] = { t.get_simplex0_idx0(), t.get_simplex0_idx1(), t.get_simplex0_idx2() };
 
-      return simplex_set;
+      changes.insert(t);
+
+      for (unsigned int k = 0u; k < 3u; ++k)
+      {
+        if (--phase.m_edge_count[edges[k]] == 0u)
+        {
+          phase.m_edge_count.erase(edges[k]);
+          changes.insert(edges[k]);
+        }
+
+        if (--phase.m_vertex_count[vertices[k]] == 0u)
+        {
+          phase.m_vertex_count.erase(vertices[k]);
+          changes.insert(vertices[k]);
+        }
+      }
+    }
+
+    /**
+     * Moves the simplices collected in the scratch buffers into result.
+     * Simplices collected more than once are only stored once, keeping
+     * the first occurrence.
+     */
+    void flush(SimplexSet & result) const
+    {
+      result.clear();
+
+      result.insert(m_buffer0.begin(), m_buffer0.end());
+      result.insert(m_buffer1.begin(), m_buffer1.end());
+      result.insert(m_buffer2.begin(), m_buffer2.end());
+
+      m_buffer0.clear();
+      m_buffer1.clear();
+      m_buffer2.clear();
+    }
+
+    void append_boundary(Simplex2 const & s) const
+    {
+      Simplex0 s0 = s.get_simplex0_idx0();
+      Simplex0 s1 = s.get_simplex0_idx1();
+      Simplex0 s2 = s.get_simplex0_idx2();
+
+      m_buffer1.push_back(Simplex1(s0, s1));
+      m_buffer1.push_back(Simplex1(s1, s2));
+      m_buffer1.push_back(Simplex1(s2, s0));
+    }
+
+    void append_boundary(Simplex1 const & s) const
+    {
+      vertex_handle vertex0, vertex1;
+
+      get_vertices_from_edge(simplex_to_edge(s), vertex0, vertex1);
+
+      m_buffer0.push_back(vertex_to_simplex(vertex0));
+      m_buffer0.push_back(vertex_to_simplex(vertex1));
+    }
+
+    void append_full_boundary(Simplex2 const & s) const
+    {
+      face_type const & ftype = *m_mesh.get_face_iterator(simplex_to_face(s));
+
+      typename mesh_type::const_face_vertex_circulator v(ftype), vend;
+      typename mesh_type::const_face_edge_circulator e(ftype), eend;
+
+      for (; e != eend; ++e) { m_buffer1.push_back(edge_to_simplex(e->get_handle())); }
+      for (; v != vend; ++v) { m_buffer0.push_back(vertex_to_simplex(v->get_handle())); }
     }
 
-    SimplexSet star(Simplex1 const & s) const
+    void append_star(Simplex2 const & s) const
+    {
+      m_buffer2.push_back(s);
+    }
+
+    void append_star(Simplex1 const & s) const
     {
       face_handle face0, face1;
       edge_handle edge = simplex_to_edge(s);
 
       get_faces_from_edge(edge, face0, face1);
 
-      SimplexSet simplex_set;
-
       // If we have an edge on the boundary of the mesh, there will only be one triangle
-      if (m_mesh.is_valid_face_handle(face0)) simplex_set.insert(face_to_simplex(face0));
-      if (m_mesh.is_valid_face_handle(face1)) simplex_set.insert(face_to_simplex(face1));
+      if (m_mesh.is_valid_face_handle(face0)) m_buffer2.push_back(face_to_simplex(face0));
+      if (m_mesh.is_valid_face_handle(face1)) m_buffer2.push_back(face_to_simplex(face1));
 
-      simplex_set.insert(s);
-
-      return simplex_set;
+      m_buffer1.push_back(s);
     }
 
-    SimplexSet star(Simplex0 const & s) const
+    void append_star(Simplex0 const & s) const
     {
-      typename mesh_type::vertex_type vtype = *m_mesh.get_vertex_iterator(simplex_to_vertex(s));
+      vertex_type const & vtype = *m_mesh.get_vertex_iterator(simplex_to_vertex(s));
 
-      typename mesh_type::const_vertex_face_circulator f(vtype), fend;
       typename mesh_type::const_vertex_edge_circulator e(vtype), eend;
 
-      SimplexSet simplex_set;
-
-      //for (; f != fend; ++f) { if (m_mesh.is_valid_face_handle(f->get_handle())) simplex_set.insert(face_to_simplex(f->get_handle())); }
-      //for (; e != eend; ++e) { if (m_mesh.is_valid_edge_handle(e->get_handle())) simplex_set.insert(edge_to_simplex(e->get_handle())); }
-
       for (; e != eend; ++e)
       {
         edge_handle edge = e->get_handle();
         if (m_mesh.is_valid_edge_handle(edge))
         {
-          simplex_set.insert(edge_to_simplex(edge));
+          m_buffer1.push_back(edge_to_simplex(edge));
 
           face_handle face0, face1;
           get_faces_from_edge(edge, face0, face1);
 
-          if (m_mesh.is_valid_face_handle(face0)) simplex_set.insert(face_to_simplex(face0));
-          if (m_mesh.is_valid_face_handle(face1)) simplex_set.insert(face_to_simplex(face1));
+          if (m_mesh.is_valid_face_handle(face0)) m_buffer2.push_back(face_to_simplex(face0));
+          if (m_mesh.is_valid_face_handle(face1)) m_buffer2.push_back(face_to_simplex(face1));
         }
       }
 
-      simplex_set.insert(s);
-
-      return simplex_set;
+      m_buffer0.push_back(s);
     }
 
-    SimplexSet star(SimplexSet const & simplex_set) const
+    void append_closure(Simplex2 const & s) const
     {
-      SimplexSet::simplex0_const_iterator s0 = simplex_set.begin0();
-      SimplexSet::simplex1_const_iterator s1 = simplex_set.begin1();
-      SimplexSet::simplex2_const_iterator s2 = simplex_set.begin2();
+      append_full_boundary(s);
 
-      SimplexSet result;
+      m_buffer2.push_back(s);
+    }
 
-      for (; s0 != simplex_set.end0(); ++s0) { result.insert(star(*s0)); }
-      for (; s1 != simplex_set.end1(); ++s1) { result.insert(star(*s1)); }
-      for (; s2 != simplex_set.end2(); ++s2) { result.insert(star(*s2)); }
+    void append_closure(Simplex1 const & s) const
+    {
+      m_buffer1.push_back(s);
 
-      return result;
+      append_boundary(s);
     }
 
-    SimplexSet closure(Simplex2 const & s) const
+    void append_closure(Simplex0 const & s) const
     {
-      typename mesh_type::face_type ftype = *m_mesh.get_face_iterator(simplex_to_face(s));
+      m_buffer0.push_back(s);
+    }
 
-      typename mesh_type::const_face_edge_circulator e(ftype), eend;
-      typename mesh_type::const_face_vertex_circulator v(ftype), vend;
+    /**
+     * Appends the edge of the face that does not contain the vertex s.
+     */
+    void append_opposite_edge(Simplex0 const & s, face_handle const & face) const
+    {
+      Simplex2 const t = face_to_simplex(face);
 
-      SimplexSet simplex_set;
+      Simplex1 const opposite = (t.get_idx0() == s.get_idx0()) ? Simplex1(t.get_idx1(), t.get_idx2())
+                              : (t.get_idx1() == s.get_idx0()) ? Simplex1(t.get_idx2(), t.get_idx0())
+                              :                                  Simplex1(t.get_idx0(), t.get_idx1());
 
-      for (; e != eend; ++e) { simplex_set.insert(edge_to_simplex(e->get_handle())); }
-      for (; v != vend; ++v) { simplex_set.insert(vertex_to_simplex(v->get_handle())); }
-      simplex_set.insert(s);
+      // Use the orientation of the edge as stored in the mesh
+      m_buffer1.push_back(edge_to_simplex(simplex_to_edge(opposite)));
+    }
 
-      return simplex_set;
+  public:
+
+    OpenTissueMesh()
+    {}
+
+    /**
+     * Removes all simplices, labels and cached queries. The coordinates
+     * stay where m_coords points to.
+     */
+    void clear()
+    {
+      m_mesh.clear();
+      m_submesh_boundary.clear();
+      m_labels.clear();
+      m_edge_lut.clear();
+      m_face_lut.clear();
+      m_vertex_bits.clear();
+      m_edge_bits.clear();
+      m_phase_index.clear();
+      m_indexed_label.clear();
+      m_unindexed.clear();
     }
 
-    SimplexSet closure(Simplex1 const & s) const
+    using InterfaceMesh::boundary;
+    using InterfaceMesh::full_boundary;
+    using InterfaceMesh::star;
+    using InterfaceMesh::closure;
+    using InterfaceMesh::link;
+    using InterfaceMesh::label;
+    using InterfaceMesh::is_submesh_boundary;
+    using InterfaceMesh::is_interface;
+    using InterfaceMesh::is_boundary;
+    using InterfaceMesh::is_manifold;
+
+    void boundary(Simplex2 const & s, SimplexSet & result) const
     {
-      typename mesh_type::vertex_handle vertex0, vertex1;
+      append_boundary(s);
+      flush(result);
+    }
 
-      get_vertices_from_edge(simplex_to_edge(s), vertex0, vertex1);
+    void boundary(Simplex1 const & s, SimplexSet & result) const
+    {
+      append_boundary(s);
+      flush(result);
+    }
 
-      SimplexSet simplex_set;
+    void boundary(Simplex0 const & s, SimplexSet & result) const
+    {
+      result.clear(); // Do nothing
+    }
 
-      simplex_set.insert(s);
+    void full_boundary(Simplex2 const & s, SimplexSet & result) const
+    {
+      append_full_boundary(s);
+      flush(result);
+    }
 
-      simplex_set.insert(vertex_to_simplex(vertex0));
-      simplex_set.insert(vertex_to_simplex(vertex1));
+    void full_boundary(Simplex1 const & s, SimplexSet & result) const
+    {
+      append_boundary(s);
+      flush(result);
+    }
 
-      return simplex_set;
+    void full_boundary(Simplex0 const & s, SimplexSet & result) const
+    {
+      result.clear(); // Do nothing
     }
 
-    SimplexSet closure(Simplex0 const & s) const
+    void star(Simplex2 const & s, SimplexSet & result) const
     {
-      SimplexSet simplex_set;
-      simplex_set.insert(s);
+      append_star(s);
+      flush(result);
+    }
 
-      return simplex_set;
+    void star(Simplex1 const & s, SimplexSet & result) const
+    {
+      append_star(s);
+      flush(result);
     }
 
-    SimplexSet closure(SimplexSet const & simplex_set) const
+    void star(Simplex0 const & s, SimplexSet & result) const
+    {
+      append_star(s);
+      flush(result);
+    }
+
+    void star(SimplexSet const & simplex_set, SimplexSet & result) const
     {
       SimplexSet::simplex0_const_iterator s0 = simplex_set.begin0();
       SimplexSet::simplex1_const_iterator s1 = simplex_set.begin1();
       SimplexSet::simplex2_const_iterator s2 = simplex_set.begin2();
 
-      SimplexSet result;
+      for (; s0 != simplex_set.end0(); ++s0) { append_star(*s0); }
+      for (; s1 != simplex_set.end1(); ++s1) { append_star(*s1); }
+      for (; s2 != simplex_set.end2(); ++s2) { append_star(*s2); }
 
-      for (; s0 != simplex_set.end0(); ++s0) { result.insert(closure(*s0)); }
-      for (; s1 != simplex_set.end1(); ++s1) { result.insert(closure(*s1)); }
-      for (; s2 != simplex_set.end2(); ++s2) { result.insert(closure(*s2)); }
+      flush(result);
+    }
 
-      return result;
+    void closure(Simplex2 const & s, SimplexSet & result) const
+    {
+      append_closure(s);
+      flush(result);
     }
 
-    SimplexSet link(Simplex0 const & s) const
+    void closure(Simplex1 const & s, SimplexSet & result) const
     {
-      SimplexSet sigma0 = closure(star(s));
-      SimplexSet sigma1 = star(closure(s));
+      append_closure(s);
+      flush(result);
+    }
 
-      return difference(sigma0, sigma1);
+    void closure(Simplex0 const & s, SimplexSet & result) const
+    {
+      append_closure(s);
+      flush(result);
     }
 
+    void closure(SimplexSet const & simplex_set, SimplexSet & result) const
+    {
+      SimplexSet::simplex0_const_iterator s0 = simplex_set.begin0();
+      SimplexSet::simplex1_const_iterator s1 = simplex_set.begin1();
+      SimplexSet::simplex2_const_iterator s2 = simplex_set.begin2();
+
+      for (; s0 != simplex_set.end0(); ++s0) { append_closure(*s0); }
+      for (; s1 != simplex_set.end1(); ++s1) { append_closure(*s1); }
+      for (; s2 != simplex_set.end2(); ++s2) { append_closure(*s2); }
+
+      flush(result);
+    }
+
+    /**
+     * The link of a vertex is closure(star(s)) minus star(closure(s)),
+     * that is the neighbouring vertices and the edges opposite to s in
+     * the faces around s. It is gathered directly from the 1-ring.
+     */
+    void link(Simplex0 const & s, SimplexSet & result) const
+    {
+      vertex_type const & v = *m_mesh.get_vertex_iterator(simplex_to_vertex(s));
+
+      typename mesh_type::const_vertex_edge_circulator e(v), eend;
+
+      for (; e != eend; ++e)
+      {
+        edge_handle const edge = e->get_handle();
+
+        if (!m_mesh.is_valid_edge_handle(edge))
+          continue;
+
+        Simplex1 const se = edge_to_simplex(edge);
+
+        m_buffer0.push_back( se.get_idx0() == s.get_idx0() ? se.get_simplex0_idx1() : se.get_simplex0_idx0() );
+
+        face_handle face0, face1;
+        get_faces_from_edge(edge, face0, face1);
+
+        if (m_mesh.is_valid_face_handle(face0)) append_opposite_edge(s, face0);
+        if (m_mesh.is_valid_face_handle(face1)) append_opposite_edge(s, face1);
+      }
+
+      flush(result);
+    }
+
+    /**
+     * Writing the submesh boundary flag through the returned reference
+     * is allowed, the classification near s is recomputed on next use.
+     */
     bool & submesh_boundary(Simplex0 const & s)
     {
+      declassify_neighborhood(s);
+
       return m_submesh_boundary[s].value;
     }
 
@@ -438,8 +809,9 @@ namespace grit
     {
       // 2015-12-04 Kenny: If no submesh exist then obvously no simplex0
       // can be a submesh boundary... this may occur if no decomposition
-      // is done..
-      if(m_submesh_boundary.size()==0)
+      // is done.. Vertices inserted after the last flag was written have
+      // no flag either.
+      if(s.get_idx0() >= m_submesh_boundary.size())
         return false;
 
       return m_submesh_boundary[s].value;
@@ -447,15 +819,12 @@ namespace grit
 
     bool is_submesh_boundary(Simplex1 const & s) const
     {
-      face_handle f1, f2;
-      get_faces_from_edge(simplex_to_edge(s), f1, f2);
+      edge_handle const e = simplex_to_edge(s);
 
-      if (m_mesh.is_valid_face_handle(f1) &&
-          m_mesh.is_valid_face_handle(f2))
-        return false; // if the mesh has an "ear" where both vertices are on the boundary, but the edge is not because it still has two faces
+      if (!m_mesh.is_valid_edge_handle(e))
+        return false;
 
-      return is_submesh_boundary(s.get_simplex0_idx0()) &&
-             is_submesh_boundary(s.get_simplex0_idx1());
+      return classification(e) & submesh_boundary_bit;
     }
 
     bool is_submesh_boundary(SimplexSet const & simplex_set) const
@@ -480,16 +849,10 @@ namespace grit
 
     bool is_boundary(edge_handle const & e) const
     {
-      face_handle f1, f2;
-      get_faces_from_edge(e, f1, f2);
-
-      if (!m_mesh.is_valid_face_handle(f1))
-        return !is_submesh_boundary(edge_to_simplex(e));
-
-      if (!m_mesh.is_valid_face_handle(f2))
-        return !is_submesh_boundary(edge_to_simplex(e));
+      if (!m_mesh.is_valid_edge_handle(e))
+        return false;
 
-      return false;
+      return classification(e) & boundary_bit;
     }
 
     bool is_boundary(Simplex1 const & s) const
@@ -499,43 +862,47 @@ namespace grit
 
     bool is_boundary(Simplex0 const & s) const
     {
-      vertex_type v = *m_mesh.get_vertex_iterator(s.get_idx0());
-      typename mesh_type::const_vertex_edge_circulator e(v), eend;
-
-      for (; e != eend; ++e)
-      {
-        if (is_boundary(e->get_handle()))
-          return true;
-      }
-
-      return false;
+      return classification(s) & boundary_bit;
     }
 
-    unsigned int & label(Simplex2 const & s)
+    /**
+     * The classification of the vertices and edges of s is recomputed on
+     * next use, and s moves to its new phase on the next phase query.
+     */
+    void set_label(Simplex2 const & s, unsigned int const & value)
     {
-      return m_phase[s];
+      face_handle const face = simplex_to_face(s);
+
+      if (!m_mesh.is_valid_face_handle(face))
+        throw std::out_of_range("OpenTissueMesh::set_label(): face is not in the mesh");
+
+      if (face_label(face) == value)
+        return;
+
+      face_label(face) = value;
+
+      declassify(s);
+
+      m_unindexed.push_back(s);
     }
 
     unsigned int const & label(Simplex2 const & s) const
     {
-      return m_phase[s];
+      face_handle const face = simplex_to_face(s);
+
+      if (!m_mesh.is_valid_face_handle(face))
+        throw std::out_of_range("OpenTissueMesh::label(): face is not in the mesh");
+
+      return face_label(face);
     }
 
     // 29-03-2015 Marek: this now only returns true for those interface edges, which do not lie on the boundary.
     bool is_interface(edge_handle const & e) const
     {
-      face_handle f1;
-      face_handle f2;
-
-	  if(m_mesh.is_valid_edge_handle(e))
-	  { 
-		get_faces_from_edge(e, f1, f2);
-	  }
-
-      if (m_mesh.is_valid_face_handle(f1) && m_mesh.is_valid_face_handle(f2))
-        return label(face_to_simplex(f1)) != label(face_to_simplex(f2));
+      if (!m_mesh.is_valid_edge_handle(e))
+        return false;
 
-      return false;
+      return classification(e) & interface_bit;
     }
 
     bool is_interface(Simplex1 const & s) const
@@ -545,16 +912,7 @@ namespace grit
 
     bool is_interface(Simplex0 const & s) const
     {
-      vertex_type v = *m_mesh.get_vertex_iterator(s.get_idx0());
-      typename mesh_type::const_vertex_edge_circulator e(v), eend;
-
-      for (; e != eend; ++e)
-      {
-        if (is_interface(e->get_handle()))
-          return true;
-      }
-
-      return false;
+      return classification(s) & interface_bit;
     }
 
     bool is_interface(SimplexSet const & simplex_set) const
@@ -700,7 +1058,29 @@ namespace grit
 
     void remove(Simplex2 const & s)
     {
-      m_mesh.remove_face(simplex_to_face(s));
+      face_handle const face = simplex_to_face(s);
+
+      if (!m_mesh.is_valid_face_handle(face))
+        return;
+
+      Simplex1 const edges[3] = {
+        Simplex1(s.get_idx0(), s.get_idx1())
+        , Simplex1(s.get_idx1(), s.get_idx2())
+        , Simplex1(s.get_idx2(), s.get_idx0())
+      };
+
+      declassify(s);
+
+      m_mesh.remove_face(face);
+      m_face_lut.erase(s);
+      m_unindexed.push_back(s);
+
+      // The mesh removes the edges that are no longer used by any face
+      for (unsigned int i = 0u; i < 3u; ++i)
+      {
+        if (!m_mesh.is_valid_edge_handle(simplex_to_edge(edges[i])))
+          m_edge_lut.erase(edges[i]);
+      }
     }
 
     void remove(SimplexSet const & simplex_set)
@@ -718,56 +1098,140 @@ namespace grit
     void replace(
                  SimplexSet const & old_simplices
                  , SimplexSet const & new_simplices
-                 , std::map<Simplex2,Simplex2> const & parent_lut
+                 , Simplex2LUT const & parent_lut
                  , details::Parameters const & parameters
                  )
     {
-      std::map<Simplex2, unsigned int> labels;
+      // The labels are kept in the same storage as the parent lookup table,
+      // in the order of the new faces, and are written by face handle
+      typedef util::ArenaAllocator<unsigned int>              label_allocator;
+      typedef std::vector<unsigned int, label_allocator>      label_vector;
+
+      label_vector labels( label_allocator( parent_lut.get_allocator() ) );
+
+      labels.reserve( new_simplices.size(2u) );
 
       SimplexSet::simplex2_const_iterator it = new_simplices.begin2();
       for( ; it != new_simplices.end2(); ++it)
       {
-        Simplex2 const & t = *it;
-        if( parent_lut.find(t) != parent_lut.end())
+        Simplex2LUT::const_iterator const parent = parent_lut.find(*it);
+
+        face_handle const parent_face = (parent != parent_lut.end())
+                                      ? simplex_to_face(parent->second)
+                                      : face_handle();
+
+        if( m_mesh.is_valid_face_handle(parent_face))
         {
-          labels[t] = label(parent_lut.at(t));
+          labels.push_back( face_label(parent_face) );
         }
         else
         {
           //--- If no ambient label is defined, crash.
           assert( parameters.use_ambient() || !"OpenTissueMesh::replace() label missing");
 
-          labels[t] = parameters.ambient_label();
+          labels.push_back( parameters.ambient_label() );
         }
       }
 
       remove(old_simplices);
 
       it = new_simplices.begin2();
-      for( ; it != new_simplices.end2(); ++it)
+      for( size_t i = 0u; it != new_simplices.end2(); ++it, ++i)
       {
         Simplex2 const & t = *it;
-        label(insert( t.get_idx0(), t.get_idx1(), t.get_idx2())) = labels[t];
+
+        face_handle const face = insert_face( t.get_idx0(), t.get_idx1(), t.get_idx2());
+
+        if (m_mesh.is_valid_face_handle(face))
+          face_label(face) = labels[i];
       }
 
     }
 
     Simplex2 insert(Simplex0 const & s0, Simplex0 const & s1, Simplex0 const & s2)
     {
-      vertex_handle v0 = vertex_handle(s0.get_idx0());
-      vertex_handle v1 = vertex_handle(s1.get_idx0());
-      vertex_handle v2 = vertex_handle(s2.get_idx0());
+      face_handle const face = insert_face(s0, s1, s2);
 
-      Simplex2 simplex = Simplex2(s0.get_idx0(), s1.get_idx0(), s2.get_idx0());
+      if (!m_mesh.is_valid_face_handle(face))
+        return Simplex2();
+
+      return face_to_simplex(face);
+    }
 
-      if (orientation(simplex) == negative)
+    /**
+     * When the mesh has no triangles, the triangles are oriented, and the
+     * connectivity is built in one pass with details::PolyMeshBuilder.
+     * Otherwise, or if the triangles do not form an oriented surface, they
+     * are inserted one by one.
+     */
+    void insert(
+                std::vector<Simplex0> const & triangles
+                , std::vector<unsigned int> const & labels
+                )
+    {
+      typedef details::PolyMeshBuilder<mesh_type> builder_type;
+
+      assert( triangles.size() == 3u*labels.size() || !"OpenTissueMesh::insert(): expected three vertices per label");
+
+      size_t const n = labels.size();
+
+      std::vector<vertex_handle> corners;
+      std::vector<face_handle>   faces;
+
+      corners.reserve(3u*n);
+
+      for (size_t i = 0u; i < n; ++i)
       {
-	    return face_to_simplex(m_mesh.add_face(v0, v1, v2));
+        Simplex0 const & s0 = triangles[3u*i];
+        Simplex0 const & s1 = triangles[3u*i + 1u];
+        Simplex0 const & s2 = triangles[3u*i + 2u];
+
+        bool const is_negative = orientation( Simplex2(s0.get_idx0(), s1.get_idx0(), s2.get_idx0()) ) == negative;
+
+        corners.push_back( vertex_handle(s0.get_idx0()) );
+        corners.push_back( vertex_handle(is_negative ? s1.get_idx0() : s2.get_idx0()) );
+        corners.push_back( vertex_handle(is_negative ? s2.get_idx0() : s1.get_idx0()) );
       }
-      else
+
+      if (!builder_type::build(m_mesh, corners, faces))
       {
-        return face_to_simplex(m_mesh.add_face(v0, v2, v1));
+        for (size_t i = 0u; i < n; ++i)
+        {
+          face_handle const face = insert_face( triangles[3u*i], triangles[3u*i + 1u], triangles[3u*i + 2u] );
+
+          if (m_mesh.is_valid_face_handle(face))
+            face_label(face) = labels[i];
+        }
+
+        return;
+      }
+
+      m_face_lut.reserve( m_face_lut.size() + n );
+      m_edge_lut.reserve( m_edge_lut.size() + m_mesh.size_edges() );
+
+      for (size_t i = 0u; i < n; ++i)
+      {
+        Simplex2 const t = Simplex2( triangles[3u*i].get_idx0(), triangles[3u*i + 1u].get_idx0(), triangles[3u*i + 2u].get_idx0() );
+
+        m_face_lut[t] = faces[i];
+
+        if (faces[i].get_idx() >= m_labels.size())
+          m_labels.resize(faces[i].get_idx() + 1u);
+
+        face_label(faces[i]) = labels[i];
+
+        m_unindexed.push_back(t);
       }
+
+      typename mesh_type::const_edge_iterator e    = m_mesh.edge_begin();
+      typename mesh_type::const_edge_iterator eend = m_mesh.edge_end();
+
+      for (; e != eend; ++e)
+        m_edge_lut[edge_to_simplex(e->get_handle())] = e->get_handle();
+
+      //--- Every vertex and edge touched by the new triangles must be classified again
+      m_vertex_bits.assign(m_vertex_bits.size(), 0u);
+      m_edge_bits.assign(m_edge_bits.size(), 0u);
     }
 
     Simplex0 insert()
@@ -803,28 +1267,37 @@ namespace grit
       typename mesh_type::const_face_iterator fend   = m_mesh.face_end();
       typename mesh_type::const_face_iterator f      = m_mesh.face_begin();
 
-      for (; v != vend; ++v) { simplex_set.insert(vertex_to_simplex(v->get_handle())); }
-      for (; e != eend; ++e) { simplex_set.insert(edge_to_simplex(e->get_handle())); }
-      for (; f != fend; ++f) { simplex_set.insert(face_to_simplex(f->get_handle())); }
+      std::vector<Simplex0> S0;
+      std::vector<Simplex1> S1;
+      std::vector<Simplex2> S2;
+
+      S0.reserve(m_mesh.size_vertices());
+      S1.reserve(m_mesh.size_edges());
+      S2.reserve(m_mesh.size_faces());
+
+      for (; v != vend; ++v) { S0.push_back(vertex_to_simplex(v->get_handle())); }
+      for (; e != eend; ++e) { S1.push_back(edge_to_simplex(e->get_handle())); }
+      for (; f != fend; ++f) { S2.push_back(face_to_simplex(f->get_handle())); }
+
+      simplex_set.insert(S0.begin(), S0.end());
+      simplex_set.insert(S1.begin(), S1.end());
+      simplex_set.insert(S2.begin(), S2.end());
 
       return simplex_set;
     }
 
-    SimplexSet get_simplices(unsigned int const & label_value) const
+    SimplexSet const & get_simplices(unsigned int const & label_value) const
     {
-      SimplexSet simplex_set;
+      update_phase_index();
 
-      typename mesh_type::const_face_iterator fend   = m_mesh.face_end();
-      typename mesh_type::const_face_iterator f      = m_mesh.face_begin();
+      return m_phase_index[label_value].m_faces;
+    }
 
-      for (; f != fend; ++f)
-      {
-        Simplex2 face = face_to_simplex(f->get_handle());
-        if ( label(face) == label_value)
-          simplex_set.insert(face);
-      }
+    SimplexSet const & get_phase(unsigned int const & label_value) const
+    {
+      update_phase_index();
 
-      return simplex_set;
+      return m_phase_index[label_value].m_closure;
     }
 
     void remove_all_simplices()
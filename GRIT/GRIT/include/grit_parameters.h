@@ -40,12 +40,16 @@ namespace grit
       LV                m_labels;                      ///< labels used by GRIT, in the same order as m_input_labels
       unsigned int      m_ambient_label;               ///< label of the ambient (vacuum) phase
       unsigned int      m_number_of_subdomains;        ///< number of subdomains used by GRIT (equal to the number of threads)
+      unsigned int      m_over_decomposition;          ///< number of subdomains created per thread, more subdomains than threads let idle threads pick up remaining work
       unsigned int      m_debug_render_level;          ///< the "size" of the neighborhood to be output in the debug render
       bool              m_make_unit;                   ///< a flag notifying whether the domain should be scaled to [0,1]x[0,1] at initialization
       bool              m_profiling;                   ///< a flag to switch profiling on/off
       bool              m_verbose;                     ///< a flag specifying verbosity of the log output
       bool              m_debug_render;                ///< a flat to switch visual debugging on/off
       bool              m_silent_threads;              ///< a flag for switching on/off in-thread console output, false only for debugging purposes or in single-threaded case
+      bool              m_pin_threads;                 ///< a flag for binding each worker thread to its own CPU core (Linux only)
+      bool              m_inertial_bisection;          ///< a flag for cutting across the principal axis instead of a coordinate axis in the bisection decomposition
+      bool              m_run_in_place;                ///< a flag for letting the threads work on regions of the global mesh, instead of on copied and merged submeshes
       bool              m_use_ambient;                 ///< a flag for switching on/off use of the ambient phase
       bool              m_use_one_phase_style;         ///< a flag for switching on/off the drawing of multiple phases as one
       bool              m_use_only_interface;          ///< a flag for switching on/off moving the entire phase (instead of just interface)
@@ -55,6 +59,7 @@ namespace grit
       bool              m_no_multiple_vertices;        ///< a flag telling whether one allows an initial mesh to have multiple vertices with same coordinates
       bool              m_use_sparse_edge_attributes;  ///< a flag telling whether one uses sparse edge attributes, and switches off attribute "smearing"
       double            m_multiple_vertices_threshold; ///< the accuracy/precision used to test if two vertices have the same coordinates.
+      double            m_interface_work;              ///< the extra work estimated for a triangle touching the interface when balancing subdomains, 0 balances triangle counts
 
       std::string       m_debug_render_filename;       ///< the filename of the debug render SVG.
 
@@ -66,12 +71,16 @@ namespace grit
       LV                const & labels()                const { return m_labels;               }
       unsigned int      const & ambient_label()         const { return m_ambient_label;        }
       unsigned int      const & number_of_subdomains()  const { return m_number_of_subdomains; }
+      unsigned int      const & over_decomposition()    const { return m_over_decomposition;   }
       unsigned int      const & debug_render_level()    const { return m_debug_render_level;   }
       bool              const & make_unit()             const { return m_make_unit;            }
       bool              const & profiling()             const { return m_profiling;            }
       bool              const & verbose()               const { return m_verbose;              }
       bool              const & debug_render()          const { return m_debug_render;         }
       bool              const & silent_threads()        const { return m_silent_threads;       }
+      bool              const & pin_threads()           const { return m_pin_threads;          }
+      bool              const & inertial_bisection()    const { return m_inertial_bisection;   }
+      bool              const & run_in_place()          const { return m_run_in_place;         }
       bool              const & use_ambient()           const { return m_use_ambient;          }
       bool              const & use_one_phase_style()   const { return m_use_one_phase_style;  }
       bool              const & use_only_interface()    const { return m_use_only_interface;   }
@@ -81,6 +90,7 @@ namespace grit
       bool              const & no_multiple_vertices()  const { return m_no_multiple_vertices; }
       bool              const & use_sparse_edge_attributes()  const { return m_use_sparse_edge_attributes;  }
       double            const & multiple_vertices_threshold() const { return m_multiple_vertices_threshold; }
+      double            const & interface_work()              const { return m_interface_work;              }
       std::string       const & debug_render_filename()       const { return m_debug_render_filename;       }
 
       std::vector< std::string> const & operation_names() const { return m_operation_names; }
@@ -89,12 +99,16 @@ namespace grit
 
       unsigned int      & ambient_label()        { return m_ambient_label;        }
       unsigned int      & number_of_subdomains() { return m_number_of_subdomains; }
+      unsigned int      & over_decomposition()   { return m_over_decomposition;   }
       unsigned int      & debug_render_level()   { return m_debug_render_level;   }
       bool              & make_unit()            { return m_make_unit;            }
       bool              & profiling()            { return m_profiling;            }
       bool              & verbose()              { return m_verbose;              }
       bool              & debug_render()         { return m_debug_render;         }
       bool              & silent_threads()       { return m_silent_threads;       }
+      bool              & pin_threads()          { return m_pin_threads;          }
+      bool              & inertial_bisection()   { return m_inertial_bisection;   }
+      bool              & run_in_place()         { return m_run_in_place;         }
       bool              & use_ambient()          { return m_use_ambient;          }
       bool              & use_one_phase_style()  { return m_use_one_phase_style;  }
       bool              & use_only_interface()   { return m_use_only_interface;   }
@@ -104,6 +118,7 @@ namespace grit
       bool              & no_multiple_vertices() { return m_no_multiple_vertices; }
       bool              & use_sparse_edge_attributes()  { return m_use_sparse_edge_attributes;  }
       double            & multiple_vertices_threshold() { return m_multiple_vertices_threshold; }
+      double            & interface_work()              { return m_interface_work;              }
       std::string       & debug_render_filename()       { return m_debug_render_filename;       }
 
     public:
@@ -111,12 +126,16 @@ namespace grit
       Parameters()
       : m_ambient_label(0u)
       , m_number_of_subdomains(1u)
+      , m_over_decomposition(1u)
       , m_debug_render_level(0u)
       , m_make_unit(true)
       , m_profiling(false)
       , m_verbose(true)
       , m_debug_render(false)
       , m_silent_threads(true)
+      , m_pin_threads(false)
+      , m_inertial_bisection(false)
+      , m_run_in_place(false)
       , m_use_ambient(true)
       , m_use_one_phase_style(false)
       , m_use_only_interface(true)
@@ -126,6 +145,7 @@ namespace grit
       , m_no_multiple_vertices(true)
       , m_use_sparse_edge_attributes(false)
       , m_multiple_vertices_threshold(0.0001)
+      , m_interface_work(0.0)
       , m_debug_render_filename("./output/debug.svg")
       {}
 
@@ -561,12 +581,16 @@ namespace grit
     details::Parameters parameters;
 
     parameters.number_of_subdomains()  = util::to_value< unsigned int>( cfg.get_value( "number_of_subdomains",  "1"      ));
+    parameters.over_decomposition()    = util::to_value< unsigned int>( cfg.get_value( "over_decomposition",    "1"      ));
     parameters.debug_render_level()    = util::to_value< unsigned int>( cfg.get_value( "debug_render_level",    "0"      ));
     parameters.make_unit()             = util::to_value< bool>(         cfg.get_value( "make_unit",             "true"   ));
     parameters.profiling()             = util::to_value< bool>(         cfg.get_value( "profiling",             "false"  ));
     parameters.verbose()               = util::to_value< bool>(         cfg.get_value( "verbose",               "true"   ));
     parameters.debug_render()          = util::to_value< bool>(         cfg.get_value( "debug_render",          "false"  ));
     parameters.silent_threads()        = util::to_value< bool>(         cfg.get_value( "silent_threads",        "true"   ));
+    parameters.pin_threads()           = util::to_value< bool>(         cfg.get_value( "pin_threads",           "false"  ));
+    parameters.inertial_bisection()    = util::to_value< bool>(         cfg.get_value( "inertial_bisection",    "false"  ));
+    parameters.run_in_place()          = util::to_value< bool>(         cfg.get_value( "run_in_place",          "false"  ));
 
     parameters.debug_render_filename() = cfg.get_value( "debug_render_filename", "");
 
@@ -591,6 +615,7 @@ namespace grit
     parameters.no_ears()                     = util::to_value< bool>(          cfg.get_value( "no_ears",                     "false") );
     parameters.no_multiple_vertices()        = util::to_value< bool>(          cfg.get_value( "no_multiple_vertices",        "true")  );
     parameters.multiple_vertices_threshold() = util::to_value< double>(        cfg.get_value( "multiple_vertices_threshold", "0.001") );
+    parameters.interface_work()              = util::to_value< double>(        cfg.get_value( "interface_work",              "0")     );
     parameters.use_simple_boundary()         = util::to_value< bool>(          cfg.get_value( "use_simple_boundary",         "true")  );
     parameters.use_sparse_edge_attributes()  = util::to_value< bool>(          cfg.get_value( "use_sparse_edge_attributes",  "false") );
 
@@ -0,0 +1,311 @@
+#ifndef GRIT_POLYMESH_BUILDER_H
+#define GRIT_POLYMESH_BUILDER_H
+
+#include <grit_polymesh_kernel_access.h>
+
+#include <OpenTissue/core/containers/mesh/polymesh/polymesh_core_access.h>
+
+#include <vector>
+#include <algorithm>  // Needed for std::sort and std::lower_bound
+#include <utility>    // Needed for std::pair
+#include <cstddef>    // Needed for std::size_t
+#include <cassert>
+
+namespace grit
+{
+  namespace details
+  {
+
+    /**
+     * Bulk construction of polymesh connectivity.
+     *
+     * Adding triangles one by one with add_face() searches the one-ring of
+     * every corner for existing halfedges and patches the boundary loops
+     * around each new face. When a whole mesh is built at once the twin
+     * of every halfedge can instead be found by sorting all directed edges
+     * once, and the boundary loops can be linked in a single pass at the
+     * end, so building the mesh takes O(n log n) time with small constants.
+     *
+     * Faces, edges and halfedges are created in the same order as repeated
+     * calls to add_face() would create them, so the resulting handles are
+     * the same as when the mesh is built face by face.
+     *
+     * Records are created through PolyMeshKernelAccess, which the GRIT
+     * kernels grant access to their protected create functions, and are
+     * linked up through polymesh_core_access.
+     *
+     * @tparam mesh_type   An OpenTissue polymesh type with one of the GRIT
+     *                     kernels, PolyMeshListKernel or PolyMeshVectorKernel.
+     */
+    template<typename mesh_type>
+    class PolyMeshBuilder
+    {
+    public:
+
+      typedef typename mesh_type::index_type           index_type;
+      typedef typename mesh_type::vertex_handle        vertex_handle;
+      typedef typename mesh_type::halfedge_handle      halfedge_handle;
+      typedef typename mesh_type::edge_handle          edge_handle;
+      typedef typename mesh_type::face_handle          face_handle;
+
+      typedef typename mesh_type::vertex_iterator      vertex_iterator;
+      typedef typename mesh_type::halfedge_iterator    halfedge_iterator;
+      typedef typename mesh_type::edge_iterator        edge_iterator;
+      typedef typename mesh_type::face_iterator        face_iterator;
+
+    protected:
+
+      typedef OpenTissue::polymesh::polymesh_core_access  access;
+      typedef PolyMeshKernelAccess                        kernel_access;
+
+      typedef std::pair<index_type, index_type>           key_type;    ///< A directed edge, the origin and destination vertex indices.
+      typedef std::pair<key_type, std::size_t>            corner_type; ///< A directed edge and the face corner it starts at.
+
+      static key_type make_key(vertex_handle const & from, vertex_handle const & to)
+      {
+        return key_type( from.get_idx(), to.get_idx() );
+      }
+
+      static bool has_key(std::vector<corner_type> const & directed, key_type const & key)
+      {
+        typename std::vector<corner_type>::const_iterator const lookup = std::lower_bound(
+                                                                                         directed.begin()
+                                                                                         , directed.end()
+                                                                                         , corner_type( key, 0u )
+                                                                                         );
+
+        return lookup != directed.end() && lookup->first == key;
+      }
+
+    public:
+
+      /**
+       * Adds triangles to a mesh that has vertices but no faces or edges.
+       *
+       * @param mesh       The mesh to build.
+       * @param corners    Three vertex handles per triangle, in the order
+       *                   add_face() would get them.
+       * @param faces      Upon return holds the handle of each triangle.
+       *
+       * @return           False if the mesh already had edges, if a vertex
+       *                   handle was invalid, if a triangle had a repeated
+       *                   vertex, or if two triangles had a directed edge in
+       *                   common (that is, they were not consistently
+       *                   oriented or were duplicates), or if the boundary
+       *                   of the triangles could not be split into closed
+       *                   loops. The mesh is left untouched in that case.
+       */
+      static bool build(
+                        mesh_type                          & mesh
+                        , std::vector<vertex_handle> const & corners
+                        , std::vector<face_handle>         & faces
+                        )
+      {
+        std::size_t const n = corners.size() / 3u;
+
+        faces.clear();
+
+        if (mesh.size_halfedges() > 0u || mesh.size_faces() > 0u || corners.size() != 3u*n)
+          return false;
+
+        //--- Find the directed edge of every face corner, and check that
+        //--- the triangles form an oriented surface before changing anything
+        std::vector<corner_type> directed(3u*n);
+
+        for (std::size_t c = 0u; c < 3u*n; ++c)
+        {
+          vertex_handle const & from = corners[c];
+          vertex_handle const & to   = corners[ c - c%3u + (c+1u)%3u ];
+
+          if (!mesh.is_valid_vertex_handle(from) || from == to)
+            return false;
+
+          directed[c] = corner_type( make_key(from, to), c );
+        }
+
+        std::sort(directed.begin(), directed.end());
+
+        for (std::size_t i = 1u; i < directed.size(); ++i)
+        {
+          if (directed[i].first == directed[i-1u].first)
+            return false;
+        }
+
+        //--- A directed edge without a reverse is on the boundary, its
+        //--- reverse becomes a boundary halfedge. The boundary loops can only
+        //--- be closed if every vertex has as many incoming as outgoing
+        //--- boundary halfedges
+        std::vector<index_type> boundary_origins;
+        std::vector<index_type> boundary_destinations;
+
+        for (std::size_t i = 0u; i < directed.size(); ++i)
+        {
+          key_type const & key = directed[i].first;
+
+          if (!has_key(directed, key_type(key.second, key.first)))
+          {
+            boundary_origins.push_back( key.second );
+            boundary_destinations.push_back( key.first );
+          }
+        }
+
+        std::sort(boundary_origins.begin(), boundary_origins.end());
+        std::sort(boundary_destinations.begin(), boundary_destinations.end());
+
+        if (boundary_origins != boundary_destinations)
+          return false;
+
+        //--- Create the faces in order. Like add_face(), a halfedge pair and
+        //--- its edge are created the first time a face uses the edge, and
+        //--- the face itself is created after its new edges
+        std::vector<halfedge_handle> inner(3u*n);
+
+        faces.resize(n);
+
+        for (std::size_t f = 0u; f < n; ++f)
+        {
+          for (std::size_t k = 0u; k < 3u; ++k)
+          {
+            std::size_t   const c    = 3u*f + k;
+            vertex_handle const from = corners[c];
+            vertex_handle const to   = corners[3u*f + (k+1u)%3u];
+
+            typename std::vector<corner_type>::const_iterator const twin = std::lower_bound(
+                                                                                            directed.begin()
+                                                                                            , directed.end()
+                                                                                            , corner_type( make_key(to, from), 0u )
+                                                                                            );
+
+            if (twin != directed.end() && twin->first == make_key(to, from) && twin->second < c)
+            {
+              inner[c] = mesh.get_halfedge_iterator( inner[twin->second] )->get_twin_handle();
+              continue;
+            }
+
+            halfedge_handle const h = kernel_access::create_halfedge(mesh);
+            halfedge_handle const t = kernel_access::create_halfedge(mesh);
+            edge_handle     const e = kernel_access::create_edge(mesh);
+
+            halfedge_iterator const hit = mesh.get_halfedge_iterator(h);
+            halfedge_iterator const tit = mesh.get_halfedge_iterator(t);
+            edge_iterator     const eit = mesh.get_edge_iterator(e);
+
+            access::set_owner(hit, &mesh);
+            access::set_face_handle(hit, mesh.null_face_handle());
+            access::set_twin_handle(hit, t);
+            access::set_destination_handle(hit, to);
+            access::set_edge_handle(hit, e);
+
+            access::set_owner(tit, &mesh);
+            access::set_face_handle(tit, mesh.null_face_handle());
+            access::set_twin_handle(tit, h);
+            access::set_destination_handle(tit, from);
+            access::set_edge_handle(tit, e);
+
+            access::set_owner(eit, &mesh);
+            access::set_halfedge0_handle(eit, h);
+            access::set_halfedge1_handle(eit, t);
+
+            inner[c] = h;
+          }
+
+          face_handle   const face = kernel_access::create_face(mesh);
+          face_iterator const fit  = mesh.get_face_iterator(face);
+
+          access::set_owner(fit, &mesh);
+          access::set_border_halfedge_handle(fit, inner[3u*f + 2u]);
+
+          for (std::size_t k = 0u; k < 3u; ++k)
+          {
+            halfedge_iterator const hit = mesh.get_halfedge_iterator( inner[3u*f + k] );
+
+            access::set_face_handle(hit, face);
+            access::set_next_handle(hit, inner[3u*f + (k+1u)%3u]);
+          }
+
+          faces[f] = face;
+        }
+
+        //--- Every vertex points to an outgoing halfedge. Like add_face() it
+        //--- must be a boundary halfedge, if the vertex has one
+        for (std::size_t c = 0u; c < 3u*n; ++c)
+        {
+          vertex_iterator const v = mesh.get_vertex_iterator( corners[c] );
+
+          if (v->get_outgoing_halfedge_handle().is_null())
+            access::set_outgoing_halfedge_handle(v, inner[c]);
+        }
+
+        //--- The halfedges not used by any face form the boundary loops. A
+        //--- boundary halfedge is followed by a boundary halfedge leaving
+        //--- its destination. A vertex where several boundary loops meet
+        //--- has as many incoming as outgoing boundary halfedges, and any
+        //--- pairing of these gives valid loops
+        std::vector< std::pair<index_type, halfedge_handle> > outgoing;
+
+        for (std::size_t c = 0u; c < 3u*n; ++c)
+        {
+          halfedge_handle   const t   = mesh.get_halfedge_iterator( inner[c] )->get_twin_handle();
+          halfedge_iterator const tit = mesh.get_halfedge_iterator( t );
+
+          if (tit->get_face_handle().is_null())
+          {
+            outgoing.push_back( std::make_pair( corners[3u*(c/3u) + (c+1u)%3u].get_idx(), t ) );
+
+            access::set_outgoing_halfedge_handle( mesh.get_vertex_iterator( corners[3u*(c/3u) + (c+1u)%3u] ), t );
+          }
+        }
+
+        std::sort(outgoing.begin(), outgoing.end(), less_origin);
+
+        std::vector<bool> is_linked(outgoing.size(), false);
+
+        for (std::size_t i = 0u; i < outgoing.size(); ++i)
+        {
+          halfedge_iterator const bit  = mesh.get_halfedge_iterator( outgoing[i].second );
+          index_type        const dest = bit->get_destination_handle().get_idx();
+
+          std::size_t j = std::lower_bound(
+                                           outgoing.begin()
+                                           , outgoing.end()
+                                           , std::make_pair( dest, halfedge_handle() )
+                                           , less_origin
+                                           ) - outgoing.begin();
+
+          // The check above guarantees that an unlinked boundary halfedge
+          // leaves dest
+          while (j < outgoing.size() && outgoing[j].first == dest && is_linked[j])
+            ++j;
+
+          if (j == outgoing.size() || outgoing[j].first != dest)
+          {
+            assert(!"PolyMeshBuilder::build(): boundary loops could not be closed");
+            return false;
+          }
+
+          is_linked[j] = true;
+
+          access::set_next_handle( bit, outgoing[j].second );
+        }
+
+        return true;
+      }
+
+    protected:
+
+      static bool less_origin(
+                              std::pair<index_type, halfedge_handle> const & a
+                              , std::pair<index_type, halfedge_handle> const & b
+                              )
+      {
+        return a.first < b.first;
+      }
+
+    };
+
+  } // namespace details
+
+} // namespace grit
+
+// GRIT_POLYMESH_BUILDER_H
+#endif
@@ -0,0 +1,53 @@
+#ifndef GRIT_POLYMESH_KERNEL_ACCESS_H
+#define GRIT_POLYMESH_KERNEL_ACCESS_H
+
+namespace grit
+{
+  namespace details
+  {
+
+    /**
+     * Access to the protected create functions of the GRIT polymesh
+     * kernels. The kernels make this class a friend, so GRIT code such as
+     * PolyMeshBuilder can create records without going through add_face().
+     * The OpenTissue sources are not changed for this.
+     *
+     * The records are created without any connectivity, the caller must
+     * link them up before the mesh is used.
+     */
+    class PolyMeshKernelAccess
+    {
+    public:
+
+      template<typename mesh_type>
+      static typename mesh_type::halfedge_handle create_halfedge(mesh_type & mesh)
+      {
+        typename mesh_type::kernel_type & kernel = mesh;
+
+        return kernel.create_halfedge();
+      }
+
+      template<typename mesh_type>
+      static typename mesh_type::edge_handle create_edge(mesh_type & mesh)
+      {
+        typename mesh_type::kernel_type & kernel = mesh;
+
+        return kernel.create_edge();
+      }
+
+      template<typename mesh_type>
+      static typename mesh_type::face_handle create_face(mesh_type & mesh)
+      {
+        typename mesh_type::kernel_type & kernel = mesh;
+
+        return kernel.create_face();
+      }
+
+    };
+
+  } // namespace details
+
+} // namespace grit
+
+// GRIT_POLYMESH_KERNEL_ACCESS_H
+#endif
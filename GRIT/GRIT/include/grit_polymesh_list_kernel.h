@@ -0,0 +1,37 @@
+#ifndef GRIT_POLYMESH_LIST_KERNEL_H
+#define GRIT_POLYMESH_LIST_KERNEL_H
+
+#include <grit_polymesh_kernel_access.h>
+
+#include <OpenTissue/core/containers/mesh/polymesh/kernels/polymesh_list_kernel.h>
+
+namespace grit
+{
+
+  /**
+   * List based PolyMesh kernel.
+   *
+   * This is OpenTissue::polymesh::PolyMeshListKernel, extended only so the
+   * GRIT mesh builder can create records directly, see
+   * details::PolyMeshKernelAccess. Use it instead of the OpenTissue kernel
+   * wherever a mesh is built with details::PolyMeshBuilder.
+   */
+  template<
+      typename V
+    , typename H
+    , typename E
+    , typename F
+  >
+  class PolyMeshListKernel
+    : public OpenTissue::polymesh::PolyMeshListKernel<V,H,E,F>
+  {
+  protected:
+
+    friend class details::PolyMeshKernelAccess;
+
+  };
+
+} // namespace grit
+
+// GRIT_POLYMESH_LIST_KERNEL_H
+#endif
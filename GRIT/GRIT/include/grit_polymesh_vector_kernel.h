@@ -0,0 +1,790 @@
+#ifndef GRIT_POLYMESH_VECTOR_KERNEL_H
+#define GRIT_POLYMESH_VECTOR_KERNEL_H
+
+#include <grit_polymesh_kernel_access.h>
+
+#include <OpenTissue/core/containers/mesh/polymesh/polymesh_core_access.h>
+
+#include <boost/none.hpp>
+
+#include <vector>
+#include <iterator>   // Needed for std::forward_iterator_tag
+#include <cstddef>    // Needed for std::size_t and std::ptrdiff_t
+#include <cassert>
+
+namespace grit
+{
+  namespace details
+  {
+
+    /**
+     * Record storage used by PolyMeshVectorKernel.
+     *
+     * Records are stored in chunks of contiguous memory, so the address of
+     * a record never changes while it is alive. The first two chunks hold
+     * first_chunk_size records each and every following chunk is twice the
+     * size of the previous one, thus small meshes stay small and large
+     * meshes use few large chunks.
+     *
+     * Each record is identified by its slot number. Slots of released
+     * records are put on a free list and reused by later allocations.
+     *
+     * @tparam T   The record type, must be default constructible and assignable.
+     */
+    template<typename T>
+    class PolyMeshVectorStore
+    {
+    public:
+
+      static std::size_t const first_chunk_bits = 6u;
+      static std::size_t const first_chunk_size = 1u << first_chunk_bits;
+
+    protected:
+
+      std::vector< std::vector<T> >  m_chunks;   ///< Record storage, chunk k > 0 holds the slots [2^(k-1), 2^k) * first_chunk_size.
+      std::vector<unsigned char>     m_used;     ///< Per slot flag telling if the slot holds a live record.
+      std::vector<std::size_t>       m_free;     ///< Slots that have been released and can be reused.
+      std::size_t                    m_size;     ///< Number of live records.
+
+    public:
+
+      PolyMeshVectorStore()
+      : m_size(0u)
+      {}
+
+    public:
+
+      T       & operator[](std::size_t const & slot)
+      {
+        std::size_t const k = chunk(slot);
+        return m_chunks[k][ slot - chunk_begin(k) ];
+      }
+
+      T const & operator[](std::size_t const & slot) const
+      {
+        std::size_t const k = chunk(slot);
+        return m_chunks[k][ slot - chunk_begin(k) ];
+      }
+
+      bool used(std::size_t const & slot) const { return m_used[slot] != 0u; }
+
+      /**
+       * @return  The number of slots ever allocated, i.e. one past the last slot.
+       */
+      std::size_t slots() const { return m_used.size(); }
+
+      /**
+       * @return  The number of live records.
+       */
+      std::size_t size() const { return m_size; }
+
+      /**
+       * @return  The first slot at or after the given slot that holds a live
+       *          record, or slots() if there is none.
+       */
+      std::size_t first_used(std::size_t slot) const
+      {
+        std::size_t const end = m_used.size();
+
+        while (slot < end && !m_used[slot])
+          ++slot;
+
+        return slot;
+      }
+
+      /**
+       * Allocates a slot holding a default constructed record.
+       */
+      std::size_t allocate()
+      {
+        std::size_t slot;
+
+        if (!m_free.empty())
+        {
+          slot = m_free.back();
+          m_free.pop_back();
+        }
+        else
+        {
+          slot = m_used.size();
+
+          if (chunk(slot) == m_chunks.size())
+          {
+            m_chunks.push_back( std::vector<T>( chunk_size(m_chunks.size()) ) );
+          }
+
+          m_used.push_back(0u);
+        }
+
+        m_used[slot] = 1u;
+        ++m_size;
+
+        return slot;
+      }
+
+      /**
+       * Releases a slot. The record is reset to a default constructed one.
+       */
+      void release(std::size_t const & slot)
+      {
+        assert( used(slot) || !"release(): slot is not in use");
+
+        (*this)[slot] = T();
+
+        m_used[slot] = 0u;
+        m_free.push_back(slot);
+        --m_size;
+      }
+
+      void clear()
+      {
+        m_chunks.clear();
+        m_used.clear();
+        m_free.clear();
+        m_size = 0u;
+      }
+
+    protected:
+
+      /**
+       * @return  The index of the chunk holding the given slot.
+       */
+      static std::size_t chunk(std::size_t const & slot)
+      {
+        std::size_t const i = slot >> first_chunk_bits;
+
+        if (i == 0u)
+          return 0u;
+
+#if defined(__GNUC__)
+        return sizeof(unsigned long long)*8u - __builtin_clzll(i);
+#else
+        std::size_t k = 0u;
+        for (std::size_t j = i; j > 0u; j >>= 1u)
+          ++k;
+        return k;
+#endif
+      }
+
+      static std::size_t chunk_begin(std::size_t const & k)
+      {
+        return k == 0u ? 0u : (first_chunk_size << (k - 1u));
+      }
+
+      static std::size_t chunk_size(std::size_t const & k)
+      {
+        return k == 0u ? first_chunk_size : (first_chunk_size << (k - 1u));
+      }
+
+    };
+
+    /**
+     * Forward iterator over the live records of a PolyMeshVectorStore.
+     *
+     * The iterator refers to a record by its slot number, and caches the
+     * address of the record. It stays valid when other records are created
+     * or erased.
+     *
+     * @tparam S   The store type (const qualified for constant iterators).
+     * @tparam T   The record type (const qualified for constant iterators).
+     */
+    template<typename S, typename T>
+    class PolyMeshVectorIterator
+    {
+    public:
+
+      typedef std::forward_iterator_tag  iterator_category;
+      typedef T                          value_type;
+      typedef std::ptrdiff_t             difference_type;
+      typedef T *                        pointer;
+      typedef T &                        reference;
+
+    protected:
+
+      template<typename S2, typename T2>
+      friend class PolyMeshVectorIterator;
+
+      S           * m_store;
+      std::size_t   m_slot;
+      T           * m_record;
+
+    public:
+
+      PolyMeshVectorIterator()
+      : m_store(0)
+      , m_slot(0u)
+      , m_record(0)
+      {}
+
+      PolyMeshVectorIterator(S * store, std::size_t const & slot, T * record)
+      : m_store(store)
+      , m_slot(slot)
+      , m_record(record)
+      {}
+
+      /**
+       * Allows converting mutable iterators to constant ones.
+       */
+      template<typename S2, typename T2>
+      PolyMeshVectorIterator(PolyMeshVectorIterator<S2,T2> const & i)
+      : m_store(i.m_store)
+      , m_slot(i.m_slot)
+      , m_record(i.m_record)
+      {}
+
+    public:
+
+      reference operator*()  const { return *m_record; }
+      pointer   operator->() const { return  m_record; }
+
+      PolyMeshVectorIterator & operator++()
+      {
+        m_slot   = m_store->first_used(m_slot + 1u);
+        m_record = m_slot < m_store->slots() ? &(*m_store)[m_slot] : 0;
+        return *this;
+      }
+
+      PolyMeshVectorIterator operator++(int)
+      {
+        PolyMeshVectorIterator tmp = *this;
+        ++(*this);
+        return tmp;
+      }
+
+      bool operator==(PolyMeshVectorIterator const & i) const { return m_slot == i.m_slot && m_store == i.m_store; }
+      bool operator!=(PolyMeshVectorIterator const & i) const { return !(*this == i); }
+
+    };
+
+    /**
+     * Optional iterator, used by the OpenTissue circulators and by
+     * insert_face() for iterators that may not be set yet.
+     *
+     * Provides the part of the boost::optional interface that these use.
+     * Unlike boost::optional the iterator is always constructed, an unset
+     * optional holds a null iterator, so no uninitialized storage is ever
+     * read when optionals are copied or compared.
+     *
+     * @tparam I   A PolyMeshVectorIterator type.
+     */
+    template<typename I>
+    class PolyMeshVectorOptional
+    {
+    protected:
+
+      I     m_iterator;
+      bool  m_initialized;
+
+    public:
+
+      PolyMeshVectorOptional()
+      : m_iterator()
+      , m_initialized(false)
+      {}
+
+      PolyMeshVectorOptional(boost::none_t)
+      : m_iterator()
+      , m_initialized(false)
+      {}
+
+      PolyMeshVectorOptional(I const & i)
+      : m_iterator(i)
+      , m_initialized(true)
+      {}
+
+    public:
+
+      I const & get() const
+      {
+        assert(m_initialized || !"PolyMeshVectorOptional::get(): not initialized");
+        return m_iterator;
+      }
+
+      I const & operator*()  const { return get(); }
+      I const * operator->() const { return &get(); }
+
+      bool is_initialized() const { return m_initialized; }
+
+      bool operator==(PolyMeshVectorOptional const & o) const
+      {
+        return m_initialized == o.m_initialized && (!m_initialized || m_iterator == o.m_iterator);
+      }
+
+      bool operator!=(PolyMeshVectorOptional const & o) const { return !(*this == o); }
+
+      friend bool operator==(boost::none_t, PolyMeshVectorOptional const & o) { return !o.m_initialized; }
+      friend bool operator==(PolyMeshVectorOptional const & o, boost::none_t) { return !o.m_initialized; }
+      friend bool operator!=(boost::none_t, PolyMeshVectorOptional const & o) { return  o.m_initialized; }
+      friend bool operator!=(PolyMeshVectorOptional const & o, boost::none_t) { return  o.m_initialized; }
+
+    };
+
+    /**
+     * All features of one type (i.e. all vertices) of a PolyMeshVectorKernel.
+     *
+     * Features are identified by an index that is handed out in increasing
+     * order and never reused. A lookup table maps the index of every feature
+     * to the address and slot of its record in a PolyMeshVectorStore.
+     */
+    template<typename T>
+    class PolyMeshVectorTable
+    {
+    public:
+
+      typedef PolyMeshVectorStore<T>                             store_type;
+      typedef PolyMeshVectorIterator<store_type, T>              iterator;
+      typedef PolyMeshVectorIterator<store_type const, T const>  const_iterator;
+
+    protected:
+
+      struct Entry
+      {
+        T           * m_record;  ///< Address of the record, null if the feature was erased.
+        std::size_t   m_slot;    ///< Slot of the record in the store.
+      };
+
+      store_type           m_store;
+      std::vector<Entry>   m_lut;
+
+    public:
+
+      PolyMeshVectorTable() {}
+
+      PolyMeshVectorTable(PolyMeshVectorTable const & table) { *this = table; }
+
+      /**
+       * Copies the records slot by slot, so the copy has the same indices
+       * and slots as the original. Only the record addresses change.
+       */
+      PolyMeshVectorTable & operator=(PolyMeshVectorTable const & table)
+      {
+        if (this != &table)
+        {
+          m_store = table.m_store;
+          m_lut   = table.m_lut;
+
+          for (std::size_t idx = 0u; idx < m_lut.size(); ++idx)
+          {
+            if (m_lut[idx].m_record)
+              m_lut[idx].m_record = &m_store[ m_lut[idx].m_slot ];
+          }
+        }
+        return *this;
+      }
+
+    public:
+
+      iterator       begin()       { return make_iterator( m_store.first_used(0u) ); }
+      iterator       end()         { return iterator( &m_store, m_store.slots(), 0 ); }
+      const_iterator begin() const { return make_iterator( m_store.first_used(0u) ); }
+      const_iterator end()   const { return const_iterator( &m_store, m_store.slots(), 0 ); }
+
+      std::size_t size() const { return m_store.size(); }
+
+      /**
+       * @return  The index of a new default constructed feature.
+       */
+      std::size_t create()
+      {
+        Entry entry;
+
+        entry.m_slot   = m_store.allocate();
+        entry.m_record = &m_store[entry.m_slot];
+
+        m_lut.push_back(entry);
+
+        return m_lut.size() - 1u;
+      }
+
+      void erase(std::size_t const & idx)
+      {
+        assert(idx < m_lut.size());
+
+        if (m_lut[idx].m_record)
+        {
+          m_store.release( m_lut[idx].m_slot );
+          m_lut[idx].m_record = 0;
+        }
+      }
+
+      bool is_valid(std::size_t const & idx) const
+      {
+        assert(idx < m_lut.size());
+
+        return m_lut[idx].m_record != 0;
+      }
+
+      /**
+       * @return  An iterator to the feature with the given index, the feature
+       *          must not have been erased.
+       */
+      iterator find(std::size_t const & idx)
+      {
+        assert(idx < m_lut.size());
+
+        return iterator( &m_store, m_lut[idx].m_slot, m_lut[idx].m_record );
+      }
+
+      const_iterator find(std::size_t const & idx) const
+      {
+        assert(idx < m_lut.size());
+
+        return const_iterator( &m_store, m_lut[idx].m_slot, m_lut[idx].m_record );
+      }
+
+      void clear()
+      {
+        m_store.clear();
+        m_lut.clear();
+      }
+
+    protected:
+
+      iterator make_iterator(std::size_t const & slot)
+      {
+        return iterator( &m_store, slot, slot < m_store.slots() ? &m_store[slot] : 0 );
+      }
+
+      const_iterator make_iterator(std::size_t const & slot) const
+      {
+        return const_iterator( &m_store, slot, slot < m_store.slots() ? &m_store[slot] : 0 );
+      }
+
+    };
+
+  } // namespace details
+
+  /**
+   * Contiguous PolyMesh kernel.
+   *
+   * This is a drop-in replacement for OpenTissue::polymesh::PolyMeshListKernel.
+   * Instead of one std::list per feature type, the vertices, halfedges,
+   * edges and faces are kept in chunks of contiguous records, so walking
+   * the mesh with circulators touches memory that is close together.
+   *
+   * Handles keep the semantics of the list kernel: a new feature always
+   * gets a new handle index, and handles of erased features are never
+   * reused. GRIT relies on this since handle indices are used as simplex
+   * indices. A lookup table maps handle indices to record addresses, and
+   * the slots of erased records are recycled through a free list.
+   *
+   * Records never move once created, so references and iterators to
+   * features stay valid while other features are created or erased.
+   */
+  template<
+      typename V
+    , typename H
+    , typename E
+    , typename F
+  >
+  class PolyMeshVectorKernel
+  {
+  public:
+
+    typedef V   vertex_type;
+    typedef H   halfedge_type;
+    typedef E   edge_type;
+    typedef F   face_type;
+
+    typedef PolyMeshVectorKernel<V,H,E,F> kernel_type;
+
+  public:
+
+    typedef std::size_t                                                  index_type;
+    typedef std::size_t                                                  size_type;
+
+    typedef details::PolyMeshVectorTable<vertex_type>                   vertex_table;
+    typedef details::PolyMeshVectorTable<halfedge_type>                 halfedge_table;
+    typedef details::PolyMeshVectorTable<edge_type>                     edge_table;
+    typedef details::PolyMeshVectorTable<face_type>                     face_table;
+
+    typedef typename vertex_table::iterator                             vertex_iterator;
+    typedef typename halfedge_table::iterator                           halfedge_iterator;
+    typedef typename edge_table::iterator                               edge_iterator;
+    typedef typename face_table::iterator                               face_iterator;
+
+    typedef typename vertex_table::const_iterator                       const_vertex_iterator;
+    typedef typename halfedge_table::const_iterator                     const_halfedge_iterator;
+    typedef typename edge_table::const_iterator                         const_edge_iterator;
+    typedef typename face_table::const_iterator                         const_face_iterator;
+
+    typedef details::PolyMeshVectorOptional<vertex_iterator>            opt_vertex_iter;
+    typedef details::PolyMeshVectorOptional<halfedge_iterator>          opt_halfedge_iter;
+    typedef details::PolyMeshVectorOptional<edge_iterator>              opt_edge_iter;
+    typedef details::PolyMeshVectorOptional<face_iterator>              opt_face_iter;
+
+  private:
+
+    /**
+     * Default Constructed Handle:
+     *
+     * Null handle, Equivalent to a null-pointer or out-of-bound state.
+     */
+    class Handle
+    {
+    protected:
+
+      index_type m_idx;
+
+    public:
+
+      Handle()                        : m_idx(~0u)     {}
+      explicit Handle(index_type idx) : m_idx(idx)     {}
+      Handle(Handle const & h)        : m_idx(h.m_idx) {}
+
+      Handle &   operator= (Handle const & h)       { m_idx = h.m_idx; return *this; }
+      bool       operator< (Handle const & h) const { return m_idx < h.m_idx; }
+      bool       operator==(Handle const & h) const { return (h.m_idx==m_idx); }
+      bool       operator!=(Handle const & h) const { return (h.m_idx!=m_idx); }
+      index_type get_idx() const { return m_idx; }
+      bool       is_null() const { return (m_idx == ~0u); }
+    };
+
+  public:
+
+    class vertex_handle : public Handle
+    {
+    public:
+      vertex_handle()                        : Handle()    {}
+      vertex_handle(index_type idx)          : Handle(idx) {}
+      vertex_handle(vertex_handle const & v) : Handle(v)   {}
+    };
+
+    class halfedge_handle : public Handle
+    {
+    public:
+      halfedge_handle()                          : Handle()    {}
+      halfedge_handle(index_type idx)            : Handle(idx) {}
+      halfedge_handle(halfedge_handle const & h) : Handle(h)   {}
+    };
+
+    class edge_handle : public Handle
+    {
+    public:
+      edge_handle()                      : Handle()    {}
+      edge_handle(index_type idx)        : Handle(idx) {}
+      edge_handle(edge_handle const & e) : Handle(e)   {}
+    };
+
+    class face_handle : public Handle
+    {
+    public:
+      face_handle()                      : Handle()    {}
+      face_handle(index_type idx)        : Handle(idx) {}
+      face_handle(face_handle const & f) : Handle(f)   {}
+    };
+
+  public:
+
+    static vertex_handle const & null_vertex_handle()
+    {
+      static vertex_handle h;
+      return h;
+    }
+    static halfedge_handle const & null_halfedge_handle()
+    {
+      static halfedge_handle h;
+      return h;
+    }
+    static edge_handle const & null_edge_handle()
+    {
+      static edge_handle h;
+      return h;
+    }
+    static face_handle const & null_face_handle()
+    {
+      static face_handle h;
+      return h;
+    }
+
+  private:
+
+    vertex_table     m_vertices;
+    halfedge_table   m_halfedges;
+    edge_table       m_edges;
+    face_table       m_faces;
+
+  public:
+
+    vertex_iterator   vertex_begin()   { return m_vertices.begin();  }
+    vertex_iterator   vertex_end()     { return m_vertices.end();    }
+    halfedge_iterator halfedge_begin() { return m_halfedges.begin(); }
+    halfedge_iterator halfedge_end()   { return m_halfedges.end();   }
+    edge_iterator     edge_begin()     { return m_edges.begin();     }
+    edge_iterator     edge_end()       { return m_edges.end();       }
+    face_iterator     face_begin()     { return m_faces.begin();     }
+    face_iterator     face_end()       { return m_faces.end();       }
+
+    const_vertex_iterator   vertex_begin()   const { return m_vertices.begin();  }
+    const_vertex_iterator   vertex_end()     const { return m_vertices.end();    }
+    const_halfedge_iterator halfedge_begin() const { return m_halfedges.begin(); }
+    const_halfedge_iterator halfedge_end()   const { return m_halfedges.end();   }
+    const_edge_iterator     edge_begin()     const { return m_edges.begin();     }
+    const_edge_iterator     edge_end()       const { return m_edges.end();       }
+    const_face_iterator     face_begin()     const { return m_faces.begin();     }
+    const_face_iterator     face_end()       const { return m_faces.end();       }
+
+    size_type size_faces()     const { return m_faces.size();     }
+    size_type size_halfedges() const { return m_halfedges.size(); }
+    size_type size_edges()     const { return m_edges.size();     }
+    size_type size_vertices()  const { return m_vertices.size();  }
+
+  public:
+
+    PolyMeshVectorKernel() {}
+
+    explicit PolyMeshVectorKernel(PolyMeshVectorKernel const & other_kernel){ *this = other_kernel; }
+
+  public:
+
+    /**
+     * All handles of the copy are the same as in the original. The owner
+     * of the features must be updated by the mesh afterwards.
+     */
+    PolyMeshVectorKernel & operator=(PolyMeshVectorKernel const & rhs)
+    {
+      if (this != &rhs)
+      {
+        m_vertices  = rhs.m_vertices;
+        m_halfedges = rhs.m_halfedges;
+        m_edges     = rhs.m_edges;
+        m_faces     = rhs.m_faces;
+      }
+      return (*this);
+    }
+
+  protected:
+
+    friend class details::PolyMeshKernelAccess;
+
+    vertex_handle create_vertex()
+    {
+      vertex_handle h( m_vertices.create() );
+      OpenTissue::polymesh::polymesh_core_access::set_self_handle( m_vertices.find(h.get_idx()), h);
+      return h;
+    }
+
+    halfedge_handle create_halfedge()
+    {
+      halfedge_handle h( m_halfedges.create() );
+      OpenTissue::polymesh::polymesh_core_access::set_self_handle( m_halfedges.find(h.get_idx()), h);
+      return h;
+    }
+
+    edge_handle create_edge()
+    {
+      edge_handle h( m_edges.create() );
+      OpenTissue::polymesh::polymesh_core_access::set_self_handle( m_edges.find(h.get_idx()), h);
+      return h;
+    }
+
+    face_handle create_face()
+    {
+      face_handle h( m_faces.create() );
+      OpenTissue::polymesh::polymesh_core_access::set_self_handle( m_faces.find(h.get_idx()), h);
+      return h;
+    }
+
+    void erase_vertex(vertex_handle const & v)     { m_vertices.erase(  v.get_idx() ); }
+    void erase_halfedge(halfedge_handle const & h) { m_halfedges.erase( h.get_idx() ); }
+    void erase_edge(edge_handle const & e)         { m_edges.erase(     e.get_idx() ); }
+    void erase_face(face_handle const & f)         { m_faces.erase(     f.get_idx() ); }
+
+  public:
+
+    vertex_handle get_vertex_handle(index_type idx) const
+    {
+      return m_vertices.is_valid(idx) ? m_vertices.find(idx)->get_handle() : null_vertex_handle();
+    }
+
+    halfedge_handle get_halfedge_handle(index_type idx) const
+    {
+      return m_halfedges.is_valid(idx) ? m_halfedges.find(idx)->get_handle() : null_halfedge_handle();
+    }
+
+    edge_handle get_edge_handle(index_type idx) const
+    {
+      return m_edges.is_valid(idx) ? m_edges.find(idx)->get_handle() : null_edge_handle();
+    }
+
+    face_handle get_face_handle(index_type idx) const
+    {
+      return m_faces.is_valid(idx) ? m_faces.find(idx)->get_handle() : null_face_handle();
+    }
+
+    const_vertex_iterator get_vertex_iterator(vertex_handle const & v) const
+    {
+      return v == null_vertex_handle() ? vertex_end() : m_vertices.find( v.get_idx() );
+    }
+
+    const_halfedge_iterator get_halfedge_iterator(halfedge_handle const & h) const
+    {
+      return h == null_halfedge_handle() ? halfedge_end() : m_halfedges.find( h.get_idx() );
+    }
+
+    const_edge_iterator get_edge_iterator(edge_handle const & e) const
+    {
+      return e == null_edge_handle() ? edge_end() : m_edges.find( e.get_idx() );
+    }
+
+    const_face_iterator get_face_iterator(face_handle const & f) const
+    {
+      return f == null_face_handle() ? face_end() : m_faces.find( f.get_idx() );
+    }
+
+    vertex_iterator get_vertex_iterator(vertex_handle const & v)
+    {
+      return v == null_vertex_handle() ? vertex_end() : m_vertices.find( v.get_idx() );
+    }
+
+    halfedge_iterator get_halfedge_iterator(halfedge_handle const & h)
+    {
+      return h == null_halfedge_handle() ? halfedge_end() : m_halfedges.find( h.get_idx() );
+    }
+
+    edge_iterator get_edge_iterator(edge_handle const & e)
+    {
+      return e == null_edge_handle() ? edge_end() : m_edges.find( e.get_idx() );
+    }
+
+    face_iterator get_face_iterator(face_handle const & f)
+    {
+      return f == null_face_handle() ? face_end() : m_faces.find( f.get_idx() );
+    }
+
+    void clear()
+    {
+      m_vertices.clear();
+      m_halfedges.clear();
+      m_edges.clear();
+      m_faces.clear();
+    }
+
+  public:
+
+    bool is_valid_vertex_handle(vertex_handle const & v) const
+    {
+      return v != null_vertex_handle() && m_vertices.is_valid( v.get_idx() );
+    }
+
+    bool is_valid_halfedge_handle(halfedge_handle const & h) const
+    {
+      return h != null_halfedge_handle() && m_halfedges.is_valid( h.get_idx() );
+    }
+
+    bool is_valid_edge_handle(edge_handle const & e) const
+    {
+      return e != null_edge_handle() && m_edges.is_valid( e.get_idx() );
+    }
+
+    bool is_valid_face_handle(face_handle const & f) const
+    {
+      return f != null_face_handle() && m_faces.is_valid( f.get_idx() );
+    }
+
+  };
+
+} // namespace grit
+
+// GRIT_POLYMESH_VECTOR_KERNEL_H
+#endif
@@ -2,12 +2,19 @@
 #define GRIT_PTHREAD_SCHEDULER_H
 
 #include <grit_interface_scheduler.h>
+#include <grit_mesh_regions.h>
 
 #include <utilities/grit_compute_phase_labels.h>
 
 #include <util_use_pthreads.h>
+#include <util_thread_pool.h>
 #include <util_log.h>
 
+#include <memory>     // Needed for std::shared_ptr
+#include <vector>
+#include <string>
+#include <algorithm>  // Needed for std::max
+
 namespace grit
 {
 
@@ -40,6 +47,45 @@ namespace grit
     }
 
 
+    /**
+     * The work of one thread in an in-place run: an algorithm working on
+     * one region of the global mesh.
+     */
+    template<typename types>
+    class RegionTask
+    {
+    public:
+
+      typename types::algorithm_type            m_algorithm;         ///< Its region() is the region of the task.
+      typename types::mesh_impl               * m_mesh;              ///< The global mesh, shared by all tasks.
+      typename types::attributes_type         * m_attributes;        ///< The global attributes, shared by all tasks.
+      typename types::param_type        const * m_parameters;
+      std::vector<unsigned int>         const * m_labels;            ///< The phase labels of the global mesh.
+      unsigned int                              m_operations_done;
+
+    }; // class RegionTask
+
+
+    template<typename types>
+    inline void* run_region_thread(void* task)
+    {
+      typedef RegionTask<types> RT;
+
+      RT* region = (RT*)(task);
+
+      if (region->m_parameters->verbose() && !(region->m_parameters->silent_threads()))
+      {
+        util::Log logging;
+
+        logging << "run_region_thread(): Working on region " << region->m_algorithm.id() << util::Log::newline();
+      }
+
+      region->m_operations_done = region->m_algorithm.run( *(region->m_mesh), *(region->m_attributes), *(region->m_parameters), *(region->m_labels) );
+
+      return 0;
+    }
+
+
 
 
     template<typename types>
@@ -66,7 +112,9 @@ namespace grit
 
     protected:
 
-      MOT              m_monitor;
+      MOT                                 m_monitor;
+      std::shared_ptr<util::ThreadPool>   m_thread_pool;           ///< Worker threads, created on the first run and kept until the scheduler is destroyed.
+      DDT                                 m_domain_decomposition;  ///< Kept between iterations, so a decomposition can move its cuts away from the previous ones.
 
     public:
 
@@ -76,18 +124,114 @@ namespace grit
 
       MOT              & monitor()          { return m_monitor; }
 
+      /**
+       * The worker threads used by run(). Several schedulers can share one
+       * pool by assigning the same pool to each of them, their runs then
+       * take turns using the workers.
+       */
+      std::shared_ptr<util::ThreadPool> & thread_pool() { return m_thread_pool; }
+
     public:
 
       PThreadScheduler()
       {
       }
 
+    protected:
+
+      /**
+       * Runs one algorithm per region of the global mesh on the worker
+       * threads. The threads share the mesh and the attributes, they work
+       * on their own vertices and take turns changing the shared
+       * containers, see MeshRegions. Nothing is copied into subdomains or
+       * merged back. Attributes that the algorithms create for their own
+       * use are removed afterwards, like they are dropped together with a
+       * subdomain.
+       *
+       * @return   The number of operations done.
+       */
+      unsigned int run_in_place(PT const & parameters, unsigned int const & number_of_threads)
+      {
+        MI  & mesh       = base_class::mesh();
+        AMT & attributes = base_class::attributes();
+
+        unsigned int const number_of_regions = parameters.number_of_subdomains();
+
+        std::vector<std::string> const names[3] = {
+          attributes.simplex0_attribute_names()
+          , attributes.simplex1_attribute_names()
+          , attributes.simplex2_attribute_names()
+        };
+
+        MeshRegions regions;
+
+        m_domain_decomposition.create_regions(parameters, mesh, attributes, regions);
+
+        std::vector<unsigned int> labels;
+        compute_phase_labels(mesh, labels);
+
+        std::vector< RegionTask<types> > region_tasks(number_of_regions);
+        std::vector<void *>              tasks(number_of_regions);
+
+        for (unsigned int i = 0u; i < number_of_regions; ++i)
+        {
+          region_tasks[i].m_algorithm.id()     = i;
+          region_tasks[i].m_algorithm.region() = InRegion(regions, i);
+          region_tasks[i].m_mesh               = &mesh;
+          region_tasks[i].m_attributes         = &attributes;
+          region_tasks[i].m_parameters         = &parameters;
+          region_tasks[i].m_labels             = &labels;
+          region_tasks[i].m_operations_done    = 0u;
+
+          tasks[i] = &(region_tasks[i]);
+        }
+
+        m_thread_pool->run( run_region_thread<types>, tasks, number_of_threads );
+
+        regions.release(mesh);
+
+        unsigned int operations_done = 0u;
+
+        for (unsigned int i = 0u; i < number_of_regions; ++i)
+          operations_done += region_tasks[i].m_operations_done;
+
+        for (unsigned int dimension = 0u; dimension < 3u; ++dimension)
+        {
+          std::vector<std::string> const created = dimension == 0u ? attributes.simplex0_attribute_names()
+                                                 : dimension == 1u ? attributes.simplex1_attribute_names()
+                                                 :                   attributes.simplex2_attribute_names();
+
+          for (size_t n = names[dimension].size(); n < created.size(); ++n)
+            attributes.destroy_attribute( created[n], dimension );
+        }
+
+        return operations_done;
+      }
+
     public:
 
 
+      /**
+       * Runs the algorithm on number_of_subdomains() threads. With an
+       * over_decomposition() larger than one, the mesh is cut into that
+       * many subdomains per thread. The subdomains are handed out to the
+       * threads one at a time as threads become idle, so a thread that
+       * got a subdomain with little work to do moves on to the next one
+       * instead of waiting for the slowest subdomain.
+       *
+       * With parameters.run_in_place() the threads work on regions of the
+       * mesh in place instead, see run_in_place(...).
+       */
       void run(PT const & parameters)
       {
-        unsigned int const number_of_subdomains = parameters.number_of_subdomains();
+        unsigned int const number_of_threads = parameters.number_of_subdomains();
+
+        //--- The decomposition creates number_of_subdomains() subdomains
+        PT decomposition_parameters = parameters;
+
+        decomposition_parameters.number_of_subdomains() = number_of_threads * std::max( parameters.over_decomposition(), 1u );
+
+        unsigned int const number_of_subdomains = decomposition_parameters.number_of_subdomains();
 
         monitor().reset();
         monitor().name() = "scheduler";
@@ -109,35 +253,45 @@ namespace grit
           }
         }
 
+        if (!m_thread_pool)
+          m_thread_pool.reset( new util::ThreadPool( parameters.pin_threads() ) );
+
+        std::vector<void *> tasks(number_of_subdomains);
+
         do
         {
-          DDT domain_decomposition;
-
           if (parameters.verbose())
           {
             log << "PThreadScheduler::run() Entering main loop." << newline;
           }
 
-          DMT domains = domain_decomposition.create_subdomains(parameters, base_class::mesh(), base_class::attributes());
-
-          if (parameters.verbose())
+          if (parameters.run_in_place())
           {
-            log << "PThreadScheduler::run() Subdomains created." << newline;
+            operations_done += run_in_place(decomposition_parameters, number_of_threads);
+
+            if (parameters.verbose()) log << "PThreadScheduler::run(): operations_done = " << operations_done << newline;
           }
+          else
+          {
+            DMT domains = m_domain_decomposition.create_subdomains(decomposition_parameters, base_class::mesh(), base_class::attributes());
+
+            if (parameters.verbose())
+            {
+              log << "PThreadScheduler::run() Subdomains created." << newline;
+            }
 
-          std::vector<pthread_t> threads(number_of_subdomains);
-          for (unsigned int tid = 0u; tid < number_of_subdomains; ++tid)
-            pthread_create(&threads[tid], NULL, run_thread<types>, &(domains.subdomain(tid)));
+            for (unsigned int tid = 0u; tid < number_of_subdomains; ++tid)
+              tasks[tid] = &(domains.subdomain(tid));
 
-          for (unsigned int tid = 0u; tid < number_of_subdomains; ++tid)
-            pthread_join(threads[tid], NULL);
+            m_thread_pool->run( run_thread<types>, tasks, number_of_threads );
 
-          for (unsigned int tid = 0u; tid < number_of_subdomains; ++tid)
-            operations_done += domains.subdomain(tid).operations_done();
+            for (unsigned int tid = 0u; tid < number_of_subdomains; ++tid)
+              operations_done += domains.subdomain(tid).operations_done();
 
-          if (parameters.verbose()) log << "PThreadScheduler::run(): operations_done = " << operations_done << newline;
+            if (parameters.verbose()) log << "PThreadScheduler::run(): operations_done = " << operations_done << newline;
 
-          domain_decomposition.merge_subdomains(domains, parameters, base_class::mesh(), base_class::attributes());
+            m_domain_decomposition.merge_subdomains(domains, decomposition_parameters, base_class::mesh(), base_class::attributes());
+          }
 
           if (parameters.verbose()) log << "PTthreadScheduler::run(): Inside scheduler loop" << newline;
 
@@ -148,6 +302,7 @@ namespace grit
         if (parameters.verbose())
         {
           log << "PTthreadScheduler::run(): Scheduler run completed!" << newline;
+          log << "PTthreadScheduler::run(): number_of_threads     = " << number_of_threads << newline;
           log << "PTthreadScheduler::run(): number_of_subdomains  = " << number_of_subdomains << newline;
         }
 
@@ -1,19 +1,35 @@
 #ifndef GRIT_SIMPLEX_H
 #define GRIT_SIMPLEX_H
 
-#include <util_sort.h>
-
 #include <vector>
+#include <cstddef>     // Needed for std::size_t
+#include <cstdint>     // Needed for std::uint32_t and std::uint64_t
+#include <functional>  // Needed for std::hash
 #include <limits>      // Needed for std::numeric_limits
 #include <iostream>    // Needed to support output of string literals in streams
 
 namespace grit
 {
+
+  /**
+   * The integer type used for the vertex indices stored in simplices.
+   *
+   * By default indices are 32 bits wide, which is plenty for any mesh
+   * GRIT is used on and keeps a Simplex1 at 12 bytes and a Simplex2 at
+   * 16 bytes. Defining GRIT_USE_64BIT_SIMPLEX_INDEX (controlled by the
+   * CMake variable ENABLE_64BIT_SIMPLEX_INDEX) selects 64 bit indices.
+   */
+#ifdef GRIT_USE_64BIT_SIMPLEX_INDEX
+  typedef std::uint64_t simplex_index_type;
+#else
+  typedef std::uint32_t simplex_index_type;
+#endif
+
   class Simplex
   {
   public:
 
-    typedef unsigned long index_type;
+    typedef simplex_index_type index_type;
 
   protected:
 
@@ -55,88 +71,100 @@ namespace grit
 
   };
 
+  /**
+   * A 1-simplex (an edge).
+   *
+   * The two indices are stored in canonical (sorted) order, so comparison
+   * and hashing never need to sort anything. The order in which the
+   * indices were given when the simplex was created is kept in m_order,
+   * and get_idx0() and get_idx1() return the indices in that original
+   * order.
+   */
   class Simplex1
   : public Simplex
   {
   protected:
 
-    index_type m_idx0;
-    index_type m_idx1;
-
-    static Simplex1 order(Simplex1 const & s)
-    {
-      if (s.get_idx0() <= s.get_idx1())
-        return s;
-      else
-        return Simplex1(s.get_idx1(), s.get_idx0());
-    }
+    index_type    m_keys[2];   ///< The indices in sorted order.
+    unsigned char m_order;     ///< Bit k holds the position in m_keys of the k'th original index.
 
   public:
 
     Simplex1()
-    : m_idx0(Simplex::UNSET())
-    , m_idx1(Simplex::UNSET())
-    { }
+    : m_order(2u)
+    {
+      m_keys[0] = Simplex::UNSET();
+      m_keys[1] = Simplex::UNSET();
+    }
 
     Simplex1(Simplex0 const & s0, Simplex0 const & s1)
-    : m_idx0(s0.get_idx0())
-    , m_idx1(s1.get_idx0())
-    { }
+    {
+      index_type const i0 = s0.get_idx0();
+      index_type const i1 = s1.get_idx0();
+
+      if (i0 <= i1)
+      {
+        m_keys[0] = i0;
+        m_keys[1] = i1;
+        m_order   = 2u;
+      }
+      else
+      {
+        m_keys[0] = i1;
+        m_keys[1] = i0;
+        m_order   = 1u;
+      }
+    }
 
     friend bool operator> (Simplex1 const & s0, Simplex1 const & s1)
     {
-      Simplex1 const ns0 = order(s0);
-      Simplex1 const ns1 = order(s1);
-
-      return (ns0.m_idx0 > ns1.m_idx0) ||
-             (ns0.m_idx0 == ns1.m_idx0 && ns0.m_idx1 > ns1.m_idx1);
+      return (s0.m_keys[0] > s1.m_keys[0]) ||
+             (s0.m_keys[0] == s1.m_keys[0] && s0.m_keys[1] > s1.m_keys[1]);
     }
 
     friend bool operator< (Simplex1 const & s0, Simplex1 const & s1)
     {
-      Simplex1 const ns0 = order(s0);
-      Simplex1 const ns1 = order(s1);
-
-      return (ns0.m_idx0 < ns1.m_idx0) ||
-             (ns0.m_idx0 == ns1.m_idx0 && ns0.m_idx1 < ns1.m_idx1);
+      return (s0.m_keys[0] < s1.m_keys[0]) ||
+             (s0.m_keys[0] == s1.m_keys[0] && s0.m_keys[1] < s1.m_keys[1]);
     }
 
     friend bool operator== (Simplex1 const & s0, Simplex1 const & s1)
     {
-      Simplex1 const ns0 = order(s0);
-      Simplex1 const ns1 = order(s1);
-
-      return ns0.m_idx0 == ns1.m_idx0 && ns0.m_idx1 == ns1.m_idx1;
+      return s0.m_keys[0] == s1.m_keys[0] && s0.m_keys[1] == s1.m_keys[1];
     }
 
-    index_type const & get_idx0() const { return m_idx0; }
-    index_type const & get_idx1() const { return m_idx1; }
+    index_type const & get_idx0() const { return m_keys[  m_order        & 1u ]; }
+    index_type const & get_idx1() const { return m_keys[ (m_order >> 1u) & 1u ]; }
+
+    /**
+     * The canonical key of this simplex, i.e. the indices in sorted order.
+     */
+    index_type const & get_key0() const { return m_keys[0]; }
+    index_type const & get_key1() const { return m_keys[1]; }
 
-    Simplex0 get_simplex0_idx0() const { return Simplex0(m_idx0); }
-    Simplex0 get_simplex0_idx1() const { return Simplex0(m_idx1); }
+    Simplex0 get_simplex0_idx0() const { return Simplex0(get_idx0()); }
+    Simplex0 get_simplex0_idx1() const { return Simplex0(get_idx1()); }
 
     bool is_null() const
     {
-      return m_idx0 == Simplex::UNSET() || m_idx1 == Simplex::UNSET();
+      return m_keys[0] == Simplex::UNSET() || m_keys[1] == Simplex::UNSET();
     }
 
     void reverse()
     {
-      index_type const temp = m_idx0;
-      m_idx0 = m_idx1;
-      m_idx1 = temp;
+      m_order = 3u - m_order;
     }
 
     Simplex1 get_reversed() const
     {
-      return Simplex1(m_idx1, m_idx0);
+      return Simplex1(get_idx1(), get_idx0());
     }
 
     unsigned int get_local_index(Simplex0 const & s) const
     {
-      if( s.get_idx0() == this->m_idx0)
+      if( s.get_idx0() == this->get_idx0())
         return 0u;
-      if( s.get_idx0() == this->m_idx1)
+      if( s.get_idx0() == this->get_idx1())
         return 1u;
 
       return std::numeric_limits<unsigned int>::max();
@@ -145,100 +173,109 @@ namespace grit
     Simplex0 get_simplex_from_local_index(unsigned int const & idx) const
     {
       if( idx == 0u )
-        return Simplex0(this->m_idx0);
+        return Simplex0(this->get_idx0());
       if( idx == 1u )
-        return Simplex0(this->m_idx1);
+        return Simplex0(this->get_idx1());
       return Simplex0();
     }
 
   };
 
+  /**
+   * A 2-simplex (a triangle).
+   *
+   * As for Simplex1 the indices are stored in sorted order and the
+   * original order (the winding of the triangle) is kept in m_order, two
+   * bits per index. get_idx0(), get_idx1() and get_idx2() return the
+   * indices in the original order.
+   */
   class Simplex2
   : public Simplex
   {
   protected:
 
-    index_type m_idx0;
-    index_type m_idx1;
-    index_type m_idx2;
-
-    static Simplex2 order(Simplex2 const & s)
-    {
-      index_type v0 = Simplex::UNSET();
-      index_type v1 = Simplex::UNSET();
-      index_type v2 = Simplex::UNSET();
-
-      util::sort<index_type>(s.m_idx0, s.m_idx1, s.m_idx2, v0, v1, v2);
-
-      return Simplex2(v0, v1, v2);
-    }
+    index_type    m_keys[3];   ///< The indices in sorted order.
+    unsigned char m_order;     ///< Bits 2k and 2k+1 hold the position in m_keys of the k'th original index.
 
   public:
 
     Simplex2()
-    : m_idx0(Simplex::UNSET())
-    , m_idx1(Simplex::UNSET())
-    , m_idx2(Simplex::UNSET())
-    { }
+    : m_order(36u)
+    {
+      m_keys[0] = Simplex::UNSET();
+      m_keys[1] = Simplex::UNSET();
+      m_keys[2] = Simplex::UNSET();
+    }
 
     Simplex2(Simplex0 const & s0, Simplex0 const & s1, Simplex0 const & s2)
-    : m_idx0(s0.get_idx0())
-    , m_idx1(s1.get_idx0())
-    , m_idx2(s2.get_idx0())
-    { }
+    {
+      index_type const i0 = s0.get_idx0();
+      index_type const i1 = s1.get_idx0();
+      index_type const i2 = s2.get_idx0();
+
+      // Position of each index in sorted order, ties are broken by the
+      // original position so we always get a permutation.
+      unsigned int const r0 = (i1 <  i0) + (i2 <  i0);
+      unsigned int const r1 = (i0 <= i1) + (i2 <  i1);
+      unsigned int const r2 = (i0 <= i2) + (i1 <= i2);
+
+      m_keys[r0] = i0;
+      m_keys[r1] = i1;
+      m_keys[r2] = i2;
+
+      m_order = static_cast<unsigned char>( r0 | (r1 << 2u) | (r2 << 4u) );
+    }
 
     friend bool operator> (Simplex2 const & s0, Simplex2 const & s1)
     {
-      Simplex2 const ns0 = order(s0);
-      Simplex2 const ns1 = order(s1);
-
-      return (ns0.m_idx0 > ns1.m_idx0) ||
-             (ns0.m_idx0 == ns1.m_idx0 && ns0.m_idx1 > ns1.m_idx1) ||
-             (ns0.m_idx0 == ns1.m_idx0 && ns0.m_idx1 == ns1.m_idx1 && ns0.m_idx2 > ns1.m_idx2);
+      return (s0.m_keys[0] > s1.m_keys[0]) ||
+             (s0.m_keys[0] == s1.m_keys[0] && s0.m_keys[1] > s1.m_keys[1]) ||
+             (s0.m_keys[0] == s1.m_keys[0] && s0.m_keys[1] == s1.m_keys[1] && s0.m_keys[2] > s1.m_keys[2]);
     }
 
     friend bool operator< (Simplex2 const & s0, Simplex2 const & s1)
     {
-      Simplex2 const ns0 = order(s0);
-      Simplex2 const ns1 = order(s1);
-
-      return (ns0.m_idx0 < ns1.m_idx0) ||
-            (ns0.m_idx0 == ns1.m_idx0 && ns0.m_idx1 < ns1.m_idx1) ||
-            (ns0.m_idx0 == ns1.m_idx0 && ns0.m_idx1 == ns1.m_idx1 && ns0.m_idx2 < ns1.m_idx2);
+      return (s0.m_keys[0] < s1.m_keys[0]) ||
+             (s0.m_keys[0] == s1.m_keys[0] && s0.m_keys[1] < s1.m_keys[1]) ||
+             (s0.m_keys[0] == s1.m_keys[0] && s0.m_keys[1] == s1.m_keys[1] && s0.m_keys[2] < s1.m_keys[2]);
     }
 
     friend bool operator== (Simplex2 const & s0, Simplex2 const & s1)
     {
-      Simplex2 const ns0 = order(s0);
-      Simplex2 const ns1 = order(s1);
-
-      return ns0.m_idx0 == ns1.m_idx0 &&
-             ns0.m_idx1 == ns1.m_idx1 &&
-             ns0.m_idx2 == ns1.m_idx2;
+      return s0.m_keys[0] == s1.m_keys[0] &&
+             s0.m_keys[1] == s1.m_keys[1] &&
+             s0.m_keys[2] == s1.m_keys[2];
     }
 
-    index_type const & get_idx0() const { return m_idx0; }
-    index_type const & get_idx1() const { return m_idx1; }
-    index_type const & get_idx2() const { return m_idx2; }
+    index_type const & get_idx0() const { return m_keys[  m_order        & 3u ]; }
+    index_type const & get_idx1() const { return m_keys[ (m_order >> 2u) & 3u ]; }
+    index_type const & get_idx2() const { return m_keys[ (m_order >> 4u) & 3u ]; }
+
+    /**
+     * The canonical key of this simplex, i.e. the indices in sorted order.
+     */
+    index_type const & get_key0() const { return m_keys[0]; }
+    index_type const & get_key1() const { return m_keys[1]; }
+    index_type const & get_key2() const { return m_keys[2]; }
 
-    Simplex0 get_simplex0_idx0() const { return Simplex0(m_idx0); }
-    Simplex0 get_simplex0_idx1() const { return Simplex0(m_idx1); }
-    Simplex0 get_simplex0_idx2() const { return Simplex0(m_idx2); }
+    Simplex0 get_simplex0_idx0() const { return Simplex0(get_idx0()); }
+    Simplex0 get_simplex0_idx1() const { return Simplex0(get_idx1()); }
+    Simplex0 get_simplex0_idx2() const { return Simplex0(get_idx2()); }
 
     bool is_null() const
     {
-      return m_idx0 == Simplex::UNSET() ||
-             m_idx1 == Simplex::UNSET() ||
-             m_idx2 == Simplex::UNSET();
+      return m_keys[0] == Simplex::UNSET() ||
+             m_keys[1] == Simplex::UNSET() ||
+             m_keys[2] == Simplex::UNSET();
     }
 
     unsigned int get_local_index(Simplex0 const & s) const
     {
-      if( s.get_idx0() == this->m_idx0)
+      if( s.get_idx0() == this->get_idx0())
         return 0u;
-      if( s.get_idx0() == this->m_idx1)
+      if( s.get_idx0() == this->get_idx1())
         return 1u;
-      if( s.get_idx0() == this->m_idx2)
+      if( s.get_idx0() == this->get_idx2())
         return 2u;
 
       return std::numeric_limits<unsigned int>::max();
@@ -247,11 +284,11 @@ namespace grit
     Simplex0 get_simplex_from_local_index(unsigned int const & idx) const
     {
       if( idx == 0u )
-        return Simplex0(this->m_idx0);
+        return Simplex0(this->get_idx0());
       if( idx == 1u )
-        return Simplex0(this->m_idx1);
+        return Simplex0(this->get_idx1());
       if( idx == 2u )
-        return Simplex0(this->m_idx2);
+        return Simplex0(this->get_idx2());
       return Simplex0();
     }
   };
@@ -345,5 +382,52 @@ namespace grit
 
 }//end namespace grit
 
+/**
+ * Hash functions for simplices, so they can be used as keys in hashed
+ * containers like std::unordered_map. The hash is computed from the
+ * canonical keys, hence simplices that compare equal hash to the same
+ * value regardless of their winding.
+ */
+namespace std
+{
+
+  template<>
+  struct hash<grit::Simplex0>
+  {
+    std::size_t operator()(grit::Simplex0 const & s) const
+    {
+      return std::hash<grit::Simplex::index_type>()(s.get_idx0());
+    }
+  };
+
+  template<>
+  struct hash<grit::Simplex1>
+  {
+    std::size_t operator()(grit::Simplex1 const & s) const
+    {
+      std::hash<grit::Simplex::index_type> const h;
+
+      std::size_t seed = h(s.get_key0());
+      seed ^= h(s.get_key1()) + 0x9e3779b9u + (seed << 6) + (seed >> 2);
+      return seed;
+    }
+  };
+
+  template<>
+  struct hash<grit::Simplex2>
+  {
+    std::size_t operator()(grit::Simplex2 const & s) const
+    {
+      std::hash<grit::Simplex::index_type> const h;
+
+      std::size_t seed = h(s.get_key0());
+      seed ^= h(s.get_key1()) + 0x9e3779b9u + (seed << 6) + (seed >> 2);
+      seed ^= h(s.get_key2()) + 0x9e3779b9u + (seed << 6) + (seed >> 2);
+      return seed;
+    }
+  };
+
+}//end namespace std
+
 // GRIT_SIMPLEX_H
 #endif
@@ -0,0 +1,430 @@
+#ifndef GRIT_SIMPLEX0_MULTI_ATTRIBUTE_TABLE_H
+#define GRIT_SIMPLEX0_MULTI_ATTRIBUTE_TABLE_H
+
+#include <grit_simplex.h>
+
+#include <vector>
+#include <algorithm>  // Needed for std::copy, std::fill, std::max
+#include <limits>     // Needed for std::numeric_limits
+#include <cassert>
+
+namespace grit
+{
+
+  /**
+   * A read-only view of the phase labels of a single 0-simplex.
+   *
+   * The view points directly into the storage of a Simplex0MultiAttributeTable,
+   * so it is invalidated by any change of the labels in the table (adding,
+   * erasing or clearing labels of any 0-simplex).
+   */
+  class Simplex0LabelRange
+  {
+  public:
+
+    typedef unsigned int const *  const_iterator;
+    typedef unsigned int const *  iterator;
+
+  protected:
+
+    unsigned int const * m_begin;
+    unsigned int const * m_end;
+
+  public:
+
+    Simplex0LabelRange()
+    : m_begin(0)
+    , m_end(0)
+    {}
+
+    Simplex0LabelRange(unsigned int const * begin, unsigned int const * end)
+    : m_begin(begin)
+    , m_end(end)
+    {}
+
+  public:
+
+    const_iterator begin() const { return m_begin; }
+    const_iterator end()   const { return m_end;   }
+
+    unsigned int size()  const { return static_cast<unsigned int>(m_end - m_begin); }
+    bool         empty() const { return m_begin == m_end; }
+
+    unsigned int const & operator[](unsigned int const & i) const
+    {
+      assert( i < size() || !"Simplex0LabelRange::operator[]: index out of range");
+
+      return m_begin[i];
+    }
+
+  };
+
+  /**
+   * Simplex0 Multi Attribute Table.
+   * Stores the phase labels of all 0-simplices together with any number of
+   * attributes that have one value per (0-simplex, label) pair.
+   *
+   * The storage is a compressed row layout: every 0-simplex owns a contiguous
+   * range of slots in one flat array of labels, and every attribute is a flat
+   * array of values parallel to the label array. Thus all attributes share a
+   * single slot map, and looking up the value of a vertex in a given phase is
+   * a short linear search in the label range of the vertex followed by a
+   * direct array access.
+   *
+   * When a 0-simplex runs out of slots its range is moved to the end of the
+   * arrays with twice the capacity. The abandoned slots are reclaimed once
+   * they make up half of the storage.
+   *
+   * Slots past the last label of a 0-simplex keep their values when labels
+   * are cleared, so clearing and re-adding the labels of a vertex (as done
+   * by the attribute assignments) preserves the values in label order.
+   *
+   * @tparam T    The value type of the attributes.
+   */
+  template<typename T>
+  class Simplex0MultiAttributeTable
+  {
+  public:
+
+    typedef Simplex0LabelRange  label_range;
+
+    /**
+     * The label stored in slots that do not hold a label of any 0-simplex.
+     */
+    static unsigned int no_label() { return std::numeric_limits<unsigned int>::max(); }
+
+    /**
+     * The slot returned by slot() if the 0-simplex does not have the label.
+     */
+    static unsigned int no_slot()  { return std::numeric_limits<unsigned int>::max(); }
+
+  protected:
+
+    std::vector<unsigned int>      m_offsets;      ///< First slot of each 0-simplex, indexed by the simplex index.
+    std::vector<unsigned int>      m_counts;       ///< Number of labels of each 0-simplex.
+    std::vector<unsigned int>      m_capacities;   ///< Number of slots reserved by each 0-simplex.
+    std::vector<unsigned int>      m_labels;       ///< The label held in each slot.
+    std::vector< std::vector<T> >  m_columns;      ///< One flat array of values per attribute, parallel to m_labels.
+    unsigned int                   m_abandoned;    ///< Number of slots not reserved by any 0-simplex.
+
+  public:
+
+    Simplex0MultiAttributeTable()
+    : m_abandoned(0u)
+    {}
+
+  public:
+
+    /**
+     * @return   The number of attributes (columns) in the table.
+     */
+    unsigned int columns() const
+    {
+      return static_cast<unsigned int>(m_columns.size());
+    }
+
+    /**
+     * Adds an attribute to the table. The new attribute has the value T()
+     * in all slots.
+     *
+     * @return   The index of the new column.
+     */
+    unsigned int add_column()
+    {
+      m_columns.push_back( std::vector<T>(m_labels.size(), T()) );
+
+      return columns() - 1u;
+    }
+
+    /**
+     * Removes one attribute from the table. The columns after it move one
+     * index down.
+     */
+    void remove_column(unsigned int const & c)
+    {
+      m_columns.erase( m_columns.begin() + c );
+    }
+
+    /**
+     * Removes all attributes, but keeps the labels.
+     */
+    void clear_columns()
+    {
+      m_columns.clear();
+    }
+
+    /**
+     * Gives direct access to the values of one attribute, indexed by slot.
+     * Together with slot_labels() this allows sweeping over all values of
+     * an attribute in a given phase as a single pass over flat arrays.
+     */
+    std::vector<T>       & column(unsigned int const & c)       { return m_columns[c]; }
+    std::vector<T> const & column(unsigned int const & c) const { return m_columns[c]; }
+
+    /**
+     * @return   The label of every slot, or no_label() for unused slots.
+     */
+    std::vector<unsigned int> const & slot_labels() const { return m_labels; }
+
+  public:
+
+    /**
+     * @return   The labels of 0-simplex s, in the order they were added.
+     */
+    label_range labels(Simplex0 const & s) const
+    {
+      unsigned int const i = s.get_idx0();
+
+      if (i >= m_counts.size() || m_counts[i] == 0u)
+        return label_range();
+
+      unsigned int const * first = &m_labels[ m_offsets[i] ];
+
+      return label_range( first, first + m_counts[i] );
+    }
+
+    /**
+     * @return   The slot holding the values of 0-simplex s in the phase
+     *           given by label, or no_slot() if s does not have the label.
+     */
+    unsigned int slot(Simplex0 const & s, unsigned int const & label) const
+    {
+      unsigned int const i = s.get_idx0();
+
+      if (i >= m_counts.size())
+        return no_slot();
+
+      unsigned int const first = m_offsets[i];
+      unsigned int const last  = first + m_counts[i];
+
+      for (unsigned int k = first; k < last; ++k)
+      {
+        if (m_labels[k] == label)
+          return k;
+      }
+
+      return no_slot();
+    }
+
+    T       & value(unsigned int const & c, unsigned int const & slot)       { return m_columns[c][slot]; }
+    T const & value(unsigned int const & c, unsigned int const & slot) const { return m_columns[c][slot]; }
+
+  public:
+
+    /**
+     * Appends label to the labels of 0-simplex s. If the slot was used
+     * before, it still holds the old values, otherwise all values are T().
+     */
+    void add_label(Simplex0 const & s, unsigned int const & label)
+    {
+      unsigned int const i = touch(s);
+
+      if (m_counts[i] == m_capacities[i])
+      {
+        relocate( i, std::max( 2u, 2u*m_capacities[i]) );
+      }
+
+      m_labels[ m_offsets[i] + m_counts[i] ] = label;
+
+      ++m_counts[i];
+    }
+
+    /**
+     * Removes label from the labels of 0-simplex s. The remaining labels
+     * and their values keep their order.
+     */
+    void erase_label(Simplex0 const & s, unsigned int const & label)
+    {
+      unsigned int const k = slot(s, label);
+
+      if (k == no_slot())
+        return;
+
+      unsigned int const i    = s.get_idx0();
+      unsigned int const last = m_offsets[i] + m_counts[i] - 1u;
+
+      std::copy( m_labels.begin() + k + 1u, m_labels.begin() + last + 1u, m_labels.begin() + k );
+
+      m_labels[last] = no_label();
+
+      for (unsigned int c = 0u; c < m_columns.size(); ++c)
+      {
+        std::vector<T> & values = m_columns[c];
+
+        std::copy( values.begin() + k + 1u, values.begin() + last + 1u, values.begin() + k );
+
+        values[last] = T();
+      }
+
+      --m_counts[i];
+    }
+
+    /**
+     * Removes all labels of 0-simplex s, but keeps its slots and values.
+     */
+    void clear_labels(Simplex0 const & s)
+    {
+      unsigned int const i = touch(s);
+
+      unsigned int const first = m_offsets[i];
+
+      std::fill( m_labels.begin() + first, m_labels.begin() + first + m_counts[i], no_label() );
+
+      m_counts[i] = 0u;
+    }
+
+    /**
+     * Removes all labels of 0-simplex s and resets all its values to T().
+     */
+    void clear(Simplex0 const & s)
+    {
+      clear_labels(s);
+
+      unsigned int const i     = s.get_idx0();
+      unsigned int const first = m_offsets[i];
+      unsigned int const last  = first + m_capacities[i];
+
+      for (unsigned int c = 0u; c < m_columns.size(); ++c)
+      {
+        std::fill( m_columns[c].begin() + first, m_columns[c].begin() + last, T() );
+      }
+    }
+
+    /**
+     * Removes all labels of 0-simplex s and gives its slots back to the table.
+     */
+    void release(Simplex0 const & s)
+    {
+      unsigned int const i = s.get_idx0();
+
+      if (i >= m_counts.size())
+        return;
+
+      clear(s);
+
+      m_abandoned     += m_capacities[i];
+      m_capacities[i]  = 0u;
+      m_offsets[i]     = 0u;
+
+      compact_if_fragmented();
+    }
+
+    /**
+     * Removes all labels and values, but keeps the attributes.
+     */
+    void clear()
+    {
+      m_offsets.clear();
+      m_counts.clear();
+      m_capacities.clear();
+      m_labels.clear();
+
+      for (unsigned int c = 0u; c < m_columns.size(); ++c)
+      {
+        m_columns[c].clear();
+      }
+
+      m_abandoned = 0u;
+    }
+
+  protected:
+
+    /**
+     * Makes sure 0-simplex s has an entry in the per-simplex arrays.
+     *
+     * @return  The index of s.
+     */
+    unsigned int touch(Simplex0 const & s)
+    {
+      unsigned int const i = s.get_idx0();
+
+      if (i >= m_counts.size())
+      {
+        m_offsets.resize(    i + 1u, 0u);
+        m_counts.resize(     i + 1u, 0u);
+        m_capacities.resize( i + 1u, 0u);
+      }
+
+      return i;
+    }
+
+    /**
+     * Moves the slots of the i'th 0-simplex to the end of the storage
+     * and grows them to the given capacity.
+     */
+    void relocate(unsigned int const & i, unsigned int const & capacity)
+    {
+      assert( capacity >= m_capacities[i] || !"relocate(): can not shrink");
+
+      unsigned int const old_first = m_offsets[i];
+      unsigned int const old_last  = old_first + m_capacities[i];
+      unsigned int const new_first = static_cast<unsigned int>(m_labels.size());
+
+      m_labels.resize( new_first + capacity, no_label() );
+
+      std::copy( m_labels.begin() + old_first, m_labels.begin() + old_last, m_labels.begin() + new_first );
+      std::fill( m_labels.begin() + old_first, m_labels.begin() + old_last, no_label() );
+
+      for (unsigned int c = 0u; c < m_columns.size(); ++c)
+      {
+        std::vector<T> & values = m_columns[c];
+
+        values.resize( new_first + capacity, T() );
+
+        std::copy( values.begin() + old_first, values.begin() + old_last, values.begin() + new_first );
+      }
+
+      m_abandoned     += m_capacities[i];
+      m_offsets[i]     = new_first;
+      m_capacities[i]  = capacity;
+
+      compact_if_fragmented();
+    }
+
+    void compact_if_fragmented()
+    {
+      if (m_abandoned > 1024u && 2u*m_abandoned > m_labels.size())
+        compact();
+    }
+
+    /**
+     * Removes all abandoned slots, storing the slots of the 0-simplices
+     * in the order of their indices.
+     */
+    void compact()
+    {
+      std::vector<unsigned int>      labels;
+      std::vector< std::vector<T> >  columns( m_columns.size() );
+
+      unsigned int const size = static_cast<unsigned int>(m_labels.size()) - m_abandoned;
+
+      labels.reserve(size);
+
+      for (unsigned int c = 0u; c < m_columns.size(); ++c)
+        columns[c].reserve(size);
+
+      for (unsigned int i = 0u; i < m_offsets.size(); ++i)
+      {
+        unsigned int const first = m_offsets[i];
+        unsigned int const last  = first + m_capacities[i];
+
+        m_offsets[i] = static_cast<unsigned int>(labels.size());
+
+        labels.insert( labels.end(), m_labels.begin() + first, m_labels.begin() + last );
+
+        for (unsigned int c = 0u; c < m_columns.size(); ++c)
+          columns[c].insert( columns[c].end(), m_columns[c].begin() + first, m_columns[c].begin() + last );
+      }
+
+      m_labels.swap(labels);
+      m_columns.swap(columns);
+
+      m_abandoned = 0u;
+    }
+
+  };
+
+} // namespace grit
+
+// GRIT_SIMPLEX0_MULTI_ATTRIBUTE_TABLE_H
+#endif
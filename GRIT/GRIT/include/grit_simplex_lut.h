@@ -0,0 +1,44 @@
+#ifndef GRIT_SIMPLEX_LUT_H
+#define GRIT_SIMPLEX_LUT_H
+
+#include <grit_simplex.h>
+
+#include <util_arena.h>
+
+#include <map>
+#include <functional>  // Needed for std::less
+#include <utility>     // Needed for std::pair
+
+namespace grit
+{
+
+  /**
+   * Lookup table from simplices of dimension k to simplices of dimension
+   * k, used for the parenting information of mesh operations.
+   *
+   * The tables can draw their nodes from a util::MonotonicArena that is
+   * reset after each mesh operation (see details::do_operations), so
+   * filling them does not cost any heap allocations. Tables created
+   * without an arena use the heap as usual.
+   */
+  template<typename S>
+  class SimplexLUTTypes
+  {
+  public:
+
+    typedef util::ArenaAllocator< std::pair<S const, S> >      allocator_type;
+    typedef std::map<S, S, std::less<S>, allocator_type>       lut_type;
+
+    static lut_type make(util::MonotonicArena & arena)
+    {
+      return lut_type( std::less<S>(), allocator_type(&arena) );
+    }
+  };
+
+  typedef SimplexLUTTypes<Simplex1>::lut_type  Simplex1LUT;
+  typedef SimplexLUTTypes<Simplex2>::lut_type  Simplex2LUT;
+
+}//end namespace grit
+
+// GRIT_SIMPLEX_LUT_H
+#endif
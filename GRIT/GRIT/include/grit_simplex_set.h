@@ -4,17 +4,55 @@
 #include <grit_simplex.h>
 
 #include <util_log.h>
+#include <util_flat_set.h>
 
 #include <set>
+#include <iterator>
 #include <cassert>
 #include <limits>
+#include <utility>   // Needed for std::move and std::swap
 
 namespace grit
 {
 
   class SimplexSetAccess;  ///< Forward declaration of SimplexSet backdoor.
 
-  class SimplexSet
+  /**
+   * Storage policy for BasicSimplexSet that keeps the simplices of each
+   * dimension in a std::set. This is the original SimplexSet backend.
+   */
+  class SimplexSetTreeStorage
+  {
+  public:
+
+    template<typename S>
+    class container
+    {
+    public:
+      typedef std::set<S> type;
+    };
+  };
+
+  /**
+   * Storage policy for BasicSimplexSet that keeps the simplices of each
+   * dimension in a sorted contiguous array. The typical 1-ring sized sets
+   * produced by star(), closure() and link() are stored inline in the
+   * SimplexSet and do not cause any heap allocations.
+   */
+  class SimplexSetFlatStorage
+  {
+  public:
+
+    template<typename S>
+    class container
+    {
+    public:
+      typedef util::FlatSet<S, 16u> type;
+    };
+  };
+
+  template<typename storage>
+  class BasicSimplexSet
   {
   public:
 
@@ -23,9 +61,15 @@ namespace grit
 
   public:
 
-    typedef std::set<Simplex0>::const_iterator simplex0_const_iterator;
-    typedef std::set<Simplex1>::const_iterator simplex1_const_iterator;
-    typedef std::set<Simplex2>::const_iterator simplex2_const_iterator;
+    typedef storage                                                  storage_type;
+
+    typedef typename storage::template container<Simplex0>::type     simplex0_container;
+    typedef typename storage::template container<Simplex1>::type     simplex1_container;
+    typedef typename storage::template container<Simplex2>::type     simplex2_container;
+
+    typedef typename simplex0_container::const_iterator simplex0_const_iterator;
+    typedef typename simplex1_container::const_iterator simplex1_const_iterator;
+    typedef typename simplex2_container::const_iterator simplex2_const_iterator;
 
     typedef simplex0_const_iterator s0_iterator;
     typedef simplex1_const_iterator s1_iterator;
@@ -33,15 +77,15 @@ namespace grit
 
   protected:
 
-    std::set<Simplex0> m_simplices0;
-    std::set<Simplex1> m_simplices1;
-    std::set<Simplex2> m_simplices2;
+    simplex0_container m_simplices0;
+    simplex1_container m_simplices1;
+    simplex2_container m_simplices2;
 
   public:
 
-    std::set<Simplex0> const & simplices0() const { return m_simplices0; }
-    std::set<Simplex1> const & simplices1() const { return m_simplices1; }
-    std::set<Simplex2> const & simplices2() const { return m_simplices2; }
+    simplex0_container const & simplices0() const { return m_simplices0; }
+    simplex1_container const & simplices1() const { return m_simplices1; }
+    simplex2_container const & simplices2() const { return m_simplices2; }
 
   public:
 
@@ -54,25 +98,25 @@ namespace grit
 
   public:
 
-    SimplexSet()
+    BasicSimplexSet()
     : m_simplices0()
     , m_simplices1()
     , m_simplices2()
     {}
 
-    virtual ~SimplexSet()
+    virtual ~BasicSimplexSet()
     {
       m_simplices0.clear();
       m_simplices1.clear();
       m_simplices2.clear();
     }
 
-    SimplexSet(SimplexSet const & A)
+    BasicSimplexSet(BasicSimplexSet const & A)
     {
       *this = A;
     }
 
-    SimplexSet const & operator=(SimplexSet const & A)
+    BasicSimplexSet const & operator=(BasicSimplexSet const & A)
     {
       if( this != &A )
       {
@@ -83,6 +127,37 @@ namespace grit
       return *this;
     }
 
+    /**
+     * Move construction and assignment hand over the storage of A, so
+     * returning or reassigning a large set does not copy any simplices.
+     * Afterwards A is valid but its content is unspecified.
+     */
+    BasicSimplexSet(BasicSimplexSet && A)
+    : m_simplices0( std::move(A.m_simplices0) )
+    , m_simplices1( std::move(A.m_simplices1) )
+    , m_simplices2( std::move(A.m_simplices2) )
+    {}
+
+    BasicSimplexSet const & operator=(BasicSimplexSet && A)
+    {
+      if( this != &A )
+      {
+        m_simplices0 = std::move(A.m_simplices0);
+        m_simplices1 = std::move(A.m_simplices1);
+        m_simplices2 = std::move(A.m_simplices2);
+      }
+      return *this;
+    }
+
+    void swap(BasicSimplexSet & A)
+    {
+      using std::swap;
+
+      swap(m_simplices0, A.m_simplices0);
+      swap(m_simplices1, A.m_simplices1);
+      swap(m_simplices2, A.m_simplices2);
+    }
+
   protected:
 
     template<typename iterator>
@@ -108,7 +183,7 @@ namespace grit
     template<typename iterator>
     void insert(iterator const & begin, iterator const & end)
     {
-      typename iterator::value_type const tag;
+      typename std::iterator_traits<iterator>::value_type const tag;
 
       range_insert(begin,end, tag);
     }
@@ -117,13 +192,24 @@ namespace grit
     void insert(Simplex1 const & s) { m_simplices1.insert(s); }
     void insert(Simplex2 const & s) { m_simplices2.insert(s); }
 
-    void insert(SimplexSet const & A)
+    void insert(BasicSimplexSet const & A)
     {
       m_simplices0.insert(A.begin0(), A.end0());
       m_simplices1.insert(A.begin1(), A.end1());
       m_simplices2.insert(A.begin2(), A.end2());
     }
 
+    /**
+     * Removes all simplices. With the flat storage the memory is kept, so
+     * a cleared set can be refilled without heap allocations.
+     */
+    void clear()
+    {
+      m_simplices0.clear();
+      m_simplices1.clear();
+      m_simplices2.clear();
+    }
+
     unsigned int size(unsigned int const & dimension) const
     {
       switch (dimension)
@@ -131,7 +217,7 @@ namespace grit
         case 0: return m_simplices0.size();
         case 1: return m_simplices1.size();
         case 2: return m_simplices2.size();
-        default: assert(false || !"SimplexSet::insert(): Unrecognized dimension");
+        default: assert(false || !"SimplexSet::size(): Unrecognized dimension");
       }
 
       return std::numeric_limits<unsigned int>::max();
@@ -225,27 +311,54 @@ namespace grit
   {
   public:
 
-    typedef std::set<Simplex0>::const_iterator simplex0_iterator;
-    typedef std::set<Simplex1>::const_iterator simplex1_iterator;
-    typedef std::set<Simplex2>::const_iterator simplex2_iterator;
+    template<typename storage>
+    static typename BasicSimplexSet<storage>::simplex0_container & simplices0(BasicSimplexSet<storage> & A) { return A.m_simplices0; }
 
-  public:
+    template<typename storage>
+    static typename BasicSimplexSet<storage>::simplex1_container & simplices1(BasicSimplexSet<storage> & A) { return A.m_simplices1; }
 
-    static std::set<Simplex0> & simplices0(SimplexSet & A) { return A.m_simplices0; }
-    static std::set<Simplex1> & simplices1(SimplexSet & A) { return A.m_simplices1; }
-    static std::set<Simplex2> & simplices2(SimplexSet & A) { return A.m_simplices2; }
+    template<typename storage>
+    static typename BasicSimplexSet<storage>::simplex2_container & simplices2(BasicSimplexSet<storage> & A) { return A.m_simplices2; }
 
   public:
 
-    static simplex0_iterator begin0(SimplexSet & A) { return A.m_simplices0.begin(); }
-    static simplex0_iterator end0(SimplexSet & A)   { return A.m_simplices0.end();   }
-    static simplex1_iterator begin1(SimplexSet & A) { return A.m_simplices1.begin(); }
-    static simplex1_iterator end1(SimplexSet & A)   { return A.m_simplices1.end();   }
-    static simplex2_iterator begin2(SimplexSet & A) { return A.m_simplices2.begin(); }
-    static simplex2_iterator end2(SimplexSet & A)   { return A.m_simplices2.end();   }
+    template<typename storage>
+    static typename BasicSimplexSet<storage>::simplex0_const_iterator begin0(BasicSimplexSet<storage> & A) { return A.m_simplices0.begin(); }
+
+    template<typename storage>
+    static typename BasicSimplexSet<storage>::simplex0_const_iterator end0(BasicSimplexSet<storage> & A)   { return A.m_simplices0.end();   }
+
+    template<typename storage>
+    static typename BasicSimplexSet<storage>::simplex1_const_iterator begin1(BasicSimplexSet<storage> & A) { return A.m_simplices1.begin(); }
+
+    template<typename storage>
+    static typename BasicSimplexSet<storage>::simplex1_const_iterator end1(BasicSimplexSet<storage> & A)   { return A.m_simplices1.end();   }
+
+    template<typename storage>
+    static typename BasicSimplexSet<storage>::simplex2_const_iterator begin2(BasicSimplexSet<storage> & A) { return A.m_simplices2.begin(); }
+
+    template<typename storage>
+    static typename BasicSimplexSet<storage>::simplex2_const_iterator end2(BasicSimplexSet<storage> & A)   { return A.m_simplices2.end();   }
 
   };
 
+  template<typename storage>
+  inline void swap(BasicSimplexSet<storage> & A, BasicSimplexSet<storage> & B)
+  {
+    A.swap(B);
+  }
+
+  /**
+   * The SimplexSet type used throughout GRIT. The flat storage backend is
+   * used when GRIT_USE_FLAT_SIMPLEX_SET is defined (controlled by the CMake
+   * option ENABLE_FLAT_SIMPLEX_SET), otherwise std::set is used.
+   */
+#ifdef GRIT_USE_FLAT_SIMPLEX_SET
+  typedef BasicSimplexSet<SimplexSetFlatStorage> SimplexSet;
+#else
+  typedef BasicSimplexSet<SimplexSetTreeStorage> SimplexSet;
+#endif
+
   template<typename S>
   class SimplexSetTypeTraits;
 
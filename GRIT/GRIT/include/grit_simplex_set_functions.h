@@ -58,11 +58,12 @@ namespace grit
     return A.end2();
   }
 
-  inline std::ostream & operator<<(std::ostream & stream, SimplexSet const & A)
+  template<typename storage>
+  inline std::ostream & operator<<(std::ostream & stream, BasicSimplexSet<storage> const & A)
   {
-    typedef SimplexSet::simplex0_const_iterator iterator0;
-    typedef SimplexSet::simplex1_const_iterator iterator1;
-    typedef SimplexSet::simplex2_const_iterator iterator2;
+    typedef typename BasicSimplexSet<storage>::simplex0_const_iterator iterator0;
+    typedef typename BasicSimplexSet<storage>::simplex1_const_iterator iterator1;
+    typedef typename BasicSimplexSet<storage>::simplex2_const_iterator iterator2;
 
     iterator0 const begin0 = A.begin0();
     iterator0 const end0   = A.end0();
@@ -92,9 +93,10 @@ namespace grit
     return stream;
   }
 
-  inline SimplexSet difference(SimplexSet const & A, SimplexSet const & B)
+  template<typename storage>
+  inline BasicSimplexSet<storage> difference(BasicSimplexSet<storage> const & A, BasicSimplexSet<storage> const & B)
   {
-    SimplexSet C;
+    BasicSimplexSet<storage> C;
 
     std::set_difference(
                         A.begin0(), A.end0(),
@@ -117,9 +119,10 @@ namespace grit
     return C;
   }
 
-  inline SimplexSet intersection(SimplexSet const & A, SimplexSet const & B)
+  template<typename storage>
+  inline BasicSimplexSet<storage> intersection(BasicSimplexSet<storage> const & A, BasicSimplexSet<storage> const & B)
   {
-    SimplexSet C;
+    BasicSimplexSet<storage> C;
 
     std::set_intersection(
                           A.begin0(), A.end0(),
@@ -142,9 +145,10 @@ namespace grit
     return C;
   }
 
-  inline SimplexSet set_union(SimplexSet const & A, SimplexSet const & B)
+  template<typename storage>
+  inline BasicSimplexSet<storage> set_union(BasicSimplexSet<storage> const & A, BasicSimplexSet<storage> const & B)
   {
-    SimplexSet C;
+    BasicSimplexSet<storage> C;
 
     std::set_union(
                    A.begin0(), A.end0(),
@@ -167,9 +171,10 @@ namespace grit
     return C;
   }
 
-  inline SimplexSet filter(SimplexSet const & A, unsigned int const & dimension)
+  template<typename storage>
+  inline BasicSimplexSet<storage> filter(BasicSimplexSet<storage> const & A, unsigned int const & dimension)
   {
-    SimplexSet C;
+    BasicSimplexSet<storage> C;
 
     switch (dimension)
     {
@@ -187,38 +192,40 @@ namespace grit
     return C;
   }
 
-  template<typename E>
-  inline SimplexSet filter(SimplexSet const & A, LogicExpression<E> const & condition)
+  template<typename storage, typename E>
+  inline BasicSimplexSet<storage> filter(BasicSimplexSet<storage> const & A, LogicExpression<E> const & condition)
   {
-    SimplexSet result;
+    typedef BasicSimplexSet<storage> simplex_set_type;
+
+    simplex_set_type result;
 
     // 2015-08-01 Kenny code review : Possible rewrite to use std::copy_if to take
     //                                advantage of any acceleration/optimization that
     //                                STL can offer over our own "naive" iteration
     //                                below.
 
-    SimplexSet::simplex0_const_iterator begin0 = A.begin0();
-    SimplexSet::simplex0_const_iterator end0   = A.end0();
+    typename simplex_set_type::simplex0_const_iterator begin0 = A.begin0();
+    typename simplex_set_type::simplex0_const_iterator end0   = A.end0();
 
-    for (SimplexSet::simplex0_const_iterator s0 = begin0; s0 != end0; ++s0)
+    for (typename simplex_set_type::simplex0_const_iterator s0 = begin0; s0 != end0; ++s0)
     {
       if (condition(*s0))
         result.insert(*s0);
     }
 
-    SimplexSet::simplex1_const_iterator begin1 = A.begin1();
-    SimplexSet::simplex1_const_iterator end1   = A.end1();
+    typename simplex_set_type::simplex1_const_iterator begin1 = A.begin1();
+    typename simplex_set_type::simplex1_const_iterator end1   = A.end1();
 
-    for (SimplexSet::simplex1_const_iterator s1 = begin1; s1 != end1; ++s1)
+    for (typename simplex_set_type::simplex1_const_iterator s1 = begin1; s1 != end1; ++s1)
     {
       if (condition(*s1))
         result.insert(*s1);
     }
 
-    SimplexSet::simplex2_const_iterator begin2 = A.begin2();
-    SimplexSet::simplex2_const_iterator end2   = A.end2();
+    typename simplex_set_type::simplex2_const_iterator begin2 = A.begin2();
+    typename simplex_set_type::simplex2_const_iterator end2   = A.end2();
 
-    for (SimplexSet::simplex2_const_iterator s2 = begin2; s2 != end2; ++s2)
+    for (typename simplex_set_type::simplex2_const_iterator s2 = begin2; s2 != end2; ++s2)
     {
       if (condition(*s2))
         result.insert(*s2);
@@ -227,22 +234,26 @@ namespace grit
     return result;
   }
 
-  inline SimplexSet compute_boundary(InterfaceMesh const & mesh, SimplexSet const & A)
+  template<typename M>
+  inline SimplexSet compute_boundary(M const & mesh, SimplexSet const & A)
   {
-    return filter(A, (IsDimension(mesh,0) || IsDimension(mesh,1)) && IsBoundary(mesh) );
+    return filter(A, (IsDimension(mesh,0) || IsDimension(mesh,1)) && BasicIsBoundary<M>(mesh) );
   }
 
-  inline SimplexSet compute_boundary(InterfaceMesh const & mesh)
+  template<typename M>
+  inline SimplexSet compute_boundary(M const & mesh)
   {
     return compute_boundary(mesh, mesh.get_all_simplices() );
   }
 
-  inline SimplexSet compute_interface(InterfaceMesh const & mesh, SimplexSet const & A)
+  template<typename M>
+  inline SimplexSet compute_interface(M const & mesh, SimplexSet const & A)
   {
-    return filter(A, (IsDimension(mesh,0) || IsDimension(mesh,1)) && IsInterface(mesh) );
+    return filter(A, (IsDimension(mesh,0) || IsDimension(mesh,1)) && BasicIsInterface<M>(mesh) );
   }
 
-  inline SimplexSet compute_interface(InterfaceMesh const & mesh)
+  template<typename M>
+  inline SimplexSet compute_interface(M const & mesh)
   {
     return compute_interface(mesh, mesh.get_all_simplices() );
   }
@@ -251,11 +262,13 @@ namespace grit
    * Get simplex set of specified label (the phase).
    *
    * @note  This function gives one the closure of all simplex 2 with the given label.
+   *        The set is maintained by the mesh and is only valid until the
+   *        mesh is changed, so copy it if the mesh is changed while it is used.
    */
-  inline SimplexSet compute_phase(InterfaceMesh const & mesh, unsigned int const & label)
+  template<typename M>
+  inline SimplexSet const & compute_phase(M const & mesh, unsigned int const & label)
   {
-    SimplexSet result = filter(mesh.get_all_simplices(), IsDimension(mesh,2) && InPhase(mesh,label) );
-    return mesh.closure(result);
+    return mesh.get_phase(label);
   }
 
 }//end namespace grit
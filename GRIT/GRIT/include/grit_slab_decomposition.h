@@ -13,6 +13,7 @@
 #include <util_log.h>
 
 #include <vector>
+#include <cmath>
 #include <cassert>
 
 namespace grit
@@ -137,25 +138,115 @@ namespace grit
       }
 
 
-    public:
+      /**
+       * Estimates the remeshing work of each triangle in @triangles. Every
+       * triangle counts as one unit of work. Most mesh operations act on or
+       * next to the interface, so a triangle with a vertex on the interface
+       * gets parameters.interface_work() extra units.
+       */
+      void compute_work(
+                        PT                            const & parameters
+                        , MI                          const & mesh
+                        , std::vector<Simplex2>       const & triangles
+                        , std::vector<T>                    & work
+                        ) const
+      {
+        T const extra = parameters.interface_work();
 
-      /*! Performs slab decomposition of @mesh into a number of subdomains, specified by @parameters.number_of_subdomains
-       *  Returns DomainManager object, containing all subdomains with separate attribute vectors.
+        work.assign( triangles.size(), T(1.0) );
+
+        if (extra <= T(0.0))
+          return;
+
+        BasicIsInterface<MI> const is_interface(mesh);
+
+        for (size_t i = 0u; i < triangles.size(); ++i)
+        {
+          if (is_interface(triangles[i].get_simplex0_idx0())
+              || is_interface(triangles[i].get_simplex0_idx1())
+              || is_interface(triangles[i].get_simplex0_idx2()))
+          {
+            work[i] += extra;
+          }
+        }
+      }
+
+      /**
+       * Helper function for partition(...). Cuts the sorted triangles into
+       * slabs of equal work. If @shifted is true the cuts are shifted by
+       * half a slab, and the pieces before the first and after the last cut
+       * form one slab. Returns false if a slab would be empty.
        */
-      DMT create_subdomains(
-                             PT const & parameters //!< simulation parameters (for number_of_subdomains)
-                           , MI const & mesh       //!< global mesh
-                           , AT const & attributes //!< global attribute manager
-                           )
+      bool cut_slabs_by_work(
+                             std::vector<Simplex2>                  const & sorted_triangles
+                             , std::vector<T>                       const & work
+                             , unsigned int                         const & number_of_subdomains
+                             , bool                                 const & shifted
+                             , std::vector< std::vector<Simplex2> >       & parts
+                             ) const
+      {
+        T total = T(0.0);
+
+        for (size_t i = 0u; i < work.size(); ++i)
+          total += work[i];
+
+        T const slab_work = total / number_of_subdomains;
+        T const offset    = shifted ? T(0.5) * slab_work : T(0.0);
+
+        parts.assign( number_of_subdomains, std::vector<Simplex2>() );
+
+        T done = T(0.0);
+
+        for (size_t i = 0u; i < sorted_triangles.size(); ++i)
+        {
+          // The slab containing the middle of the work of the triangle
+          T const middle = done + T(0.5) * work[i] - offset;
+
+          int slab = static_cast<int>( std::floor( middle / slab_work ) );
+
+          slab = std::max( slab, -1 );
+          slab = std::min( slab, static_cast<int>(number_of_subdomains) - 1 );
+
+          if (slab < 0)
+            slab = number_of_subdomains - 1;
+
+          parts[slab].push_back( sorted_triangles[i] );
+
+          done += work[i];
+        }
+
+        for (unsigned int i = 0u; i < number_of_subdomains; ++i)
+          if (parts[i].empty())
+            return false;
+
+        return true;
+      }
+
+      /**
+       * Divides the triangles of @mesh into parameters.number_of_subdomains()
+       * groups, one group per subdomain. Every triangle must be in exactly
+       * one group, and no group may be empty.
+       *
+       * The slab decomposition sorts the triangles by their smallest
+       * 0-coordinate and cuts them into slabs of equal size, or of equal
+       * estimated work when parameters.interface_work() is positive. Every
+       * second call the cuts are shifted by half a slab, so vertices frozen
+       * on a submesh boundary are processed in the next scheduler iteration.
+       *
+       * Other decompositions override this method, and reuse the creation
+       * and merging of the subdomains.
+       */
+      virtual void partition(
+                             PT                                     const & parameters
+                             , MI                                   const & mesh
+                             , AT                                   const & attributes
+                             , std::vector< std::vector<Simplex2> >       & parts
+                             )
       {
         static bool is_black = true;
 
         unsigned int const number_of_subdomains = parameters.number_of_subdomains();
 
-        // Clean up old utility containers
-        m_simplex_sets.clear();
-        m_submesh_to_mesh.clear();
-
         SimplexSet simplex_set = filter(mesh.get_all_simplices(), IsDimension(mesh,2));
 
         std::vector<Simplex2> sorted_triangles;
@@ -169,6 +260,22 @@ namespace grit
         const unsigned int triangles_total = sorted_triangles.size();
         assert(triangles_total > 0 || !"SlabDecomposition::create_submeshes(): Mesh does not contain any triangles");
 
+        if (parameters.interface_work() > 0.0)
+        {
+          std::vector<T> work;
+
+          compute_work(parameters, mesh, sorted_triangles, work);
+
+          if (cut_slabs_by_work(sorted_triangles, work, number_of_subdomains, !is_black, parts))
+          {
+            is_black = !is_black;
+            return;
+          }
+
+          // A slab got no triangles, fall back to equal triangle counts
+          parts.clear();
+        }
+
         const unsigned int subdomain_size  = triangles_total / number_of_subdomains;
         assert(subdomain_size > 0 || !"SlabDecomposition::create_submeshes(): Subdomain size < 1");
 
@@ -177,8 +284,6 @@ namespace grit
 
         typedef typename std::vector<Simplex2>::iterator iterator;
 
-        std::vector< std::vector<Simplex2> > slabs;
-
         unsigned int half_begin = subdomain_size / 2;
 
         iterator begin = sorted_triangles.begin();
@@ -198,18 +303,13 @@ namespace grit
 
           end += next;
 
-          // Create a new simplex set for slab
-          SimplexSet simplex_set;
-
-          simplex_set.insert(begin,end);
-
-          if (triangles_remaining - next <= 0 && !is_black) // the last simplex set
+          if (triangles_remaining - next <= 0 && !is_black) // the last slab
           {
-            m_simplex_sets[0] = set_union(m_simplex_sets[0], mesh.closure(simplex_set));
+            parts[0].insert(parts[0].end(), begin, end);
           }
           else
           {
-            m_simplex_sets.push_back(mesh.closure(simplex_set));
+            parts.push_back(std::vector<Simplex2>(begin, end));
           }
 
           begin = end;
@@ -217,7 +317,42 @@ namespace grit
           next = std::min(subdomain_size, triangles_remaining);
         }
 
-        assert((number_of_subdomains == m_simplex_sets.size()) || !"SlabDecomposition::create_submeshes(): Wrong number of simplex sets created");
+        is_black = !is_black;
+      }
+
+    public:
+
+      /*! Performs a domain decomposition of @mesh into a number of subdomains, specified by @parameters.number_of_subdomains
+       *  Returns DomainManager object, containing all subdomains with separate attribute vectors.
+       */
+      DMT create_subdomains(
+                             PT const & parameters //!< simulation parameters (for number_of_subdomains)
+                           , MI const & mesh       //!< global mesh
+                           , AT const & attributes //!< global attribute manager
+                           )
+      {
+        unsigned int const number_of_subdomains = parameters.number_of_subdomains();
+
+        // Clean up old utility containers
+        m_simplex_sets.clear();
+        m_submesh_to_mesh.clear();
+
+        std::vector< std::vector<Simplex2> > parts;
+
+        partition(parameters, mesh, attributes, parts);
+
+        assert((number_of_subdomains == parts.size()) || !"SlabDecomposition::create_submeshes(): Wrong number of simplex sets created");
+
+        for (unsigned int i = 0u; i < number_of_subdomains; ++i)
+        {
+          assert(!parts[i].empty() || !"SlabDecomposition::create_submeshes(): Empty subdomain created");
+
+          SimplexSet simplex_set;
+
+          simplex_set.insert(parts[i].begin(), parts[i].end());
+
+          m_simplex_sets.push_back(mesh.closure(simplex_set));
+        }
 
         for (unsigned int i = 0u; i < number_of_subdomains; ++i)
         {
@@ -261,7 +396,13 @@ namespace grit
             }
           }
 
-          // Insert triangles
+          // Insert triangles, all at once into the empty submesh
+          std::vector<Simplex0>     triangles;
+          std::vector<unsigned int> labels;
+
+          triangles.reserve(3u*m_simplex_sets[i].size(2u));
+          labels.reserve(m_simplex_sets[i].size(2u));
+
           for (SimplexSet::simplex2_const_iterator it = m_simplex_sets[i].begin2(); it != m_simplex_sets[i].end2(); ++it)
           {
             Simplex2 s = *it;
@@ -269,12 +410,16 @@ namespace grit
             Simplex0 s1 = mesh_to_submesh[s.get_simplex0_idx1()];
             Simplex0 s2 = mesh_to_submesh[s.get_simplex0_idx2()];
 
-            Simplex2 s_new = domains.subdomain(i).mesh().insert(s0, s1, s2);
+            triangles.push_back(s0);
+            triangles.push_back(s1);
+            triangles.push_back(s2);
+            labels.push_back(mesh.label(s));
 
-            AMT::copy_attribute_values( s, s_new, attributes, domains.subdomain(i).attributes());
-            domains.subdomain(i).mesh().label(s_new) = mesh.label(s);
+            AMT::copy_attribute_values( s, Simplex2(s0, s1, s2), attributes, domains.subdomain(i).attributes());
           }
 
+          domains.subdomain(i).mesh().insert(triangles, labels);
+
           // Insert edges
           for (SimplexSet::simplex1_const_iterator it = m_simplex_sets[i].begin1(); it != m_simplex_sets[i].end1(); ++it)
           {
@@ -289,11 +434,28 @@ namespace grit
 
         }
 
-        is_black = !is_black;
-
         return domains;
       }
 
+      /*! Splits @mesh into @parameters.number_of_subdomains regions, with the same cuts as create_subdomains(...)
+       *  would use. No submeshes are created, the algorithms work on @mesh in place.
+       */
+      void create_regions(
+                           PT const & parameters //!< simulation parameters (for number_of_subdomains)
+                         , MI       & mesh       //!< global mesh
+                         , AT const & attributes //!< global attribute manager
+                         , MeshRegions & regions //!< upon return, the owner of every vertex
+                         )
+      {
+        std::vector< std::vector<Simplex2> > parts;
+
+        partition(parameters, mesh, attributes, parts);
+
+        assert((parameters.number_of_subdomains() == parts.size()) || !"SlabDecomposition::create_regions(): Wrong number of regions created");
+
+        regions.claim(parts, mesh);
+      }
+
       /*! Merges processed subdomains (@domains) into a single, global @mesh, and updates global @attributes.
        *
        */
@@ -310,6 +472,11 @@ namespace grit
 
         new_mesh.m_coords = &(attributes.current());
 
+        // The triangles of all subdomains are inserted at once at the end,
+        // when all vertices are in the new mesh
+        std::vector<Simplex0>     triangles;
+        std::vector<unsigned int> labels;
+
         // 2015-12-11 Marek: the line below is not necessary in the current set-up (i.e. as the PThreadScheduler is
         //                   implemented, however, if someone passes empty attributes as an argument, the code will fail.
         //                   Perhaps an assertion's neeeded, otherwise uncommenting this line makes the code copy the
@@ -363,11 +530,12 @@ namespace grit
             Simplex0 _s1 = s1_boundary ? mesh_to_new_mesh[m_submesh_to_mesh[i][s1]] : submesh_to_new_mesh[s1];
             Simplex0 _s2 = s2_boundary ? mesh_to_new_mesh[m_submesh_to_mesh[i][s2]] : submesh_to_new_mesh[s2];
 
-            Simplex2 s = new_mesh.insert(_s0, _s1, _s2);
+            triangles.push_back(_s0);
+            triangles.push_back(_s1);
+            triangles.push_back(_s2);
+            labels.push_back(domains.subdomain(i).mesh().label(*it));
 
-            AMT::copy_attribute_values( *it, s, domains.subdomain(i).attributes(), attributes);
-
-            new_mesh.label(s) = domains.subdomain(i).mesh().label(*it);
+            AMT::copy_attribute_values( *it, Simplex2(_s0, _s1, _s2), domains.subdomain(i).attributes(), attributes);
           }
 
           //--- Note that the attributes for 1-simplices on the subdomain boundary are added twice.
@@ -390,6 +558,8 @@ namespace grit
           }
         }
 
+        new_mesh.insert(triangles, labels);
+
         mesh = new_mesh;
       }
 
@@ -0,0 +1,243 @@
+#ifndef GRIT_SPATIAL_HASH_H
+#define GRIT_SPATIAL_HASH_H
+
+#include <grit_simplex.h>
+#include <grit_simplex_set.h>
+
+#include <unordered_map>
+#include <vector>
+#include <cmath>     // Needed for std::floor and std::fabs
+#include <cassert>
+#include <cstddef>   // Needed for std::size_t
+#include <limits>    // Needed for std::numeric_limits
+
+namespace grit
+{
+
+  /**
+   * Spatial Hash.
+   * A uniform grid over the plane where only non-empty cells are stored,
+   * in a hash table keyed on the integer cell coordinates. Vertices are
+   * inserted with their coordinates, and proximity queries only visit the
+   * cells overlapping the query box.
+   *
+   * Distances are measured as the largest absolute coordinate difference
+   * (norm_1 in OpenTissue terms), so a query box is exactly the set of
+   * points within the query radius. With a cell size close to the query
+   * radius a query visits a constant number of cells, and building the
+   * grid and querying every vertex takes expected linear time.
+   *
+   * Only the x- and y-components of the coordinates are used.
+   *
+   * @tparam V   The coordinate vector type.
+   */
+  template<typename V>
+  class SpatialHash
+  {
+  public:
+
+    typedef typename V::value_type    T;
+    typedef typename V::value_traits  VT;
+
+  protected:
+
+    /**
+     * The integer coordinates of a grid cell.
+     */
+    class cell_type
+    {
+    public:
+
+      long long m_i;
+      long long m_j;
+
+      cell_type(long long const & i, long long const & j)
+      : m_i(i)
+      , m_j(j)
+      {}
+
+      bool operator==(cell_type const & c) const { return m_i == c.m_i && m_j == c.m_j; }
+    };
+
+    class cell_hash
+    {
+    public:
+
+      std::size_t operator()(cell_type const & c) const
+      {
+        // Mixing the two coordinates with large odd constants, so that
+        // neighbouring cells do not end up in neighbouring buckets
+        unsigned long long const h = static_cast<unsigned long long>(c.m_i) * 0x9E3779B97F4A7C15ull
+                                   ^ static_cast<unsigned long long>(c.m_j) * 0xC2B2AE3D27D4EB4Full;
+
+        return static_cast<std::size_t>( h ^ (h >> 32) );
+      }
+    };
+
+    /**
+     * A vertex in the grid. The vertices of a cell form a linked list
+     * through m_next, so a cell only costs one hash table entry.
+     */
+    class entry_type
+    {
+    public:
+
+      Simplex0      m_simplex;
+      V             m_position;
+      unsigned int  m_next;      ///< Index of the next entry in the same cell, or null_entry().
+    };
+
+    static unsigned int null_entry() { return std::numeric_limits<unsigned int>::max(); }
+
+  protected:
+
+    T                                                       m_cell_size;   ///< Side length of the grid cells.
+    std::unordered_map<cell_type, unsigned int, cell_hash>  m_cells;       ///< Index of the first entry of each non-empty cell.
+    std::vector<entry_type>                                 m_entries;     ///< All inserted vertices.
+
+  protected:
+
+    long long cell_coordinate(T const & x) const
+    {
+      using std::floor;
+
+      return static_cast<long long>( floor( x / m_cell_size ) );
+    }
+
+  public:
+
+    /**
+     * @param cell_size   The side length of the grid cells, a good choice
+     *                    is the typical query radius.
+     */
+    SpatialHash(T const & cell_size)
+    : m_cell_size(cell_size)
+    , m_cells()
+    , m_entries()
+    {
+      assert( cell_size > VT::zero() || !"SpatialHash(): cell size must be positive");
+    }
+
+  public:
+
+    T const & cell_size() const { return m_cell_size; }
+
+    std::size_t size() const { return m_entries.size(); }
+
+    void clear()
+    {
+      m_cells.clear();
+      m_entries.clear();
+    }
+
+    void reserve(std::size_t const & n)
+    {
+      m_cells.reserve(n);
+      m_entries.reserve(n);
+    }
+
+    void insert(Simplex0 const & s, V const & p)
+    {
+      cell_type const cell( cell_coordinate(p[0]), cell_coordinate(p[1]) );
+
+      entry_type e;
+
+      e.m_simplex  = s;
+      e.m_position = p;
+      e.m_next     = null_entry();
+
+      unsigned int const idx = static_cast<unsigned int>( m_entries.size() );
+
+      std::pair<typename std::unordered_map<cell_type, unsigned int, cell_hash>::iterator, bool> const result = m_cells.insert( std::make_pair(cell, idx) );
+
+      if (!result.second)
+      {
+        e.m_next              = result.first->second;
+        result.first->second  = idx;
+      }
+
+      m_entries.push_back(e);
+    }
+
+    /**
+     * Inserts all vertices of S with their current coordinates.
+     */
+    template<typename AMT>
+    void insert(SimplexSet const & S, AMT const & attributes)
+    {
+      reserve( m_entries.size() + S.size(0u) );
+
+      for (SimplexSet::simplex0_const_iterator it = S.begin0(); it != S.end0(); ++it)
+        insert( *it, attributes.get_current_value( *it ) );
+    }
+
+    /**
+     * Visits every inserted vertex closer than radius to p, and calls
+     * visitor(s, q) with the vertex and its coordinates. The visitor can
+     * stop the query early by returning true.
+     *
+     * @return   True if the visitor stopped the query.
+     */
+    template<typename F>
+    bool visit(V const & p, T const & radius, F const & visitor) const
+    {
+      using std::fabs;
+
+      // The box [p - radius, p + radius] covers every point closer than
+      // radius, and flooring is monotone, so its corner cells bound all
+      // the cells that need to be visited
+      long long const i_min = cell_coordinate( p[0] - radius );
+      long long const i_max = cell_coordinate( p[0] + radius );
+      long long const j_min = cell_coordinate( p[1] - radius );
+      long long const j_max = cell_coordinate( p[1] + radius );
+
+      for (long long i = i_min; i <= i_max; ++i)
+      {
+        for (long long j = j_min; j <= j_max; ++j)
+        {
+          typename std::unordered_map<cell_type, unsigned int, cell_hash>::const_iterator const cell = m_cells.find( cell_type(i, j) );
+
+          if (cell == m_cells.end())
+            continue;
+
+          for (unsigned int idx = cell->second; idx != null_entry(); idx = m_entries[idx].m_next)
+          {
+            entry_type const & e = m_entries[idx];
+
+            if (fabs( e.m_position[0] - p[0] ) < radius && fabs( e.m_position[1] - p[1] ) < radius)
+            {
+              if (visitor(e.m_simplex, e.m_position))
+                return true;
+            }
+          }
+        }
+      }
+
+      return false;
+    }
+
+    /**
+     * Upon return result holds all inserted vertices closer than radius
+     * to p.
+     */
+    void query(V const & p, T const & radius, std::vector<Simplex0> & result) const
+    {
+      result.clear();
+
+      visit(p, radius, [&result](Simplex0 const & s, V const & ) { result.push_back(s); return false; } );
+    }
+
+    /**
+     * @return   True if any inserted vertex is closer than radius to p.
+     */
+    bool has_within(V const & p, T const & radius) const
+    {
+      return visit(p, radius, [](Simplex0 const & , V const & ) { return true; } );
+    }
+
+  };
+
+}//end namespace grit
+
+// GRIT_SPATIAL_HASH_H
+#endif
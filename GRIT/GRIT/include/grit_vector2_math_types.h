@@ -0,0 +1,78 @@
+#ifndef GRIT_VECTOR2_MATH_TYPES_H
+#define GRIT_VECTOR2_MATH_TYPES_H
+
+#include <util_vector2.h>
+#include <util_is_finite.h>
+#include <util_is_number.h>
+
+#include <limits>
+
+namespace grit
+{
+
+  /**
+   * Math types using the compact util::Vector2 as coordinate type. This
+   * offers the same interface as OpenTissueMathTypes, but coordinates do
+   * not carry an unused z-component. The type keeps the name vector3_type
+   * so it can be used everywhere an OpenTissue vector is expected.
+   */
+  template <typename mesh_type>
+  class Vector2MathTypes
+  {
+  public:
+
+    typedef typename mesh_type::math_types::real_type    real_type;
+    typedef util::Vector2<real_type>                     vector3_type;
+    typedef typename vector3_type::value_traits          VT;
+
+    static real_type length(vector3_type const & v)
+    {
+      return util::length(v);
+    }
+
+    static real_type sqr_distance(vector3_type const & v1, vector3_type const & v2)
+    {
+      return util::sqr_distance(v1, v2);
+    }
+
+    static vector3_type perpendicular(vector3_type const & v)
+    {
+      return vector3_type(-v[1u], v[0u]);
+    }
+
+    static vector3_type normalize(vector3_type const & v)
+    {
+      return util::unit(v);
+    }
+
+    static real_type dot(vector3_type const & v1, vector3_type const & v2)
+    {
+      return v1[0u]*v2[0u]+v1[1u]*v2[1u];
+    }
+
+    static real_type infinity()
+    {
+      return std::numeric_limits<real_type>::infinity();
+    }
+
+    static real_type zero()
+    {
+      return VT::zero();
+    }
+
+    static real_type pi()
+    {
+      return VT::pi();
+    }
+
+    static real_type deg_to_rad(real_type const t)
+    {
+      return t*VT::pi()/180.;
+    }
+
+  };
+
+}//end namespace grit
+
+// GRIT_VECTOR2_MATH_TYPES_H
+#endif
@@ -197,6 +197,13 @@ namespace grit
       unsigned int j_node_number      = 0;
       unsigned int k_node_number      = 0;
 
+      //--- Triangles are collected and inserted all at once after the block
+      std::vector<Simplex0>     triangles;
+      std::vector<unsigned int> labels;
+
+      triangles.reserve(3u*triangle_count);
+      labels.reserve(triangle_count);
+
       for(unsigned int e =0u; e < triangle_count;++e)
       {
         file >> elm_number;
@@ -245,10 +252,13 @@ namespace grit
         assert(edge_counter.count(j,k) <= 2u || !"load_from_msh(): non-manifold mesh input");
         assert(edge_counter.count(k,i) <= 2u || !"load_from_msh(): non-manifold mesh input");
 
-        Simplex2 const s2 = mesh.insert(i, j, k);
-
-        mesh.label(s2)    = physical_entity;
+        triangles.push_back(i);
+        triangles.push_back(j);
+        triangles.push_back(k);
+        labels.push_back(physical_entity);
       }
+
+      mesh.insert(triangles, labels);
     }
     file >> block_end;
     if (block_end.compare("$EndElements")!=0)
@@ -11,6 +11,8 @@
 #include <fstream>
 #include <stdexcept>
 #include <vector>
+#include <unordered_map>
+#include <utility>   // Needed for std::pair
 
 namespace grit
 {
@@ -38,6 +40,12 @@ namespace grit
 
     std::vector<Simplex0> import_to_mesh = std::vector<Simplex0>();
 
+    //--- Triangles are collected and inserted all at once at the end of the file
+    std::vector<Simplex0>                            triangles;
+    std::vector<unsigned int>                        labels;
+    std::unordered_map<Simplex2, unsigned int>       triangle_index;
+    std::vector< std::pair<Simplex2, unsigned int> > label_lines;
+
     io::EdgeCounter   edge_counter;
 
     if (!file.good())
@@ -108,7 +116,12 @@ namespace grit
         assert(edge_counter.count(s1,s2) <= 2u || !"load_from_txt(): non-manifold mesh input");
         assert(edge_counter.count(s2,s0) <= 2u || !"load_from_txt(): non-manifold mesh input");
 
-        mesh.insert(s0, s1, s2);
+        triangle_index[ Simplex2(s0, s1, s2) ] = triangle_count;
+
+        triangles.push_back(s0);
+        triangles.push_back(s1);
+        triangles.push_back(s2);
+        labels.push_back(0u);
 
         triangle_count++;
       }
@@ -134,7 +147,7 @@ namespace grit
         Simplex0 s1 = import_to_mesh[ util::to_zero_based(idx1) ];
         Simplex0 s2 = import_to_mesh[ util::to_zero_based(idx2) ];
 
-        mesh.label( Simplex2(s0, s1, s2) ) = phase;
+        label_lines.push_back( std::make_pair( Simplex2(s0, s1, s2), phase ) );
       }
       else if (c == '#') // end of file
       {
@@ -146,6 +159,21 @@ namespace grit
       }
     }
 
+    for(size_t i = 0u; i < label_lines.size(); ++i)
+    {
+      std::unordered_map<Simplex2, unsigned int>::const_iterator const lookup = triangle_index.find( label_lines[i].first );
+
+      if(lookup == triangle_index.end())
+      {
+        log << "load_from_txt(): Found label of a triangle that is not in the mesh. Possible error in input file" << newline;
+        continue;
+      }
+
+      labels[lookup->second] = label_lines[i].second;
+    }
+
+    mesh.insert(triangles, labels);
+
     log << newline;
     log << "load_from_txt("<< filename << "): Vertices: " << vertex_count << ", Triangles: " << triangle_count << "." << newline;
     log << newline;
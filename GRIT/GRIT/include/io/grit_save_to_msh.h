@@ -142,7 +142,7 @@ namespace grit
         unsigned int node_number = util::to_one_based( counter );
         double x_coord = coords[s][0];
         double y_coord = coords[s][1];
-        double z_coord = coords[s][2];
+        double z_coord = 0.0;   // GRIT meshes are planar
 
         file << node_number << " " << x_coord << " " << y_coord << " " << z_coord << std::endl;
       }
@@ -225,7 +225,7 @@ namespace grit
         unsigned int node_number = util::to_one_based( s.get_idx0() );
         double x_coord = coords[s][0];
         double y_coord = coords[s][1];
-        double z_coord = coords[s][2];
+        double z_coord = 0.0;   // GRIT meshes are planar
 
         file << node_number << " " << x_coord << " " << y_coord << " " << z_coord << std::endl;
       }
@@ -19,6 +19,7 @@ namespace grit
       typedef typename types::math_types              MT;
       typedef typename types::attributes_type         AT;
       typedef typename types::param_type              PT;
+      typedef typename types::mesh_impl               MI;
 
       typedef typename V::value_traits                VT;
 
@@ -42,7 +43,7 @@ namespace grit
     public:
 
       void init(
-                InterfaceMesh  const & mesh
+                MI             const & mesh
                 , AT  & attributes
                 )
       { }
@@ -51,7 +52,7 @@ namespace grit
 
       bool update_local_attributes(
                                     Simplex1 const & simplex
-                                  , InterfaceMesh const & mesh
+                                  , MI            const & mesh
                                   , AT & attributes
                                   )
       {
@@ -62,12 +63,12 @@ namespace grit
 
       bool plan_local_connectivity_changes(
                                            Simplex1                 const & simplex
-                                           , InterfaceMesh                & mesh
+                                           , MI                           & mesh
                                            , AT                     const & attributes
                                            , SimplexSet                   & new_simplices
                                            , SimplexSet                   & old_simplices
-                                           , std::map<Simplex1, Simplex1> & simplex1_lut
-                                           , std::map<Simplex2, Simplex2> & simplex2_lut
+                                           , Simplex1LUT & simplex1_lut
+                                           , Simplex2LUT & simplex2_lut
                                            )
       {
         //--- Finding the subset of vertices in C, which are eligible for collapsing
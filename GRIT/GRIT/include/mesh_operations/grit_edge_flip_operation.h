@@ -34,6 +34,12 @@ namespace grit
 
       typedef typename types::attributes_type         AMT;
       typedef typename types::param_type              PT;
+      typedef typename types::mesh_impl               MI;
+
+      typedef BasicIsBoundary<MI>                     IsBoundary;
+      typedef BasicIsInterface<MI>                    IsInterface;
+      typedef BasicIsSubmeshBoundary<MI>              IsSubmeshBoundary;
+      typedef BasicIsValid<MI>                        IsValid;
 
     protected:
 
@@ -54,14 +60,14 @@ namespace grit
       { }
 
       void init(
-                 InterfaceMesh  const & mesh
+                 MI             const & mesh
                , AMT  & attributes
                )
       { }
 
       bool update_local_attributes(
                                     Simplex1 const & simplex
-                                  , InterfaceMesh const & mesh
+                                  , MI            const & mesh
                                   , AMT & attributes
                                   )
       {
@@ -70,12 +76,12 @@ namespace grit
 
       bool plan_local_connectivity_changes(
                                            Simplex1               const & simplex
-                                           , InterfaceMesh                & mesh
+                                           , MI                           & mesh
                                            , AMT                    const & attributes
                                            , SimplexSet                   & new_simplices
                                            , SimplexSet                   & old_simplices
-                                           , std::map<Simplex1, Simplex1> & simplex1_lut
-                                           , std::map<Simplex2, Simplex2> & simplex2_lut
+                                           , Simplex1LUT & simplex1_lut
+                                           , Simplex2LUT & simplex2_lut
                                            )
       {
         if( IsInterface(mesh)(simplex) || IsSubmeshBoundary(mesh)(simplex) || IsBoundary(mesh)(simplex) || !IsValid(mesh)(simplex))
@@ -109,6 +115,11 @@ namespace grit
         extract_simplices(v1, v2, Vs);
         extract_simplices(w1, w2, W);
 
+        // The opposite vertices may already be joined by an edge outside
+        // the two triangles, then the flip would create that edge twice
+        if (IsValid(mesh)(Simplex1(w1, w2)))
+          return false;
+
         Simplex2 t1, t2;
         extract_simplices( t1, t2, T);
 
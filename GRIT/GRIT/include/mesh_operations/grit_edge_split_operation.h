@@ -36,6 +36,10 @@ namespace grit
 
       typedef typename types::attributes_type         AMT;
       typedef typename types::param_type              PT;
+      typedef typename types::mesh_impl               MI;
+
+      typedef BasicIsSubmeshBoundary<MI>              IsSubmeshBoundary;
+      typedef BasicIsValid<MI>                        IsValid;
 
     protected:
 
@@ -57,14 +61,14 @@ namespace grit
       { }
 
       void init(
-                 InterfaceMesh  const & mesh
+                 MI             const & mesh
                , AMT  & attributes
                )
       { }
 
       bool update_local_attributes(
                                     Simplex1 const & simplex
-                                  , InterfaceMesh const & mesh
+                                  , MI            const & mesh
                                   , AMT & attributes
                                   )
       {
@@ -73,12 +77,12 @@ namespace grit
 
       bool plan_local_connectivity_changes(
                                            Simplex1                 const & simplex
-                                           , InterfaceMesh                & mesh
+                                           , MI                           & mesh
                                            , AMT                    const & attributes
                                            , SimplexSet                   & new_simplices
                                            , SimplexSet                   & old_simplices
-                                           , std::map<Simplex1, Simplex1> & simplex1_lut
-                                           , std::map<Simplex2, Simplex2> & simplex2_lut
+                                           , Simplex1LUT & simplex1_lut
+                                           , Simplex2LUT & simplex2_lut
                                            )
       {
         if( IsSubmeshBoundary(mesh)(simplex) || !IsValid(mesh)(simplex))
@@ -44,6 +44,7 @@ namespace grit
       typedef typename types::math_types               MT;
       typedef typename types::attributes_type          AT;
       typedef typename types::param_type               PT;
+      typedef typename types::mesh_impl                MI;
 
       typedef typename V::value_traits                 VT;
 
@@ -73,7 +74,7 @@ namespace grit
     public:
 
       void init(
-                InterfaceMesh const & mesh
+                MI            const & mesh
                 , AT                & attributes
                 )
       { }
@@ -82,7 +83,7 @@ namespace grit
 
       bool update_local_attributes(
                                    Simplex1        const & simplex
-                                   , InterfaceMesh const & mesh
+                                   , MI            const & mesh
                                    , AT                  & attributes
                                    )
       {
@@ -110,7 +111,7 @@ namespace grit
                     Simplex0            const & from
                     , Simplex0          const & to
                     , Simplex1          const & simplex
-                    , InterfaceMesh           & mesh
+                    , MI                      & mesh
                     , AT                const & attributes
                     , SimplexSet              & new_simplices
                     , SimplexSet              & old_simplices
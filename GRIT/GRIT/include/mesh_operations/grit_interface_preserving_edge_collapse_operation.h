@@ -20,6 +20,10 @@ namespace grit
       typedef typename types::math_types              MT;
       typedef typename types::attributes_type         AT;
       typedef typename types::param_type              PT;
+      typedef typename types::mesh_impl               MI;
+
+      typedef BasicIsBoundary<MI>                     IsBoundary;
+      typedef BasicIsInterface<MI>                    IsInterface;
 
       typedef typename V::value_traits                VT;
 
@@ -50,7 +54,7 @@ namespace grit
     public:
 
       void init(
-                InterfaceMesh  const & mesh
+                MI             const & mesh
                 , AT  & attributes
                 )
       { }
@@ -59,7 +63,7 @@ namespace grit
 
       bool update_local_attributes(
                                     Simplex1 const & simplex
-                                  , InterfaceMesh const & mesh
+                                  , MI            const & mesh
                                   , AT & attributes
                                   )
       {
@@ -70,7 +74,7 @@ namespace grit
 
       bool plan_local_connectivity_changes(
                                            Simplex1            const & simplex
-                                           , InterfaceMesh           & mesh
+                                           , MI                      & mesh
                                            , AT                const & attributes
                                            , SimplexSet              & new_simplices
                                            , SimplexSet              & old_simplices
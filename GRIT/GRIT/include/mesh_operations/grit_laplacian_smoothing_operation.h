@@ -39,6 +39,12 @@ namespace grit
       typedef typename types::math_types              MT;
       typedef typename types::attributes_type         AT;
       typedef typename types::param_type              PT;
+      typedef typename types::mesh_impl               MI;
+
+      typedef BasicIsBoundary<MI>                     IsBoundary;
+      typedef BasicIsInterface<MI>                    IsInterface;
+      typedef BasicIsSubmeshBoundary<MI>              IsSubmeshBoundary;
+      typedef BasicIsValid<MI>                        IsValid;
 
       typedef typename V::value_traits                VT;
 
@@ -58,6 +64,10 @@ namespace grit
 
       CT                   m_new_positions;         ///< precomputed new positions for the vertices
 
+      SimplexSet           m_link;                  ///< Scratch set reused for the link of each vertex.
+
+      SimplexSet           m_star;                  ///< Scratch set reused for the star of each vertex.
+
     public:
 
       LaplacianSmoothingOperation(
@@ -73,7 +83,7 @@ namespace grit
 
 
       void init(
-                InterfaceMesh const & mesh
+                MI            const & mesh
                 , AT                & attributes
                 )
       {
@@ -87,7 +97,9 @@ namespace grit
         {
           Simplex0 const & simplex = *it;
 
-          SimplexSet const link0 = filter( mesh.link(simplex), IsDimension( mesh, 0u));
+          mesh.link(simplex, m_link);
+
+          SimplexSet const & link0 = m_link;  // Only the 0-simplices of the link are used
 
           int const n = link0.size(0u);
 
@@ -103,7 +115,7 @@ namespace grit
 
       bool update_local_attributes(
                                     Simplex0      const & simplex
-                                  , InterfaceMesh const & mesh
+                                  , MI            const & mesh
                                   , AT                  & attributes
                                   )
       {
@@ -119,7 +131,9 @@ namespace grit
 
         V const & new_pos = m_new_positions[simplex];
 
-        SimplexSet const S = filter( mesh.star(simplex), IsDimension( mesh, 2u));
+        mesh.star(simplex, m_star);
+
+        SimplexSet const & S = m_star;  // Only the 2-simplices of the star are used
 
         if (is_any_inverted( simplex, S, attributes, new_pos))
         {
@@ -133,8 +147,8 @@ namespace grit
           {
             Simplex2 const s2 = *it;
 
-            std::vector<Simplex0> vertices(3u);
-            std::vector<V>        positions(3u);
+            Simplex0 vertices[3u];
+            V        positions[3u];
 
             for (unsigned int i = 0u; i < 3u; ++i)
             {
@@ -142,7 +156,7 @@ namespace grit
               positions[i] = attributes.get_current_value(vertices[i]);
             }
 
-            std::vector<T> b_coords( 3u, VT::zero() );
+            T b_coords[3u] = { VT::zero(), VT::zero(), VT::zero() };
 
             util::barycentric(
                               positions[0u], positions[1u], positions[2u]
@@ -154,17 +168,15 @@ namespace grit
             {
               std::vector< std::string> const & attribute_names = attributes.simplex0_attribute_names();
 
-              name_iterator name_it = attribute_names.begin();
-
-              for ( ; name_it != attribute_names.end(); ++name_it)
+              for ( unsigned int n = 0u; n < attribute_names.size(); ++n)
               {
-                std::string const & attribute_name = *name_it;
+                AttributeHandle const h( 0u, n);
 
-                T val = b_coords[0u] * attributes.get_attribute_value( attribute_name, vertices[0u], m_label)
-                      + b_coords[1u] * attributes.get_attribute_value( attribute_name, vertices[1u], m_label)
-                      + b_coords[2u] * attributes.get_attribute_value( attribute_name, vertices[2u], m_label);
+                T val = b_coords[0u] * attributes.get_attribute_value( h, vertices[0u], m_label)
+                      + b_coords[1u] * attributes.get_attribute_value( h, vertices[1u], m_label)
+                      + b_coords[2u] * attributes.get_attribute_value( h, vertices[2u], m_label);
 
-                attributes.set_attribute_value( *name_it, simplex, m_label, val);
+                attributes.set_attribute_value( h, simplex, m_label, val);
               }
 
               break;
@@ -180,12 +192,12 @@ namespace grit
 
       bool plan_local_connectivity_changes(
                                            Simplex0                 const & /* simplex */
-                                           , InterfaceMesh                & /* mesh */
+                                           , MI                           & /* mesh */
                                            , AT                     const & /* attributes */
                                            , SimplexSet                   & /* new_simplices */
                                            , SimplexSet                   & /* old_simplices */
-                                           , std::map<Simplex1, Simplex1> & /* simplex1_lut */
-                                           , std::map<Simplex2, Simplex2> & /* simplex2_lut */
+                                           , Simplex1LUT & /* simplex1_lut */
+                                           , Simplex2LUT & /* simplex2_lut */
                                            )
       {
         return false;
@@ -39,6 +39,9 @@ namespace grit
 
       typedef typename types::attributes_type  AMT;
       typedef typename types::param_type       PT;
+      typedef typename types::mesh_impl        MI;
+
+      typedef BasicIsSubmeshBoundary<MI>       IsSubmeshBoundary;
 
     protected:
 
@@ -66,14 +69,14 @@ namespace grit
       { }
 
       void init(
-                 InterfaceMesh  const & mesh
+                 MI             const & mesh
                , AMT  & attributes
                )
       { }
 
       bool update_local_attributes(
                                     Simplex2 const & simplex
-                                  , InterfaceMesh  const & mesh
+                                  , MI             const & mesh
                                   , AMT & attributes
                                   )
       {
@@ -82,12 +85,12 @@ namespace grit
 
       bool plan_local_connectivity_changes(
                                            Simplex2                 const & simplex
-                                           , InterfaceMesh                & mesh
+                                           , MI                           & mesh
                                            , AMT                    const & attributes
                                            , SimplexSet                   & new_simplices
                                            , SimplexSet                   & old_simplices
-                                           , std::map<Simplex1, Simplex1> & simplex1_lut
-                                           , std::map<Simplex2, Simplex2> & simplex2_lut
+                                           , Simplex1LUT & simplex1_lut
+                                           , Simplex2LUT & simplex2_lut
                                            )
       {
         Simplex1 max_edge;
@@ -3,6 +3,7 @@
 
 #include <grit_interface_mesh_operation.h>
 #include <grit_interface_mesh.h>
+#include <grit_attribute_handle.h>
 
 #include <grit_logic_expressions.h>
 #include <grit_simplex.h>
@@ -38,6 +39,12 @@ namespace grit
 
       typedef typename types::attributes_type  AMT;
       typedef typename types::param_type       PT;
+      typedef typename types::mesh_impl        MI;
+
+      typedef BasicIsBoundary<MI>              IsBoundary;
+      typedef BasicIsInterface<MI>             IsInterface;
+      typedef BasicIsSubmeshBoundary<MI>       IsSubmeshBoundary;
+      typedef BasicIsValid<MI>                 IsValid;
 
     protected:
 
@@ -46,6 +53,9 @@ namespace grit
 
       PT           const & m_parameters;            ///< Parameters container.
 
+      AttributeHandle      m_target_x;              ///< Handle of the "__move_substep_target_x" attribute.
+      AttributeHandle      m_target_y;              ///< Handle of the "__move_substep_target_y" attribute.
+
     public:
 
       MoveOperation(
@@ -56,19 +66,24 @@ namespace grit
       : m_operation_name( operation_name)
       , m_label( label)
       , m_parameters( parameters)
+      , m_target_x()
+      , m_target_y()
       { }
 
 
       void init(
-                 InterfaceMesh  const & mesh
+                 MI             const & mesh
                , AMT  & attributes
                )
-      { }
+      {
+        m_target_x = attributes.get_attribute_handle( "__move_substep_target_x", 0u);
+        m_target_y = attributes.get_attribute_handle( "__move_substep_target_y", 0u);
+      }
 
 
       bool update_local_attributes(
                                     Simplex0 const & simplex
-                                  , InterfaceMesh  const & mesh
+                                  , MI             const & mesh
                                   , AMT            & attributes
                                   )
       {
@@ -78,12 +93,11 @@ namespace grit
         if (!IsInterface(mesh)(simplex) && m_parameters.use_only_interface())
           return false;
 
-        if( attributes.exist_attribute("__move_substep_target_x", 0u)
-         && attributes.exist_attribute("__move_substep_target_y", 0u))
+        if( !m_target_x.is_null() && !m_target_y.is_null())
         {
           V new_pos(VT::zero());
-          new_pos[0u] = attributes.get_attribute_value( "__move_substep_target_x", simplex, m_label);
-          new_pos[1u] = attributes.get_attribute_value( "__move_substep_target_y", simplex, m_label);
+          new_pos[0u] = attributes.get_attribute_value( m_target_x, simplex, m_label);
+          new_pos[1u] = attributes.get_attribute_value( m_target_y, simplex, m_label);
 
           attributes.set_current_value( simplex, new_pos);
 
@@ -96,12 +110,12 @@ namespace grit
 
       bool plan_local_connectivity_changes(
                                            Simplex0                 const & /* simplex */
-                                           , InterfaceMesh                & /* mesh */
+                                           , MI                           & /* mesh */
                                            , AMT                    const & /* attributes */
                                            , SimplexSet                   & /* new_simplices */
                                            , SimplexSet                   & /* old_simplices */
-                                           , std::map<Simplex1, Simplex1> & /* simplex1_lut */
-                                           , std::map<Simplex2, Simplex2> & /* simplex2_lut */
+                                           , Simplex1LUT & /* simplex1_lut */
+                                           , Simplex2LUT & /* simplex2_lut */
                                            )
       {
         return false;
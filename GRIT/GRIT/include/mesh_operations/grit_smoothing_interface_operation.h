@@ -36,6 +36,12 @@ namespace grit
       typedef typename types::math_types       MT;
       typedef typename types::attributes_type  AT;
       typedef typename types::param_type       PT;
+      typedef typename types::mesh_impl        MI;
+
+      typedef BasicIsBoundary<MI>              IsBoundary;
+      typedef BasicIsInterface<MI>             IsInterface;
+      typedef BasicIsSubmeshBoundary<MI>       IsSubmeshBoundary;
+      typedef BasicIsValid<MI>                 IsValid;
 
       typedef typename V::value_traits         VT;
 
@@ -68,7 +74,7 @@ namespace grit
 
 
       void init(
-                InterfaceMesh const & mesh
+                MI            const & mesh
                 , AT                & attributes
                 )
       {
@@ -115,7 +121,7 @@ namespace grit
 
       bool update_local_attributes(
                                    Simplex0        const & simplex
-                                   , InterfaceMesh const & mesh
+                                   , MI            const & mesh
                                    , AT                  & attributes
                                    )
       {
@@ -170,16 +176,14 @@ namespace grit
             {
               std::vector< std::string> const & attribute_names = attributes.simplex0_attribute_names();
 
-              std::vector< std::string>::const_iterator name_it = attribute_names.begin();
-
-              for ( ; name_it != attribute_names.end(); ++name_it)
+              for ( unsigned int n = 0u; n < attribute_names.size(); ++n)
               {
-                std::string const & attribute_name = *name_it;
+                AttributeHandle const h( 0u, n);
 
-                T const val = b_coords[0u] * attributes.get_attribute_value( attribute_name, vertices[0u], m_label)
-                            + b_coords[1u] * attributes.get_attribute_value( attribute_name, vertices[1u], m_label);
+                T const val = b_coords[0u] * attributes.get_attribute_value( h, vertices[0u], m_label)
+                            + b_coords[1u] * attributes.get_attribute_value( h, vertices[1u], m_label);
 
-                attributes.set_attribute_value( attribute_name, simplex, m_label, val);
+                attributes.set_attribute_value( h, simplex, m_label, val);
               }
 
               break;
@@ -195,12 +199,12 @@ namespace grit
 
       bool plan_local_connectivity_changes(
                                            Simplex0                 const & /* simplex */
-                                           , InterfaceMesh                & /* mesh */
+                                           , MI                           & /* mesh */
                                            , AT                     const & /* attributes */
                                            , SimplexSet                   & /* new_simplices */
                                            , SimplexSet                   & /* old_simplices */
-                                           , std::map<Simplex1, Simplex1> & /* simplex1_lut */
-                                           , std::map<Simplex2, Simplex2> & /* simplex2_lut */
+                                           , Simplex1LUT & /* simplex1_lut */
+                                           , Simplex2LUT & /* simplex2_lut */
                                            )
       {
         return false;
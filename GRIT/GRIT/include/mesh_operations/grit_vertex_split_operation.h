@@ -27,6 +27,11 @@ namespace grit
       typedef typename types::math_types               MT;
       typedef typename types::attributes_type          AT;
       typedef typename types::param_type               PT;
+      typedef typename types::mesh_impl                MI;
+
+      typedef BasicInPhase<MI>                         InPhase;
+      typedef BasicIsInterface<MI>                     IsInterface;
+      typedef BasicIsSubmeshBoundary<MI>               IsSubmeshBoundary;
 
       typedef typename V::value_traits                 VT;
 
@@ -56,7 +61,7 @@ namespace grit
     public:
 
       void init(
-                InterfaceMesh const & mesh
+                MI            const & mesh
                 , AT                & attributes
                 )
       { }
@@ -65,7 +70,7 @@ namespace grit
 
       bool update_local_attributes(
                                    Simplex0        const & simplex
-                                   , InterfaceMesh const & mesh
+                                   , MI            const & mesh
                                    , AT                  & attributes
                                    )
       {
@@ -76,7 +81,7 @@ namespace grit
 
       bool plan_local_connectivity_changes(
                                            Simplex0            const & simplex
-                                           , InterfaceMesh           & mesh
+                                           , MI                      & mesh
                                            , AT                const & attributes
                                            , SimplexSet              & new_simplices
                                            , SimplexSet              & old_simplices
@@ -95,7 +100,7 @@ namespace grit
         }
 
         //--- Get all labels from the 1-ring of simplex.
-        std::vector<unsigned int> const & labels = attributes.get_simplex0_labels(simplex);
+        Simplex0LabelRange const labels = attributes.get_simplex0_labels(simplex);
 
         //--- Only one phase assigned (the other phase is ambient).
         if( labels.size() < 2u)
@@ -162,7 +167,7 @@ namespace grit
                         Simplex0            const & simplex
                         , Simplex0          const & w
                         , Simplex1          const & e
-                        , InterfaceMesh           & mesh
+                        , MI                      & mesh
                         , SimplexSet              & new_simplices
                         , SimplexSet              & old_simplices
                         , simplex1_lut_type       & simplex1_lut
@@ -204,7 +209,7 @@ namespace grit
                             Simplex0            const & simplex
                             , Simplex0          const & w
                             , Simplex2          const & t
-                            , InterfaceMesh           & mesh
+                            , MI                      & mesh
                             , SimplexSet              & new_simplices
                             , SimplexSet              & old_simplices
                             , simplex2_lut_type       & simplex2_lut
@@ -3,11 +3,13 @@
 
 #include <grit_interface_monitor.h>
 #include <grit_interface_mesh.h>
+#include <grit_attribute_handle.h>
 
 #include <grit_logic_expressions.h>
 #include <grit_simplex.h>
 #include <grit_simplex_set.h>
 #include <grit_simplex_set_functions.h>
+#include <grit_mesh_regions.h>
 
 #include <monitors/grit_count_monitor.h>
 
@@ -15,6 +17,8 @@
 #include <util_log.h>
 
 #include <vector>
+#include <string>
+#include <stdexcept>  // Needed for std::logic_error
 
 namespace grit
 {
@@ -29,6 +33,11 @@ namespace grit
 
       typedef typename types::attributes_type        AT;
       typedef typename types::param_type             PT;
+      typedef typename types::mesh_impl              MI;
+
+      typedef BasicIsBoundary<MI>                    IsBoundary;
+      typedef BasicIsInterface<MI>                   IsInterface;
+      typedef BasicIsSubmeshBoundary<MI>             IsSubmeshBoundary;
 
       typedef typename types::real_type              T;
       typedef typename types::vector3_type           V;
@@ -41,7 +50,7 @@ namespace grit
 
     protected:
 
-      InterfaceMesh        const & m_mesh;
+      MI                   const & m_mesh;
       PT                   const & m_parameters;
 
       AT                         & m_attributes;
@@ -57,18 +66,42 @@ namespace grit
 
       CountMonitor<types>          m_counter;
 
+      AttributeHandle              m_velocity_x;  ///< Handle of the "__velocity_x" attribute.
+      AttributeHandle              m_velocity_y;  ///< Handle of the "__velocity_y" attribute.
+      AttributeHandle              m_target_x;    ///< Handle of the "__move_substep_target_x" attribute.
+      AttributeHandle              m_target_y;    ///< Handle of the "__move_substep_target_y" attribute.
+
+      InRegion                     m_region;      ///< Only the vertices of this region are moved, all vertices if empty.
+
+    protected:
+
+      /**
+       * Creates a vertex attribute for the monitor's own use. Monitors of
+       * different regions of one mesh share the attribute, each writes the
+       * values of its own vertices.
+       */
+      AttributeHandle scratch_attribute(std::string const & name)
+      {
+        if (m_attributes.exist_attribute( name, 0u))
+          return m_attributes.get_attribute_handle( name, 0u);
+
+        return m_attributes.create_attribute( name, 0u);
+      }
+
     public:
 
       MoveMonitor(
-                  InterfaceMesh const & mesh
+                  MI            const & mesh
                   , AT                & attributes
                   , PT          const & parameters
+                  , InRegion    const & region = InRegion()
                   )
       : m_mesh( mesh)
       , m_parameters( parameters)
       , m_attributes( attributes)
       , m_progress( VT::zero())
       , m_counter( parameters.max_iterations( "algorithm"), parameters.verbose())
+      , m_region( region)
       {
         std::vector< unsigned int> const & labels = parameters.labels();
 
@@ -88,13 +121,13 @@ namespace grit
           return;
         }
 
-        m_attributes.create_attribute( "__velocity_x", 0u);
-        m_attributes.create_attribute( "__velocity_y", 0u);
+        m_velocity_x = scratch_attribute( "__velocity_x");
+        m_velocity_y = scratch_attribute( "__velocity_y");
 
-        m_attributes.create_attribute( "__move_substep_target_x", 0u);
-        m_attributes.create_attribute( "__move_substep_target_y", 0u);
+        m_target_x   = scratch_attribute( "__move_substep_target_x");
+        m_target_y   = scratch_attribute( "__move_substep_target_y");
 
-        SimplexSet const vertices = filter( m_mesh.get_all_simplices(), IsDimension( m_mesh, 0));
+        SimplexSet const vertices = filter( m_mesh.get_all_simplices(), IsDimension( m_mesh, 0) && m_region);
 
         SimplexSet::simplex0_const_iterator begin0 = vertices.begin0();
         SimplexSet::simplex0_const_iterator end0   = vertices.end0();
@@ -104,7 +137,7 @@ namespace grit
         {
           Simplex0 const & s0 = *iter0;
 
-          std::vector<unsigned int> const & labels = m_attributes.get_simplex0_labels(s0);
+          Simplex0LabelRange const labels = m_attributes.get_simplex0_labels(s0);
           for( unsigned int k = 0u; k < labels.size(); ++k)
           {
             unsigned int const & label = labels[k];
@@ -113,8 +146,8 @@ namespace grit
             {
               V const & p = m_attributes.get_current_value(s0);
 
-              m_attributes.set_attribute_value( "__move_substep_target_x", s0, label, p[0u]);
-              m_attributes.set_attribute_value( "__move_substep_target_y", s0, label, p[1u]);
+              m_attributes.set_attribute_value( m_target_x, s0, label, p[0u]);
+              m_attributes.set_attribute_value( m_target_y, s0, label, p[1u]);
 
               if ((!IsBoundary(m_mesh)(s0) && !IsSubmeshBoundary(m_mesh)(s0))
                   && (IsInterface(m_mesh)(s0) || !m_parameters.use_only_interface()))
@@ -130,13 +163,13 @@ namespace grit
                   u[1u] = 0.0;
                 }
 
-                m_attributes.set_attribute_value( "__velocity_x", s0, label, u[0u]);
-                m_attributes.set_attribute_value( "__velocity_y", s0, label, u[1u]);
+                m_attributes.set_attribute_value( m_velocity_x, s0, label, u[0u]);
+                m_attributes.set_attribute_value( m_velocity_y, s0, label, u[1u]);
               }
               else
               {
-                m_attributes.set_attribute_value( "__velocity_x", s0, label, VT::zero());
-                m_attributes.set_attribute_value( "__velocity_y", s0, label, VT::zero());
+                m_attributes.set_attribute_value( m_velocity_x, s0, label, VT::zero());
+                m_attributes.set_attribute_value( m_velocity_y, s0, label, VT::zero());
               }
             }
           }
@@ -176,6 +209,13 @@ namespace grit
           return;
         }
 
+        if( m_velocity_x.is_null() || m_velocity_y.is_null()
+         || m_target_x.is_null()   || m_target_y.is_null())
+        {
+          logging << "MoveMonitor::update() Error! Target was defined after the monitor was created" << util::Log::newline();
+          throw std::logic_error("MoveMonitor::update(): move attributes have not been created");
+        }
+
         SimplexSet const triangles = filter( m_mesh.get_all_simplices(), IsDimension( m_mesh, 2));
 
         SimplexSet::simplex2_const_iterator begin = triangles.begin2();
@@ -188,29 +228,34 @@ namespace grit
         {
           Simplex2 const & s = *iter;
 
-          std::vector<Simplex0> nodes(3u);
-          nodes[0u] = s.get_idx0();
-          nodes[1u] = s.get_idx1(),
-          nodes[2u] = s.get_idx2();
+          // Only the vertices of the region move, other triangles can not collapse
+          if (!m_region.touches(s))
+            continue;
+
+          Simplex0 const nodes[3u] = { s.get_simplex0_idx0(), s.get_simplex0_idx1(), s.get_simplex0_idx2() };
 
           V const & v0 = m_attributes.get_current_value(nodes[0u]),
                     v1 = m_attributes.get_current_value(nodes[1u]),
                     v2 = m_attributes.get_current_value(nodes[2u]);
 
-          std::vector<V> velocities(3u, V(VT::zero()));
+          V velocities[3u] = { V(VT::zero()), V(VT::zero()), V(VT::zero()) };
 
           for( unsigned int i = 0; i < 3u; ++i)
           {
             Simplex0 const & s0 = nodes[i];
-            std::vector<unsigned int> const & labels = m_attributes.get_simplex0_labels(s0);
+
+            if (!m_region(s0))
+              continue;
+
+            Simplex0LabelRange const labels = m_attributes.get_simplex0_labels(s0);
             for( unsigned int k = 0u; k < labels.size(); ++k)
             {
               unsigned int const & label = labels[k];
 
               if (!(m_parameters.use_ambient()) || (label != m_parameters.ambient_label()))
               {
-                velocities[i][0u] = m_attributes.get_attribute_value( "__velocity_x", s0, label);
-                velocities[i][1u] = m_attributes.get_attribute_value( "__velocity_y", s0, label);
+                velocities[i][0u] = m_attributes.get_attribute_value( m_velocity_x, s0, label);
+                velocities[i][1u] = m_attributes.get_attribute_value( m_velocity_y, s0, label);
               }
             }
           }
@@ -236,7 +281,7 @@ namespace grit
         if (m_parameters.verbose() && !m_parameters.silent_threads())
           logging << "Earliest collapse time " << first_collapse_time << util::Log::newline();
 
-        SimplexSet const vertices = filter( m_mesh.get_all_simplices(), IsDimension( m_mesh, 0));
+        SimplexSet const vertices = filter( m_mesh.get_all_simplices(), IsDimension( m_mesh, 0) && m_region);
 
         T remaining_time = VT::one() - m_progress;
 
@@ -249,7 +294,7 @@ namespace grit
         for (; iter0 != end0; ++iter0)
         {
           Simplex0 const s0 = *iter0;
-          std::vector<unsigned int> const & labels = m_attributes.get_simplex0_labels(s0);
+          Simplex0LabelRange const labels = m_attributes.get_simplex0_labels(s0);
           for (unsigned int k = 0u; k < labels.size(); ++k)
           {
             unsigned int const & label = labels[k];
@@ -259,17 +304,17 @@ namespace grit
               if ((!IsBoundary(m_mesh)(s0) && !IsSubmeshBoundary(m_mesh)(s0))
                   && (IsInterface(m_mesh)(s0) || !m_parameters.use_only_interface()))
               {
-                T px = m_attributes.get_current_value(s0)[0u] + dt * m_attributes.get_attribute_value( "__velocity_x", s0, label);
-                T py = m_attributes.get_current_value(s0)[1u] + dt * m_attributes.get_attribute_value( "__velocity_y", s0, label);
+                T px = m_attributes.get_current_value(s0)[0u] + dt * m_attributes.get_attribute_value( m_velocity_x, s0, label);
+                T py = m_attributes.get_current_value(s0)[1u] + dt * m_attributes.get_attribute_value( m_velocity_y, s0, label);
 
-                m_attributes.set_attribute_value( "__move_substep_target_x", s0, label, px);
-                m_attributes.set_attribute_value( "__move_substep_target_y", s0, label, py);
+                m_attributes.set_attribute_value( m_target_x, s0, label, px);
+                m_attributes.set_attribute_value( m_target_y, s0, label, py);
               }
               else
               {
                 V pos = m_attributes.get_current_value(s0);
-                m_attributes.set_attribute_value( "__move_substep_target_x", s0, label, pos[0u]);
-                m_attributes.set_attribute_value( "__move_substep_target_y", s0, label, pos[1u]);
+                m_attributes.set_attribute_value( m_target_x, s0, label, pos[0u]);
+                m_attributes.set_attribute_value( m_target_y, s0, label, pos[1u]);
               }
             }
           }
@@ -18,6 +18,7 @@ namespace grit
 
       typedef typename types::attributes_type  AT;
       typedef typename types::param_type       PT;
+      typedef typename types::mesh_impl        MI;
 
     public:
 
@@ -25,7 +26,7 @@ namespace grit
                               std::string     const & name
                               , unsigned int  const & label
                               , PT            const & parameters
-                              , InterfaceMesh const & mesh
+                              , MI            const & mesh
                               , AT            const & attributes
                               )
       {}
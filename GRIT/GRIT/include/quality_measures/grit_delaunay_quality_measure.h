@@ -28,14 +28,19 @@ namespace grit
 
       typedef typename types::attributes_type  AMT;
       typedef typename types::param_type       PT;
+      typedef typename types::mesh_impl        MI;
       typedef typename types::real_type        T;
       typedef typename types::vector3_type     V;
 
     protected:
 
-      InterfaceMesh const & m_mesh;
+      MI            const & m_mesh;
       AMT     const & m_attributes;
 
+      mutable SimplexSet  m_star;       ///< Scratch set reused by is_bad.
+      mutable SimplexSet  m_closure;    ///< Scratch set reused by is_bad.
+      mutable SimplexSet  m_boundary;   ///< Scratch set reused by is_bad.
+
     protected:
 
       V const & get_coordinates( Simplex0 const & s) const
@@ -80,7 +85,7 @@ namespace grit
                              std::string    const & name
                              , unsigned int const & label
                              , PT           const & parameters
-                             , InterfaceMesh      const & mesh
+                             , MI                 const & mesh
                              , AMT          const & attributes
                              )
       : m_mesh(mesh)
@@ -91,7 +96,9 @@ namespace grit
       {
 
 
-        SimplexSet const Ts = m_mesh.star(s);
+        m_mesh.star(s, m_star);
+
+        SimplexSet const & Ts = m_star;
 
         if (Ts.size(2u) < 2u)
           return false;
@@ -120,9 +127,10 @@ namespace grit
           return false;
 		}
 
-        SimplexSet Vs = m_mesh.closure(Ts);
+        m_mesh.closure(Ts, m_closure);
+        m_mesh.boundary(s, m_boundary);
 
-        Vs = difference(Vs, m_mesh.boundary(s)); // V is two opposite vertices
+        SimplexSet const Vs = difference(m_closure, m_boundary); // V is two opposite vertices
 
         Simplex0 v1;
         Simplex0 v2;
@@ -27,13 +27,18 @@ namespace grit
 
       typedef typename types::attributes_type  AT;
       typedef typename types::param_type       PT;
+      typedef typename types::mesh_impl        MI;
+
+      typedef BasicIsBoundary<MI>              IsBoundary;
+      typedef BasicIsInterface<MI>             IsInterface;
+      typedef BasicIsSubmeshBoundary<MI>       IsSubmeshBoundary;
       typedef typename types::vector3_type     V;
       typedef typename types::real_type        T;
       typedef typename types::math_types        MT;
 
     protected:
 
-      InterfaceMesh const & m_mesh;
+      MI            const & m_mesh;
 
       AT            const & m_attributes;
 
@@ -45,7 +50,7 @@ namespace grit
                                       std::string     const & operation_name
                                       , unsigned int  const & label
                                       , PT            const & parameters
-                                      , InterfaceMesh const & mesh
+                                      , MI            const & mesh
                                       , AT            const & attributes
                                       )
       : m_mesh(mesh)
@@ -16,6 +16,9 @@ namespace grit
 
       typedef typename types::attributes_type        AT;
       typedef typename types::param_type             PT;
+      typedef typename types::mesh_impl              MI;
+
+      typedef BasicIsInterface<MI>                   IsInterface;
 
       typedef typename types::real_type              T;
       typedef typename types::vector3_type           V;
@@ -23,7 +26,7 @@ namespace grit
     protected:
 
       T                   m_distance;
-      InterfaceMesh const & m_mesh;
+      MI            const & m_mesh;
       AT          const & m_attributes;
       PT          const & m_parameters;
 
@@ -40,7 +43,7 @@ namespace grit
                                   std::string     const & operation_name
                                   , unsigned int  const & label
                                   , PT            const & parameters
-                                  , InterfaceMesh const & mesh
+                                  , MI            const & mesh
                                   , AT            const & attributes
                                   )
       : m_distance(parameters.get_distance_threshold(operation_name,label))
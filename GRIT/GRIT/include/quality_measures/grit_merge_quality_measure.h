@@ -32,6 +32,10 @@ namespace grit
 
       typedef typename types::attributes_type  AT;
       typedef typename types::param_type       PT;
+      typedef typename types::mesh_impl        MI;
+
+      typedef BasicIsInterface<MI>             IsInterface;
+      typedef BasicIsValid<MI>                 IsValid;
       typedef typename types::math_types       MT;
       typedef typename types::real_type        T;
       typedef typename types::vector3_type     V;
@@ -40,7 +44,7 @@ namespace grit
 
     protected:
 
-      InterfaceMesh const & m_mesh;
+      MI            const & m_mesh;
       AT            const & m_attributes;
 
       T             const   m_angle_threshold; ///< Threshold on the maximum angle
@@ -59,7 +63,7 @@ namespace grit
                           std::string    const & operation_name
                           , unsigned int const & label
                           , PT           const & parameters
-                          , InterfaceMesh      const & mesh
+                          , MI                 const & mesh
                           , AT           const & attributes
                           )
       : m_mesh(mesh)
@@ -16,10 +16,15 @@ namespace grit
 
       typedef typename types::attributes_type  AT;
       typedef typename types::param_type       PT;
+      typedef typename types::mesh_impl        MI;
+
+      typedef BasicIsBoundary<MI>              IsBoundary;
+      typedef BasicIsInterface<MI>             IsInterface;
+      typedef BasicIsValid<MI>                 IsValid;
 
     protected:
 
-      InterfaceMesh const & m_mesh;
+      MI            const & m_mesh;
 
     public:
 
@@ -27,7 +32,7 @@ namespace grit
                            std::string     const & name
                            , unsigned int  const & label
                            , PT            const & parameters
-                           , InterfaceMesh const & mesh
+                           , MI            const & mesh
                            , AT            const & attributes
                            )
       : m_mesh(mesh)
@@ -3,6 +3,7 @@
 
 #include <grit_interface_quality_measure.h>
 #include <grit_interface_mesh.h>
+#include <grit_attribute_handle.h>
 
 #include <util_edge_length.h>
 #include <util_triangle_area.h>
@@ -23,6 +24,7 @@ namespace grit
 
       typedef typename types::attributes_type        AT;
       typedef typename types::param_type             PT;
+      typedef typename types::mesh_impl              MI;
 
       typedef typename types::real_type              T;
       typedef typename types::vector3_type           V;
@@ -32,13 +34,18 @@ namespace grit
       T                     m_lower;
       T                     m_upper;
       PT            const & m_parameters;
-      InterfaceMesh const & m_mesh;
+      MI            const & m_mesh;
       AT            const & m_attributes;
       std::string           m_lower_threshold_attribute;
       std::string           m_upper_threshold_attribute;
+      AttributeHandle       m_lower_threshold_handle;     ///< Handle of m_lower_threshold_attribute, null if there is no such attribute.
+      AttributeHandle       m_upper_threshold_handle;     ///< Handle of m_upper_threshold_attribute, null if there is no such attribute.
 
     protected:
 
+      static unsigned int dimension(Simplex1 const & /*tag*/) { return 1u; }
+      static unsigned int dimension(Simplex2 const & /*tag*/) { return 2u; }
+
       bool in_inside_interval(
                               T   const & value
                               , S const & simplex
@@ -46,21 +53,21 @@ namespace grit
       {
         bool above_lower = (value>m_lower);
 
-        if( m_lower_threshold_attribute.compare("") != 0)
+        if( !m_lower_threshold_handle.is_null())
         {
-          if( m_attributes.exist_attribute_value( m_lower_threshold_attribute, simplex))
+          if( m_attributes.exist_attribute_value( m_lower_threshold_handle, simplex))
           {
-            above_lower = (value > m_attributes.get_attribute_value( m_lower_threshold_attribute, simplex) );
+            above_lower = (value > m_attributes.get_attribute_value( m_lower_threshold_handle, simplex) );
           }
         }
 
         bool below_upper = (value<m_upper);
 
-        if( m_upper_threshold_attribute.compare("") != 0)
+        if( !m_upper_threshold_handle.is_null())
         {
-          if( m_attributes.exist_attribute_value( m_upper_threshold_attribute, simplex))
+          if( m_attributes.exist_attribute_value( m_upper_threshold_handle, simplex))
           {
-            below_upper = (value < m_attributes.get_attribute_value( m_upper_threshold_attribute, simplex) );
+            below_upper = (value < m_attributes.get_attribute_value( m_upper_threshold_handle, simplex) );
           }
         }
 
@@ -80,7 +87,7 @@ namespace grit
                                   std::string     const & operation_name
                                   , unsigned int  const & label
                                   , PT            const & parameters
-                                  , InterfaceMesh const & mesh
+                                  , MI            const & mesh
                                   , AT            const & attributes
                                   )
       : m_lower(parameters.get_lower_threshold(operation_name,label))
@@ -106,6 +113,9 @@ namespace grit
         {
           m_upper_threshold_attribute = "";
         }
+
+        m_lower_threshold_handle = m_attributes.get_attribute_handle( m_lower_threshold_attribute, dimension( S() ));
+        m_upper_threshold_handle = m_attributes.get_attribute_handle( m_upper_threshold_attribute, dimension( S() ));
       }
     };
 
@@ -120,6 +130,9 @@ namespace grit
 
       typedef typename types::attributes_type        AT;
       typedef typename types::param_type             PT;
+      typedef typename types::mesh_impl              MI;
+
+      typedef BasicIsValid<MI>                       IsValid;
       typedef typename types::real_type              T;
       typedef typename types::vector3_type           V;
 
@@ -129,7 +142,7 @@ namespace grit
                                  std::string     const & name
                                  , unsigned int  const & label
                                  , PT            const & parameters
-                                 , InterfaceMesh const & mesh
+                                 , MI            const & mesh
                                  , AT            const & attributes
                                  )
       : base_class(
@@ -172,6 +185,9 @@ namespace grit
 
       typedef typename types::attribute_manager_type AT;
       typedef typename types::param_type             PT;
+      typedef typename types::mesh_impl              MI;
+
+      typedef BasicIsValid<MI>                       IsValid;
       typedef typename types::real_type              T;
       typedef typename types::vector3_type           V;
 
@@ -181,7 +197,7 @@ namespace grit
                                  std::string     const & name
                                  , unsigned int  const & label
                                  , PT            const & parameters
-                                 , InterfaceMesh const & mesh
+                                 , MI            const & mesh
                                  , AT            const & attributes
                                  )
       : base_class(
@@ -226,6 +242,9 @@ namespace grit
 
       typedef typename types::attribute_manager_type AT;
       typedef typename types::param_type             PT;
+      typedef typename types::mesh_impl              MI;
+
+      typedef BasicIsValid<MI>                       IsValid;
       typedef typename types::real_type              T;
       typedef typename types::vector3_type           V;
 
@@ -235,7 +254,7 @@ namespace grit
                                     std::string     const & name
                                     , unsigned int  const & label
                                     , PT            const & parameters
-                                    , InterfaceMesh const & mesh
+                                    , MI            const & mesh
                                     , AT            const & attributes
                                     )
       : base_class(
@@ -280,6 +299,9 @@ namespace grit
 
       typedef typename types::attribute_manager_type AT;
       typedef typename types::param_type             PT;
+      typedef typename types::mesh_impl              MI;
+
+      typedef BasicIsValid<MI>                       IsValid;
       typedef typename types::real_type              T;
       typedef typename types::vector3_type           V;
 
@@ -289,7 +311,7 @@ namespace grit
                                  std::string     const & name
                                  , unsigned int  const & label
                                  , PT            const & parameters
-                                 , InterfaceMesh const & mesh
+                                 , MI            const & mesh
                                  , AT            const & attributes
                                  )
       : base_class(
@@ -17,6 +17,10 @@ namespace grit
 
       typedef typename types::attributes_type  AMT;
       typedef typename types::param_type       PT;
+      typedef typename types::mesh_impl        MI;
+
+      typedef BasicIsInterface<MI>             IsInterface;
+      typedef BasicIsSubmeshBoundary<MI>       IsSubmeshBoundary;
       typedef typename types::math_types       MT;
       typedef typename types::real_type        T;
       typedef typename types::vector3_type     V;
@@ -25,7 +29,7 @@ namespace grit
 
     protected:
 
-      InterfaceMesh const & m_mesh;
+      MI            const & m_mesh;
       AMT           const & m_attributes;
       PT            const & m_parameters;
 
@@ -47,7 +51,7 @@ namespace grit
                                 std::string    const & operation_name
                                 , unsigned int const & label
                                 , PT           const & parameters
-                                , InterfaceMesh      const & mesh
+                                , MI                 const & mesh
                                 , AMT          const & attributes
                                 )
       : m_mesh(mesh)
@@ -70,7 +74,7 @@ namespace grit
         if( !(m_parameters.use_ambient()) || (m_label==m_parameters.ambient_label()))
           return false;
 
-        std::vector<unsigned int> const & labels = m_attributes.get_simplex0_labels(s);
+        Simplex0LabelRange const labels = m_attributes.get_simplex0_labels(s);
 
         //--- only one phase assigned (other phase is ambient)
         if( labels.size() < 2u)
@@ -81,7 +85,7 @@ namespace grit
         //                   is not performed. Otherwise vertex split is performed. Note! if
         //                   the prescribed motion yields interpenetration, the result might not
         //                   be what it is expected.
-        std::vector<unsigned int>::const_iterator label_it = labels.begin();
+        Simplex0LabelRange::const_iterator label_it = labels.begin();
 
         //--- the target position associated with this label.
         V const & target0 = m_attributes.get_target_value( s, m_label);
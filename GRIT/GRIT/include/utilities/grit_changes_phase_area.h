@@ -22,13 +22,14 @@ namespace grit
     template<
              typename V
              , typename AT ///< attribute manager types
+             , typename M  ///< mesh type
              >
     bool changes_phase_area(
                             Simplex0     const & v
                             , Simplex0   const & vo
                             , SimplexSet const & S
                             , AT         const & attributes
-                            , InterfaceMesh const & mesh
+                            , M          const & mesh
                             , typename V::value_type const & threshold = V::value_traits::zero())
     {
       typedef typename V::value_type  T;
@@ -46,7 +47,7 @@ namespace grit
 
           assert( id_current < 3u || !"changes_phase_area() ERROR simplex not found in indices vector.");
 
-          std::vector<V> vertices(3u);
+          V vertices[3u];
 
           for (unsigned int i = 0u; i < 3u; ++i)
           {
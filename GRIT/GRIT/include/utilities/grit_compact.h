@@ -0,0 +1,192 @@
+#ifndef GRIT_COMPACT_H
+#define GRIT_COMPACT_H
+
+#include <grit_simplex.h>
+#include <grit_simplex_set.h>
+#include <grit_attribute_vector.h>
+
+#include <util_morton.h>
+
+#include <vector>
+#include <algorithm>  // Needed for std::sort, std::min and std::max
+#include <utility>    // Needed for std::pair and std::move
+
+namespace grit
+{
+  namespace details
+  {
+
+    /**
+     * Renumbers all vertices and faces of a mesh, and remaps all attributes
+     * and labels to the new numbering.
+     *
+     * After many mesh operations the vertex and face handles are sparse,
+     * and attribute vectors indexed by handle hold many unused slots.
+     * Neighbouring vertices also end up far apart in memory. Compacting
+     * rebuilds the mesh and the attributes with consecutive handles, where
+     * the vertices are numbered in Morton order of their coordinates and
+     * the triangles are numbered by their lowest new vertex index, so
+     * nearby simplices are stored close together.
+     *
+     * All handles and simplices of the mesh change. Attribute handles and
+     * attribute names are kept.
+     *
+     * @tparam types   The type binder of the engine.
+     */
+    template<typename types>
+    inline void compact(
+                        typename types::mesh_impl         & mesh
+                        , typename types::attributes_type & attributes
+                        )
+    {
+      typedef typename types::mesh_impl               MI;
+      typedef typename types::attributes_type         AT;
+      typedef typename types::attribute_manager_type  AMT;
+      typedef typename types::vector3_type            V;
+      typedef typename types::real_type               T;
+
+      typedef typename V::value_traits                VT;
+
+      typedef std::pair<unsigned long long, Simplex0>  key_type;
+
+      SimplexSet const all = mesh.get_all_simplices();
+
+      if (all.size(0u) == 0u)
+        return;
+
+      //--- Quantize the coordinates onto a grid covering the bounding box,
+      //--- and sort the vertices by the Morton code of their grid cell
+      V min_coord = attributes.get_current_value( *all.begin0() );
+      V max_coord = min_coord;
+
+      for (SimplexSet::simplex0_const_iterator it = all.begin0(); it != all.end0(); ++it)
+      {
+        V const & p = attributes.get_current_value( *it );
+
+        min_coord[0] = std::min( min_coord[0], p[0] );
+        min_coord[1] = std::min( min_coord[1], p[1] );
+        max_coord[0] = std::max( max_coord[0], p[0] );
+        max_coord[1] = std::max( max_coord[1], p[1] );
+      }
+
+      T const extent = std::max( max_coord[0] - min_coord[0], max_coord[1] - min_coord[1] );
+      T const scale  = extent > VT::zero() ? T(65535.0) / extent : VT::zero();
+
+      std::vector<key_type> order;
+
+      order.reserve( all.size(0u) );
+
+      for (SimplexSet::simplex0_const_iterator it = all.begin0(); it != all.end0(); ++it)
+      {
+        V const & p = attributes.get_current_value( *it );
+
+        unsigned int const x = static_cast<unsigned int>( (p[0] - min_coord[0]) * scale );
+        unsigned int const y = static_cast<unsigned int>( (p[1] - min_coord[1]) * scale );
+
+        order.push_back( key_type( util::morton_code(x, y), *it ) );
+      }
+
+      std::sort( order.begin(), order.end() );
+
+      //--- Read the labels and submesh boundary flags, the mesh is then
+      //--- cleared and rebuilt in place
+      std::vector<Simplex2>     old_triangles( all.begin2(), all.end2() );
+      std::vector<unsigned int> old_labels;
+
+      old_labels.reserve( old_triangles.size() );
+
+      for (size_t i = 0u; i < old_triangles.size(); ++i)
+        old_labels.push_back( mesh.label( old_triangles[i] ) );
+
+      std::vector<bool> is_submesh_boundary( order.size(), false );
+
+      bool has_submesh_boundary = false;
+
+      for (size_t i = 0u; i < order.size(); ++i)
+      {
+        is_submesh_boundary[i] = mesh.is_submesh_boundary( order[i].second );
+        has_submesh_boundary   = has_submesh_boundary || is_submesh_boundary[i];
+      }
+
+      AT new_attributes;
+
+      AMT::copy_attribute_names( attributes, new_attributes );
+
+      mesh.clear();
+      mesh.m_coords = &(new_attributes.current());
+
+      //--- Vertices are inserted in Morton order
+      Simplex0AttributeVector<Simplex0> old_to_new;
+
+      for (size_t i = 0u; i < order.size(); ++i)
+      {
+        Simplex0 const s     = order[i].second;
+        Simplex0 const s_new = mesh.insert();
+
+        old_to_new[s] = s_new;
+
+        AMT::copy_attribute_values( s, s_new, attributes, new_attributes );
+
+        if (has_submesh_boundary)
+          mesh.submesh_boundary(s_new) = is_submesh_boundary[i];
+      }
+
+      //--- Triangles are inserted by their lowest new vertex index
+      std::vector< std::pair<Simplex2, size_t> > triangle_order;
+
+      triangle_order.reserve( old_triangles.size() );
+
+      for (size_t i = 0u; i < old_triangles.size(); ++i)
+      {
+        Simplex2 const & s = old_triangles[i];
+
+        Simplex2 const s_new = Simplex2(
+                                        old_to_new[ s.get_simplex0_idx0() ]
+                                        , old_to_new[ s.get_simplex0_idx1() ]
+                                        , old_to_new[ s.get_simplex0_idx2() ]
+                                        );
+
+        triangle_order.push_back( std::make_pair( s_new, i ) );
+      }
+
+      std::sort( triangle_order.begin(), triangle_order.end() );
+
+      std::vector<Simplex0>     triangles;
+      std::vector<unsigned int> labels;
+
+      triangles.reserve( 3u*triangle_order.size() );
+      labels.reserve( triangle_order.size() );
+
+      for (size_t i = 0u; i < triangle_order.size(); ++i)
+      {
+        Simplex2 const & s_new = triangle_order[i].first;
+        size_t   const   j     = triangle_order[i].second;
+
+        triangles.push_back( s_new.get_simplex0_idx0() );
+        triangles.push_back( s_new.get_simplex0_idx1() );
+        triangles.push_back( s_new.get_simplex0_idx2() );
+        labels.push_back( old_labels[j] );
+
+        AMT::copy_attribute_values( old_triangles[j], s_new, attributes, new_attributes );
+      }
+
+      mesh.insert( triangles, labels );
+
+      for (SimplexSet::simplex1_const_iterator it = all.begin1(); it != all.end1(); ++it)
+      {
+        Simplex1 const s_new = Simplex1( old_to_new[ it->get_simplex0_idx0() ], old_to_new[ it->get_simplex0_idx1() ] );
+
+        AMT::copy_attribute_values( *it, s_new, attributes, new_attributes );
+      }
+
+      attributes = std::move(new_attributes);
+
+      mesh.m_coords = &(attributes.current());
+    }
+
+  } // namespace details
+
+} // namespace grit
+
+// GRIT_COMPACT_H
+#endif
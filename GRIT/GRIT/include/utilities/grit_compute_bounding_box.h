@@ -30,11 +30,9 @@ namespace grit
 
       min[0] = p[0] < min[0] ? p[0] : min[0];
       min[1] = p[1] < min[1] ? p[1] : min[1];
-      min[2] = p[2] < min[2] ? p[2] : min[2];
 
       max[0] = p[0] > max[0] ? p[0] : max[0];
       max[1] = p[1] > max[1] ? p[1] : max[1];
-      max[2] = p[2] > max[2] ? p[2] : max[2];
     }
   }
 
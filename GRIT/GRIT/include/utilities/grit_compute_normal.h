@@ -21,10 +21,11 @@ namespace grit
      template<
              typename   MT
              , typename AT ///< attribute manager types
+             , typename M  ///< mesh type
              >
     inline typename MT::vector3_type compute_normal(
                                                     Simplex1        const & s
-                                                    , InterfaceMesh const & mesh
+                                                    , M             const & mesh
                                                     , AT            const & attributes
                                                     , unsigned int  const & label
                                                     )
@@ -32,7 +33,9 @@ namespace grit
       typedef typename MT::vector3_type V;
       typedef typename V::value_traits  VT;
 
-      assert( IsInterface(mesh)(s) || !"compute_normal(): Internal error A");
+      typedef BasicInPhase<M>           InPhase;
+
+      assert( BasicIsInterface<M>(mesh)(s) || !"compute_normal(): Internal error A");
 
       SimplexSet const Vs = filter( mesh.closure(s), IsDimension( mesh, 0u));
 
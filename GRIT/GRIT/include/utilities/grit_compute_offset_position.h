@@ -22,10 +22,11 @@ namespace grit
     template<
              typename   MT
              , typename AT ///< attribute manager types
+             , typename M  ///< mesh type
              >
     inline typename MT::vector3_type compute_offset_position(
                                                              Simplex0                 const & v
-                                                             , InterfaceMesh          const & mesh
+                                                             , M                      const & mesh
                                                              , AT                     const & attributes
                                                              , unsigned int           const & label
                                                              , typename MT::real_type const & distance
@@ -35,6 +36,9 @@ namespace grit
       typedef typename MT::real_type    T;
       typedef typename V::value_traits  VT;
 
+      typedef BasicIsInterface<M>       IsInterface;
+      typedef BasicInPhase<M>           InPhase;
+
       assert( IsInterface(mesh)(v) || !"compute_offset_position(): Internal error A");
 
       SimplexSet const Sv = mesh.star(v);
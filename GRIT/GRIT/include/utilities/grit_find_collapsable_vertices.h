@@ -18,16 +18,20 @@ namespace grit
      * b) if either vertex v or vo of edge e are on submesh boundary
      * c) if collapsing v onto vo would produce ears (if the parameters.no_ears() flag is on)
      */
-    bool preserves_boundary(
+    template<typename M>
+    inline bool preserves_boundary(
                             Simplex0        const & v  ///< a vertex of edge e
                             , Simplex0      const & vo ///< simplex0 opposite to v in e
                             , Simplex1      const & e  ///< simplex1 to be collapsed
                             , SimplexSet    const & C  ///< closure of an edge containing v
                             , SimplexSet    const & L  ///< link of v
-                            , InterfaceMesh const & mesh
+                            , M             const & mesh
                             , Parameters    const & parameters
                             )
     {
+      typedef BasicIsSubmeshBoundary<M> IsSubmeshBoundary;
+      typedef BasicIsBoundary<M>        IsBoundary;
+
       //--- Collapsing submesh boundary vertices, as well as collapsing onto
       //--- submesh boundary vertices can modify attribute values at those vertices
       //--- an hence is disallowed.
@@ -49,12 +53,15 @@ namespace grit
      * b) vertex v is on the interface, e is also an interface edge, and v is 1-manifold.
      * Otherwise returns false.
      */
-    bool preserves_interface(
+    template<typename M>
+    inline bool preserves_interface(
                              Simplex0        const & v  ///< a vertex of e
                              , Simplex1      const & e  ///< simplex1 to be collapsed
-                             , InterfaceMesh const & mesh
+                             , M             const & mesh
                              )
     {
+      typedef BasicIsInterface<M> IsInterface;
+
       if( IsInterface(mesh)(v))
       {
         if( IsInterface(mesh)(e))
@@ -85,14 +92,18 @@ namespace grit
      * of simplex which can be collapsed without destroying mesh
      * topology and without deforming the interface or mesh boundary.
      */
-    SimplexSet find_collapsable_vertices(
+    template<typename M>
+    inline SimplexSet find_collapsable_vertices(
                                          Simplex1        const & simplex             ///< an edge to be collapsed
-                                         , InterfaceMesh const & mesh
+                                         , M             const & mesh
                                          , Parameters    const & parameters
                                          , bool          const   preserve_interface  ///< a flag specifying whether to perform
                                                                                      ///< interface preserving test (yes if true)
                                          )
     {
+      typedef BasicIsSubmeshBoundary<M> IsSubmeshBoundary;
+      typedef BasicIsValid<M>           IsValid;
+
       SimplexSet result;
 
       //--- We can never change submesh boundary
@@ -2,12 +2,20 @@
 #define GRIT_HAS_MULTIPLE_VERTICES_H
 
 #include <grit_simplex_set.h>
+#include <grit_spatial_hash.h>
 
 namespace grit
 {
   namespace details
   {
 
+    /**
+     * Tests if any two vertices of S are closer than threshold, measured
+     * as the largest absolute coordinate difference. The vertices are
+     * added one by one to a spatial hash with the threshold as cell size,
+     * and each vertex is tested against those added before it, so the
+     * test takes expected linear time.
+     */
     template<
              typename V
              , typename AMT ///< attribute manager type
@@ -20,28 +28,25 @@ namespace grit
     {
       typedef SimplexSet::simplex0_const_iterator iterator;
 
+      //--- No two vertices can be closer than a non-positive threshold
+      if( threshold <= V::value_traits::zero() )
+        return false;
+
+      SpatialHash<V> grid( threshold );
+
+      grid.reserve( S.size(0u) );
+
       iterator a   = S.begin0();
       iterator end = S.end0();
 
       for(; a != end; ++a)
       {
-
         V const & r_a = attributes.get_current_value( *a );
 
-        iterator b = a;
-        ++b;
-
-        for(; b != end; ++b)
-        {
-          V const & r_b = attributes.get_current_value( *b );
-
-          V const diff = r_a - r_b;
-
-          if(  norm_1( diff ) < threshold )
-            return true;
-
-        }
+        if( grid.has_within( r_a, threshold ) )
+          return true;
 
+        grid.insert( *a, r_a );
       }
 
       return false;
@@ -6,8 +6,6 @@
 
 #include <util_triangle_area.h>
 
-#include <vector>
-
 namespace grit
 {
   namespace details
@@ -34,7 +32,8 @@ namespace grit
       {
         Simplex2 const & s2 = *it;
 
-        std::vector<V> vertices(3u);
+        V vertices[3u];
+
         for (unsigned int i = 0u; i < 3u; ++i)
         {
           Simplex0 const & s0 = s2.get_simplex_from_local_index(i);
@@ -85,7 +84,7 @@ namespace grit
 
         assert( id_current < 3u || !"is_any_inverted() ERROR simplex not found in indices vector.");
 
-        std::vector<V> vertices(3u);
+        V vertices[3u];
 
         for (unsigned int i = 0u; i < 3u; ++i)
         {
@@ -46,9 +46,9 @@ namespace grit
 
   /// Return the length of the longest edge in triangle @param simplex,
   /// on return @param max_edge is the longest edge handle.
-  template <typename MT>
+  template <typename MT, typename M>
   inline typename MT::real_type longest_edge(
-                               InterfaceMesh const & mesh
+                               M const & mesh
                                , Simplex0AttributeVector<typename MT::vector3_type> const & current
                                , Simplex2 const & simplex
                                , Simplex1 & max_edge
@@ -6,8 +6,9 @@
 namespace grit
 {
   /// Returns the opposite vertex to @param edge in triangle @param simplex.
+  template<typename M>
   inline Simplex0 opposite_vertex(
-                                  InterfaceMesh const & mesh
+                                  M             const & mesh
                                   , Simplex2 const & simplex
                                   , Simplex1 const & edge
                                   )
@@ -44,7 +44,7 @@ namespace grit
       {
         if( value == old_labels[i])
         {
-          mesh.label(t) = new_labels[i];
+          mesh.set_label(t, new_labels[i]);
         }
       }
     }
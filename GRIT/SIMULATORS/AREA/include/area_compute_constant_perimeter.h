@@ -10,12 +10,13 @@
 
 namespace area
 {
+  template<typename T>
   inline void compute_constant_perimeter(
                                      glue::Phase const & boundary
-                                   , std::vector<double> const & px
-                                   , std::vector<double> const & py
-                                   , std::vector<double>       & px_new
-                                   , std::vector<double>       & py_new
+                                   , std::vector<T> const & px
+                                   , std::vector<T> const & py
+                                   , std::vector<T>       & px_new
+                                   , std::vector<T>       & py_new
                                    , unsigned int const & max_perimeter_iterations
                                    , double const & beta
                                    , double const & c0
@@ -32,15 +33,15 @@ namespace area
     px_new = px;
     py_new = py;
 
-    double const c     = compute_perimeter(boundary.m_edges, px_new, py_new);
-    double const gamma = c - c0;
+    T const c     = compute_perimeter(boundary.m_edges, px_new, py_new);
+    T const gamma = c - c0;
 
     if( fabs( gamma ) > c_threshold)
     {
       for( unsigned int i = 0; i < max_perimeter_iterations; ++i)
       {
-        std::vector<double> grad_perimeter_x;
-        std::vector<double> grad_perimeter_y;
+        std::vector<T> grad_perimeter_x;
+        std::vector<T> grad_perimeter_y;
         area::compute_perimeter_gradient( boundary.m_edges, px_new, py_new, grad_perimeter_x, grad_perimeter_y);
 
         for( unsigned int n = 0; n < N; ++n)
@@ -9,12 +9,13 @@
 
 namespace area
 {
+  template<typename T>
   inline void compute_maximize_area(
                                      glue::Phase const & obj
-                                   , std::vector<double> const & px
-                                   , std::vector<double> const & py
-                                   , std::vector<double>       & px_new
-                                   , std::vector<double>       & py_new
+                                   , std::vector<T> const & px
+                                   , std::vector<T> const & py
+                                   , std::vector<T>       & px_new
+                                   , std::vector<T>       & py_new
                                    , unsigned int const & max_area_iterations
                                    , double const & alpha
                                    )
@@ -30,8 +31,8 @@ namespace area
 
     for( unsigned int i = 0; i < max_area_iterations; ++i)
     {
-      std::vector<double> grad_area_x;
-      std::vector<double> grad_area_y;
+      std::vector<T> grad_area_x;
+      std::vector<T> grad_area_y;
       area::compute_area_gradient( obj.m_triangles, px_new, py_new, grad_area_x, grad_area_y);
 
       for( unsigned int n = 0; n < N; ++n)
@@ -12,15 +12,16 @@
 namespace area
 {
   
-  inline double compute_perimeter(
+  template<typename T>
+  inline T compute_perimeter(
                                      std::vector<glue::Tuple> const & edges
-                                     , std::vector<double>  const & x        // x-component of nodal positions
-                                     , std::vector<double>  const & y        // y-component of nodal positions
+                                     , std::vector<T>  const & x        // x-component of nodal positions
+                                     , std::vector<T>  const & y        // y-component of nodal positions
                                      )
   {
     using std::sqrt;
 
-    double L = 0.0;
+    T L = 0.0;
 
     unsigned int const N = edges.size();
 
@@ -31,12 +32,12 @@ namespace area
 
       assert( i!=j || !"compute_perimeter(): i and j was the same");
 
-      double const xi = x[i];
-      double const xj = x[j];
-      double const yi = y[i];
-      double const yj = y[j];
+      T const xi = x[i];
+      T const xj = x[j];
+      T const yi = y[i];
+      T const yj = y[j];
 
-      double const Le = sqrt(   (xi-xj)*(xi-xj) + (yi-yj)*(yi-yj));
+      T const Le = sqrt(   (xi-xj)*(xi-xj) + (yi-yj)*(yi-yj));
 
       assert( is_finite(Le) || !"compute_perimeter(): Le was not finite");
       assert( Le>0         || !"compute_perimeter(): Le was non positive");
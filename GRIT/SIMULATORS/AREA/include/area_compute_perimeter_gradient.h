@@ -12,12 +12,13 @@
 namespace area
 {
   
+  template<typename T>
   inline void compute_perimeter_gradient(
                                      std::vector<glue::Tuple> const & edges
-                                     , std::vector<double>  const & x        // x-component of nodal positions
-                                     , std::vector<double>  const & y        // y-component of nodal positions
-                                     , std::vector<double>        & nabla_x  // x-component of area gradient
-                                     , std::vector<double>        & nabla_y  // y-component of area gradient
+                                     , std::vector<T>  const & x        // x-component of nodal positions
+                                     , std::vector<T>  const & y        // y-component of nodal positions
+                                     , std::vector<T>        & nabla_x  // x-component of area gradient
+                                     , std::vector<T>        & nabla_y  // y-component of area gradient
                                      )
   {
     using std::sqrt;
@@ -37,20 +38,20 @@ namespace area
 
       assert( i!=j || !"compute_perimeter_gradient(): i and j was the same");
 
-      double const xi = x[i];
-      double const xj = x[j];
-      double const yi = y[i];
-      double const yj = y[j];
+      T const xi = x[i];
+      T const xj = x[j];
+      T const yi = y[i];
+      T const yj = y[j];
 
-      double const Le = sqrt(   (xi-xj)*(xi-xj) + (yi-yj)*(yi-yj));
+      T const Le = sqrt(   (xi-xj)*(xi-xj) + (yi-yj)*(yi-yj));
 
       assert( is_finite(Le) || !"compute_perimeter_gradient(): Le was not finite");
       assert( Le>0          || !"compute_perimeter_gradient(): Le was non positive");
 
-      double const nabla_ix = (xi-xj)/Le;
-      double const nabla_iy = (yi-yj)/Le;
-      double const nabla_jx = (xj-xi)/Le;
-      double const nabla_jy = (yj-yi)/Le;
+      T const nabla_ix = (xi-xj)/Le;
+      T const nabla_iy = (yi-yj)/Le;
+      T const nabla_jx = (xj-xi)/Le;
+      T const nabla_jy = (yj-yi)/Le;
 
       nabla_x[i] += nabla_ix;
       nabla_x[j] += nabla_jx;
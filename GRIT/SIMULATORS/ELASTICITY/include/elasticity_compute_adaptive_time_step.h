@@ -93,6 +93,11 @@ namespace elasticity
       log << tab << "Adaptive: initialized dt = " << AdaptiveInfo::dt() << newline;
     }
 
+    // The trial objects are kept across iterations, so assigning obj to
+    // them reuses their storage instead of allocating new vectors.
+    Object A;
+    Object B;
+
     while (T_left>0.0)
     {
       // First we try if we are allowed to increase the time-step size
@@ -109,8 +114,8 @@ namespace elasticity
       // Then we make a test time-integration
       log << tab << "Adaptive: trying dt = " << AdaptiveInfo::dt() << newline;
 
-      Object A = obj;
-      Object B = obj;
+      A = obj;
+      B = obj;
 
       compute_semi_implicit_time_step(AdaptiveInfo::dt()/2.0, A, params);
       compute_semi_implicit_time_step(AdaptiveInfo::dt()/2.0, A, params);
@@ -120,7 +125,7 @@ namespace elasticity
       if( accuracy(A,B) <= params.halving_tolerance()  || T_left <= params.min_dt() )
       {
 
-        obj = A;
+        obj.swap(A);
         ++AdaptiveInfo::unchanged();
 
       }else{
@@ -147,8 +152,8 @@ namespace elasticity
           
         }while( accuracy(A,B) > params.halving_tolerance() );
         
-        obj = A;
-        
+        obj.swap(A);
+
         AdaptiveInfo::unchanged() = 1;
       }
       
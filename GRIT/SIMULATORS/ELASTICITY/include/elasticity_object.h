@@ -9,6 +9,7 @@
 #include <vector>
 #include <cassert>
 #include <map>
+#include <utility>  // Needed for std::move and std::swap
 
 namespace elasticity
 {
@@ -47,6 +48,26 @@ namespace elasticity
     : glue::Phase(phase)
     {}
 
+    Object(glue::Phase && phase)
+    : glue::Phase( std::move(phase) )
+    {}
+
+    Object(Object && obj)
+    : glue::Phase( std::move(obj) )
+    , m_px0(       std::move(obj.m_px0)       )
+    , m_py0(       std::move(obj.m_py0)       )
+    , m_px(        std::move(obj.m_px)        )
+    , m_py(        std::move(obj.m_py)        )
+    , m_vx(        std::move(obj.m_vx)        )
+    , m_vy(        std::move(obj.m_vy)        )
+    , m_px_new(    std::move(obj.m_px_new)    )
+    , m_py_new(    std::move(obj.m_py_new)    )
+    , m_vx_new(    std::move(obj.m_vx_new)    )
+    , m_vy_new(    std::move(obj.m_vy_new)    )
+    , m_traction(  std::move(obj.m_traction)  )
+    , m_dirichlet( std::move(obj.m_dirichlet) )
+    {}
+
     virtual ~Object(){}
 
     Object const & operator=(Object const & obj)
@@ -72,7 +93,51 @@ namespace elasticity
       }
       return *this;
     }
-    
+
+    Object const & operator=(Object && obj)
+    {
+      if(this != &obj)
+      {
+        glue::Phase::operator=( std::move(obj) );
+
+        this->m_px0 = std::move(obj.m_px0);
+        this->m_py0 = std::move(obj.m_py0);
+        this->m_px  = std::move(obj.m_px);
+        this->m_py  = std::move(obj.m_py);
+        this->m_vx  = std::move(obj.m_vx);
+        this->m_vy  = std::move(obj.m_vy);
+
+        this->m_px_new = std::move(obj.m_px_new);
+        this->m_py_new = std::move(obj.m_py_new);
+        this->m_vx_new = std::move(obj.m_vx_new);
+        this->m_vy_new = std::move(obj.m_vy_new);
+
+        this->m_traction  = std::move(obj.m_traction);
+        this->m_dirichlet = std::move(obj.m_dirichlet);
+      }
+      return *this;
+    }
+
+    void swap(Object & obj)
+    {
+      glue::Phase::swap(obj);
+
+      this->m_px0.swap(obj.m_px0);
+      this->m_py0.swap(obj.m_py0);
+      this->m_px.swap(obj.m_px);
+      this->m_py.swap(obj.m_py);
+      this->m_vx.swap(obj.m_vx);
+      this->m_vy.swap(obj.m_vy);
+
+      this->m_px_new.swap(obj.m_px_new);
+      this->m_py_new.swap(obj.m_py_new);
+      this->m_vx_new.swap(obj.m_vx_new);
+      this->m_vy_new.swap(obj.m_vy_new);
+
+      std::swap(this->m_traction,  obj.m_traction);
+      std::swap(this->m_dirichlet, obj.m_dirichlet);
+    }
+
   };
 
 }// end of namespace elasticity
@@ -25,7 +25,12 @@
 #include <util_index_helper.h>
 #include <util_string_helper.h>
 #include <util_sort.h>
+#include <util_arena.h>
+#include <util_vector2.h>
+#include <util_morton.h>
+#include <util_thread_pool.h>
 #include <util_same_sign.h>
+#include <util_robust_real.h>
 #include <util_is_ccw.h>
 #include <util_determinant.h>
 #include <util_boolean.h>
@@ -0,0 +1,191 @@
+#ifndef UTIL_ARENA_H
+#define UTIL_ARENA_H
+
+#include <vector>
+#include <algorithm>  // needed for std::max
+#include <utility>    // needed for std::pair
+#include <new>        // needed for ::operator new and ::operator delete
+#include <cstddef>    // needed for std::size_t and std::max_align_t
+
+namespace util
+{
+
+  /**
+   * Monotonic Arena.
+   * Memory is handed out by bumping a pointer through a list of blocks,
+   * and is never given back individually. Instead reset() makes all the
+   * memory available again at once, keeping the blocks for reuse. After
+   * the first few resets the arena has grown to the size of the largest
+   * working set, and allocations no longer reach the heap at all.
+   *
+   * An arena is not thread safe, every thread should use its own arena.
+   */
+  class MonotonicArena
+  {
+  protected:
+
+    typedef std::pair<char*, std::size_t>  block_type;   ///< A block and its size in bytes.
+
+    std::vector<block_type>   m_blocks;       ///< All blocks owned by the arena.
+    std::size_t               m_block_size;   ///< The size of the first block.
+    std::size_t               m_block;        ///< Index of the block currently allocated from.
+    std::size_t               m_offset;       ///< Number of bytes used in the current block.
+
+  protected:
+
+    static std::size_t align(std::size_t const & n)
+    {
+      std::size_t const a = alignof(std::max_align_t);
+
+      return (n + a - 1u) & ~(a - 1u);
+    }
+
+  public:
+
+    /**
+     * No memory is allocated until the first allocation, so an arena that
+     * is never used costs nothing.
+     */
+    MonotonicArena(std::size_t const & block_size = 4096u)
+    : m_block_size(block_size)
+    , m_block(0u)
+    , m_offset(0u)
+    {}
+
+    ~MonotonicArena()
+    {
+      for (std::size_t i = 0u; i < m_blocks.size(); ++i)
+        ::operator delete(m_blocks[i].first);
+    }
+
+  private:
+
+    MonotonicArena(MonotonicArena const &);
+    MonotonicArena & operator=(MonotonicArena const &);
+
+  public:
+
+    void * allocate(std::size_t const & bytes)
+    {
+      std::size_t const n = align(bytes);
+
+      while (m_block == m_blocks.size() || m_offset + n > m_blocks[m_block].second)
+      {
+        if (m_block < m_blocks.size())
+        {
+          ++m_block;
+          m_offset = 0u;
+        }
+
+        if (m_block == m_blocks.size())
+        {
+          std::size_t const size = std::max( m_blocks.empty() ? m_block_size : 2u*m_blocks.back().second, n );
+
+          m_blocks.push_back( block_type( static_cast<char*>( ::operator new(size) ), size ) );
+        }
+      }
+
+      void * p = m_blocks[m_block].first + m_offset;
+
+      m_offset += n;
+
+      return p;
+    }
+
+    /**
+     * Makes all memory of the arena available again. Anything allocated
+     * from the arena must have been destroyed before calling reset().
+     */
+    void reset()
+    {
+      m_block  = 0u;
+      m_offset = 0u;
+    }
+
+    /**
+     * @return   The total number of bytes held by the arena.
+     */
+    std::size_t capacity() const
+    {
+      std::size_t total = 0u;
+
+      for (std::size_t i = 0u; i < m_blocks.size(); ++i)
+        total += m_blocks[i].second;
+
+      return total;
+    }
+
+  };
+
+  /**
+   * Standard library allocator drawing from a MonotonicArena. Deallocation
+   * is a no-op, memory is reclaimed when the arena is reset. A default
+   * constructed allocator has no arena and uses the heap, so containers
+   * using this allocator work as usual when no arena is given.
+   */
+  template<typename T>
+  class ArenaAllocator
+  {
+  public:
+
+    typedef T            value_type;
+    typedef std::size_t  size_type;
+
+    template<typename U>
+    class rebind
+    {
+    public:
+      typedef ArenaAllocator<U> other;
+    };
+
+    MonotonicArena * m_arena;   ///< The arena to allocate from, or null to use the heap.
+
+  public:
+
+    ArenaAllocator()
+    : m_arena(0)
+    {}
+
+    explicit ArenaAllocator(MonotonicArena * arena)
+    : m_arena(arena)
+    {}
+
+    template<typename U>
+    ArenaAllocator(ArenaAllocator<U> const & other)
+    : m_arena(other.m_arena)
+    {}
+
+  public:
+
+    T * allocate(std::size_t const n)
+    {
+      if (m_arena)
+        return static_cast<T*>( m_arena->allocate( n*sizeof(T) ) );
+
+      return static_cast<T*>( ::operator new( n*sizeof(T) ) );
+    }
+
+    void deallocate(T * p, std::size_t const /*n*/)
+    {
+      if (!m_arena)
+        ::operator delete(p);
+    }
+
+  };
+
+  template<typename T, typename U>
+  inline bool operator==(ArenaAllocator<T> const & a, ArenaAllocator<U> const & b)
+  {
+    return a.m_arena == b.m_arena;
+  }
+
+  template<typename T, typename U>
+  inline bool operator!=(ArenaAllocator<T> const & a, ArenaAllocator<U> const & b)
+  {
+    return a.m_arena != b.m_arena;
+  }
+
+}//end of namespace util
+
+// UTIL_ARENA_H
+#endif
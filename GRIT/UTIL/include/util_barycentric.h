@@ -3,6 +3,7 @@
 
 #include <util_is_number.h>
 #include <util_is_finite.h>
+#include <util_vector2.h>
 
 #include <OpenTissue/core/math/math_matrix3x3.h>
 #include <OpenTissue/core/math/math_vector3.h>
@@ -185,6 +186,97 @@ namespace util
     assert( is_number(w3) || !"barycentric(): NaN encountered");
   }
 
+  /*
+   * Compute Barycentric Coordinates.
+   * Specialization of the triangle version for 2D vectors. The triangle
+   * normal reduces to the sign of the z-component of the cross product,
+   * and the computation is otherwise carried out in the same order as for
+   * 3D vectors in the xy-plane, so both give the same result.
+   */
+  template<typename T>
+  inline void barycentric(
+                           Vector2<T> const & x1
+                           , Vector2<T> const & x2
+                           , Vector2<T> const & x3
+                           , Vector2<T> const & p
+                           , T & w1
+                           , T & w2
+                           , T & w3
+                           )
+  {
+    using std::max;
+    using std::sqrt;
+    using std::fabs;
+
+    typedef          Vector2<T>                     V;
+    typedef typename V::value_traits                VT;
+
+    V const bc = (x1+x2+x3)/3.;
+    V const v1 = x1-bc;
+    V const v2 = x2-bc;
+    V const v3 = x3-bc;
+
+    T const l1 = length(v1);
+    T const l2 = length(v2);
+    T const l3 = length(v3);
+
+    assert( is_number(l1)    || !"barycentric(): NaN encountered");
+    assert( is_number(l2)    || !"barycentric(): NaN encountered");
+    assert( is_number(l3)    || !"barycentric(): NaN encountered");
+    assert( is_finite(l1)    || !"barycentric(): Inf encountered");
+    assert( is_finite(l2)    || !"barycentric(): Inf encountered");
+    assert( is_finite(l3)    || !"barycentric(): Inf encountered");
+
+    T const r  = max( max( l1, l2), l3);
+
+    assert( r > VT::zero() || !"barycentric(): norm was non-positive");
+
+    V const y1 = v1/r;
+    V const y2 = v2/r;
+    V const y3 = v3/r;
+
+    V const pp = (p-bc)/r;
+
+    T const b3 = cross( unit(y2 - y1), unit(y3 - y1));
+    T const l  = sqrt( b3*b3 );
+    T const n  = l > VT::zero() ? (VT::one()/l)*b3 : VT::zero();
+
+    T const a1 = n*cross( y3-y2, pp-y2);
+    T const a2 = n*cross( y1-y3, pp-y3);
+    T const a3 = n*cross( y2-y1, pp-y1);
+
+    T const a  = n*cross( y2-y1, y3-y1);
+
+    assert( a!=VT::zero() || !"barycentric(): division by 0");
+
+    T const ab1 = fabs(a1);
+    T const ab2 = fabs(a2);
+    T const ab3 = fabs(a3);
+
+    if( ab1 <= ab2 && ab1 <= ab3)
+    {
+      w2 = a2/a;
+      w3 = a3/a;
+      w1 = VT::one()-w2-w3;
+    }
+    else if( ab2 <= ab1 && ab2 <= ab3)
+    {
+      w1 = a1/a;
+      w3 = a3/a;
+      w2 = VT::one()-w1-w3;
+    }
+    else
+    {
+      w1 = a1/a;
+      w2 = a2/a;
+      w3 = VT::one()-w1-w2;
+    }
+
+    assert( is_number(w1) || !"barycentric(): NaN encountered");
+    assert( is_number(w2) || !"barycentric(): NaN encountered");
+    assert( is_number(w3) || !"barycentric(): NaN encountered");
+  }
+
   /*
    * Compute Barycentric Coordinates.
    * This method computes the barycentric coodinates for a point p of a tetrahedron
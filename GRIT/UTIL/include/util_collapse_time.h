@@ -3,6 +3,7 @@
 
 #include <util_is_finite.h>
 #include <util_is_number.h>
+#include <util_robust_real.h>
 
 #include <cassert>
 #include <cmath>   // needed for std::fabs & std::sqrt
@@ -17,6 +18,7 @@ namespace util
   /// and the velocities at the nodes u1, u2 and u3 becomes degenerate, i.e. the value of t for
   /// which triangle v1+u1*t, v2+u2*t, v3+u3*t has 0-area.
   /// Negative result indicates the triangle will not collapse for the current values of u1, u2 and u3.
+  /// The polynomial is set up and solved in RobustReal precision.
   template <typename V>
   inline typename V::value_type collapse_time(
                                        V const & v1
@@ -30,8 +32,9 @@ namespace util
     using std::fabs;
     using std::sqrt;
 
-    typedef typename V::value_type    T;
-    typedef typename V::value_traits  VT;
+    typedef typename V::value_type            T;
+    typedef typename V::value_traits          VT;
+    typedef typename RobustReal<T>::type      R;
 
     assert( is_finite(v1[0u]) || !"collapse_time(): internal error");
     assert( is_finite(v1[1u]) || !"collapse_time(): internal error");
@@ -47,14 +50,18 @@ namespace util
     assert( is_number(u3[0u]) || !"collapse_time(): internal error");
     assert( is_number(u3[1u]) || !"collapse_time(): internal error");
 
-    V const e12 = v2 - v1;
-    V const e13 = v3 - v1;
-    V const u12 = u2 - u1;
-    V const u13 = u3 - u1;
+    R const e12x = R(v2[0u]) - R(v1[0u]);
+    R const e12y = R(v2[1u]) - R(v1[1u]);
+    R const e13x = R(v3[0u]) - R(v1[0u]);
+    R const e13y = R(v3[1u]) - R(v1[1u]);
+    R const u12x = R(u2[0u]) - R(u1[0u]);
+    R const u12y = R(u2[1u]) - R(u1[1u]);
+    R const u13x = R(u3[0u]) - R(u1[0u]);
+    R const u13y = R(u3[1u]) - R(u1[1u]);
 
-    T const a = u12[0u]*u13[1u] - u12[1u]*u13[0u];
-    T const b = u12[0u]*e13[1u] + e12[0u]*u13[1u] - u12[1u]*e13[0u] - e12[1u]*u13[0u];
-    T const c = e12[0u]*e13[1u] - e12[1u]*e13[0u];
+    R const a = u12x*u13y - u12y*u13x;
+    R const b = u12x*e13y + e12x*u13y - u12y*e13x - e12y*u13x;
+    R const c = e12x*e13y - e12y*e13x;
 
     if (fabs(a) <= VT::zero())
     {
@@ -65,7 +72,7 @@ namespace util
       else
       {
 
-        T const result = -c/b;
+        T const result = static_cast<T>( -c/b );
 
         assert( is_finite(result) || !"collapse_time(): internal error");
         assert( is_number(result) || !"collapse_time(): internal error");
@@ -75,7 +82,7 @@ namespace util
     }
     else
     {
-      T const delta = b*b - VT::four()*a*c;
+      R const delta = b*b - VT::four()*a*c;
 
       if (delta <= VT::zero())
       {
@@ -83,14 +90,14 @@ namespace util
       }
       else
       {
-        T const root = (-b - sqrt(delta))/(VT::two()*a);
+        T const root = static_cast<T>( (-b - sqrt(delta))/(VT::two()*a) );
         assert( is_finite(root) || !"collapse_time(): internal error");
         assert( is_number(root) || !"collapse_time(): internal error");
 
         if (root >= VT::zero())
           return root;
 
-        T const result = (-b + sqrt(delta))/(VT::two()*a);
+        T const result = static_cast<T>( (-b + sqrt(delta))/(VT::two()*a) );
 
         assert( is_finite(result) || !"collapse_time(): internal error");
         assert( is_number(result) || !"collapse_time(): internal error");
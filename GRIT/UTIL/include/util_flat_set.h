@@ -0,0 +1,371 @@
+#ifndef UTIL_FLAT_SET_H
+#define UTIL_FLAT_SET_H
+
+#include <algorithm>  // needed for std::lower_bound, std::stable_sort, std::inplace_merge, std::unique
+#include <utility>    // needed for std::pair and std::move
+#include <cstddef>    // needed for std::size_t
+#include <cassert>
+
+namespace util
+{
+
+  /**
+   * Flat Set Container.
+   * This container keeps its values sorted and unique in a single contiguous
+   * array, and mimics the part of the std::set interface that is needed by
+   * set algorithms like std::set_union, std::set_difference and
+   * std::set_intersection (together with std::inserter).
+   *
+   * The first N values are stored inline in the container object itself, so
+   * small sets (like the star or the link of a vertex) never touch the heap.
+   * Larger sets fall back to a heap allocated array that grows geometrically.
+   *
+   * Warning: Unlike std::set, any insertion or removal invalidates iterators.
+   *
+   * @tparam T    The value type, must be default constructible, assignable
+   *              and have a strict weak ordering defined by operator<.
+   * @tparam N    The number of values that can be stored without heap allocation.
+   */
+  template <typename T, std::size_t N>
+  class FlatSet
+  {
+  public:
+
+    typedef T                 value_type;
+    typedef T                 key_type;
+    typedef T const &         reference;
+    typedef T const &         const_reference;
+    typedef T const *         iterator;
+    typedef T const *         const_iterator;
+    typedef std::size_t       size_type;
+    typedef std::ptrdiff_t    difference_type;
+
+  protected:
+
+    T           m_inline[N];   ///< Inline storage used as long as the set has at most N values.
+    T         * m_data;        ///< Points to either m_inline or a heap allocated array.
+    size_type   m_size;        ///< Number of values currently in the set.
+    size_type   m_capacity;    ///< Number of values m_data can hold.
+
+  protected:
+
+    bool is_inline() const { return m_data == m_inline; }
+
+    void reserve_at_least(size_type const & capacity)
+    {
+      if (capacity <= m_capacity)
+        return;
+
+      size_type new_capacity = m_capacity * 2u;
+
+      if (new_capacity < capacity)
+        new_capacity = capacity;
+
+      T * data = new T[new_capacity];
+
+      std::copy(m_data, m_data + m_size, data);
+
+      if (!is_inline())
+        delete [] m_data;
+
+      m_data     = data;
+      m_capacity = new_capacity;
+    }
+
+    /**
+     * Stable sort. Short ranges, like the simplices of a 1-ring, are
+     * insertion sorted in place as std::stable_sort would allocate a
+     * temporary buffer.
+     */
+    static void sort(T * first, T * last)
+    {
+      if (last - first > 32)
+      {
+        std::stable_sort(first, last);
+        return;
+      }
+
+      for (T * i = first + 1; i < last; ++i)
+      {
+        T const value = *i;
+        T *     j     = i;
+
+        for (; j != first && value < *(j - 1); --j)
+          *j = *(j - 1);
+
+        *j = value;
+      }
+    }
+
+    /**
+     * Takes over the values of A and leaves A empty. A heap allocated
+     * array is handed over as is, inline values are copied.
+     */
+    void steal(FlatSet & A)
+    {
+      if (A.is_inline())
+      {
+        std::copy(A.m_data, A.m_data + A.m_size, m_inline);
+        m_data     = m_inline;
+        m_capacity = N;
+      }
+      else
+      {
+        m_data     = A.m_data;
+        m_capacity = A.m_capacity;
+      }
+
+      m_size = A.m_size;
+
+      A.m_data     = A.m_inline;
+      A.m_size     = 0u;
+      A.m_capacity = N;
+    }
+
+    T * mutable_position(const_iterator const & position)
+    {
+      return m_data + (position - m_data);
+    }
+
+    iterator insert_at(T * position, T const & value)
+    {
+      size_type const offset = position - m_data;
+
+      reserve_at_least(m_size + 1u);
+
+      T * const p = m_data + offset;
+
+      std::copy_backward(p, m_data + m_size, m_data + m_size + 1u);
+      *p = value;
+      ++m_size;
+
+      return p;
+    }
+
+  public:
+
+    const_iterator begin() const { return m_data;          }
+    const_iterator end()   const { return m_data + m_size; }
+
+    size_type size()     const { return m_size;        }
+    bool      empty()    const { return m_size == 0u;  }
+    size_type capacity() const { return m_capacity;    }
+
+  public:
+
+    FlatSet()
+    : m_data(m_inline)
+    , m_size(0u)
+    , m_capacity(N)
+    {}
+
+    FlatSet(FlatSet const & A)
+    : m_data(m_inline)
+    , m_size(0u)
+    , m_capacity(N)
+    {
+      *this = A;
+    }
+
+    FlatSet(FlatSet && A)
+    : m_data(m_inline)
+    , m_size(0u)
+    , m_capacity(N)
+    {
+      steal(A);
+    }
+
+    template <typename iterator_type>
+    FlatSet(iterator_type const & first, iterator_type const & last)
+    : m_data(m_inline)
+    , m_size(0u)
+    , m_capacity(N)
+    {
+      insert(first, last);
+    }
+
+    ~FlatSet()
+    {
+      if (!is_inline())
+        delete [] m_data;
+    }
+
+    FlatSet & operator=(FlatSet const & A)
+    {
+      if (this != &A)
+      {
+        m_size = 0u;
+        reserve_at_least(A.m_size);
+        std::copy(A.m_data, A.m_data + A.m_size, m_data);
+        m_size = A.m_size;
+      }
+      return *this;
+    }
+
+    FlatSet & operator=(FlatSet && A)
+    {
+      if (this != &A)
+      {
+        if (!is_inline())
+          delete [] m_data;
+
+        steal(A);
+      }
+      return *this;
+    }
+
+    void swap(FlatSet & A)
+    {
+      FlatSet tmp( std::move(A) );
+
+      A     = std::move(*this);
+      *this = std::move(tmp);
+    }
+
+  public:
+
+    void clear()
+    {
+      m_size = 0u;
+    }
+
+    void reserve(size_type const & capacity)
+    {
+      reserve_at_least(capacity);
+    }
+
+    const_iterator lower_bound(T const & value) const
+    {
+      return std::lower_bound(begin(), end(), value);
+    }
+
+    const_iterator find(T const & value) const
+    {
+      const_iterator const p = lower_bound(value);
+
+      if (p != end() && !(value < *p))
+        return p;
+
+      return end();
+    }
+
+    size_type count(T const & value) const
+    {
+      return find(value) != end() ? 1u : 0u;
+    }
+
+    std::pair<iterator, bool> insert(T const & value)
+    {
+      // Fast path for the common case of inserting values in sorted order.
+      if (m_size == 0u || m_data[m_size - 1u] < value)
+        return std::make_pair(insert_at(m_data + m_size, value), true);
+
+      T * const p = mutable_position(lower_bound(value));
+
+      if (!(value < *p))
+        return std::make_pair(const_iterator(p), false);
+
+      return std::make_pair(insert_at(p, value), true);
+    }
+
+    /**
+     * Insert with a position hint. If the value belongs right before the
+     * hint it is inserted without searching. This makes std::inserter
+     * appending sorted output (as std::set_union and friends do) run in
+     * amortized constant time per value.
+     */
+    iterator insert(const_iterator const & hint, T const & value)
+    {
+      bool const after_previous = (hint == begin()) || (*(hint - 1) < value);
+      bool const before_hint    = (hint == end())   || (value < *hint);
+
+      if (after_previous && before_hint)
+        return insert_at(mutable_position(hint), value);
+
+      return insert(value).first;
+    }
+
+    /**
+     * Range insertion. All values are appended and then merged into place
+     * in one go, so inserting k values into a set of n values costs
+     * O(n + k log k) rather than O(n k).
+     */
+    template <typename iterator_type>
+    void insert(iterator_type first, iterator_type const & last)
+    {
+      size_type const old_size = m_size;
+
+      for (; first != last; ++first)
+      {
+        reserve_at_least(m_size + 1u);
+        m_data[m_size++] = *first;
+      }
+
+      if (m_size == old_size)
+        return;
+
+      T * const middle = m_data + old_size;
+      T * const stop   = m_data + m_size;
+
+      if (!std::is_sorted(middle, stop))
+        sort(middle, stop);
+
+      if (old_size > 0u && !(*(middle - 1) < *middle))
+        std::inplace_merge(m_data, middle, stop);
+
+      m_size = std::unique(m_data, stop, equivalent) - m_data;
+    }
+
+    size_type erase(T const & value)
+    {
+      const_iterator const p = find(value);
+
+      if (p == end())
+        return 0u;
+
+      erase(p);
+
+      return 1u;
+    }
+
+    void erase(const_iterator const & position)
+    {
+      assert(position >= begin() && position < end() || !"FlatSet::erase(): position out of range");
+
+      T * const p = mutable_position(position);
+
+      std::copy(p + 1, m_data + m_size, p);
+      --m_size;
+    }
+
+  protected:
+
+    static bool equivalent(T const & a, T const & b)
+    {
+      return !(a < b) && !(b < a);
+    }
+
+  };
+
+  template <typename T, std::size_t N>
+  inline void swap(FlatSet<T,N> & A, FlatSet<T,N> & B)
+  {
+    A.swap(B);
+  }
+
+  template <typename T, std::size_t N>
+  inline bool operator==(FlatSet<T,N> const & A, FlatSet<T,N> const & B)
+  {
+    return A.size() == B.size() && std::equal(A.begin(), A.end(), B.begin());
+  }
+
+  template <typename T, std::size_t N>
+  inline bool operator!=(FlatSet<T,N> const & A, FlatSet<T,N> const & B)
+  {
+    return !(A == B);
+  }
+
+}//end of namespace util
+
+// UTIL_FLAT_SET_H
+#endif
@@ -1,6 +1,8 @@
 #ifndef UTIL_IS_CCW_H
 #define UTIL_IS_CCW_H
 
+#include <util_robust_real.h>
+
 namespace util
 {
   template <typename V>
@@ -10,12 +12,26 @@ namespace util
                      , V const & v2
                      )
   {
+    typedef typename V::value_type               T;
+    typedef typename RobustReal<T>::type         R;
+
+    R const x0 = v0[0];
+    R const y0 = v0[1];
+    R const x1 = v1[0];
+    R const y1 = v1[1];
+    R const x2 = v2[0];
+    R const y2 = v2[1];
+
     // Transform to barycentric system of coordinates
-	V const vc = (v0 + v1 + v2) / 3.;
+    R const cx = (x0 + x1 + x2) / 3.;
+    R const cy = (y0 + y1 + y2) / 3.;
 
-	V const w0 = v0 - vc;
-	V const w1 = v1 - vc;
-	V const w2 = v2 - vc;
+    R const w0x = x0 - cx;
+    R const w0y = y0 - cy;
+    R const w1x = x1 - cx;
+    R const w1y = y1 - cy;
+    R const w2x = x2 - cx;
+    R const w2y = y2 - cy;
 
     //  The (double) signed area is by definition given as
     //
@@ -28,9 +44,9 @@ namespace util
     //
     //  if d>0 we have positive area and this is the same as ccw order
     //
-    return (w0[0] * w1[1]) + (w1[0] * w2[1]) +
-           (w2[0] * w0[1]) - (w1[1] * w2[0]) -
-           (w2[1] * w0[0]) - (w0[1] * w1[0]) > 0;
+    return (w0x * w1y) + (w1x * w2y) +
+           (w2x * w0y) - (w1y * w2x) -
+           (w2y * w0x) - (w0y * w1x) > 0;
   }
 
 }//end of namespace util
@@ -0,0 +1,42 @@
+#ifndef UTIL_MORTON_H
+#define UTIL_MORTON_H
+
+namespace util
+{
+
+  /**
+   * Spreads the bits of a 32 bit integer so that bit i ends up at bit 2i
+   * of the result, leaving the odd bits zero.
+   */
+  inline unsigned long long spread_bits(unsigned int const & x)
+  {
+    unsigned long long v = x;
+
+    v = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+    v = (v | (v <<  8)) & 0x00FF00FF00FF00FFull;
+    v = (v | (v <<  4)) & 0x0F0F0F0F0F0F0F0Full;
+    v = (v | (v <<  2)) & 0x3333333333333333ull;
+    v = (v | (v <<  1)) & 0x5555555555555555ull;
+
+    return v;
+  }
+
+  /**
+   * Morton Code.
+   * Interleaves the bits of two integer grid coordinates. Sorting points
+   * by the Morton code of their grid cells orders them along a Z-shaped
+   * space filling curve, so points that are close in the plane mostly end
+   * up close in the sorted order.
+   *
+   * @param x    The first grid coordinate, goes to the even bits.
+   * @param y    The second grid coordinate, goes to the odd bits.
+   */
+  inline unsigned long long morton_code(unsigned int const & x, unsigned int const & y)
+  {
+    return spread_bits(x) | (spread_bits(y) << 1);
+  }
+
+}//end of namespace util
+
+// UTIL_MORTON_H
+#endif
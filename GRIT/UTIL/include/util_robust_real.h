@@ -0,0 +1,33 @@
+#ifndef UTIL_ROBUST_REAL_H
+#define UTIL_ROBUST_REAL_H
+
+namespace util
+{
+
+  /**
+   * The type that robustness-critical predicates, like orientation tests
+   * and collapse times, use internally. Single precision input is promoted
+   * to double, so coordinates can be stored in float without making the
+   * sign of a predicate depend on float round-off. The result is exactly
+   * the same as before for double precision input.
+   */
+  template <typename T>
+  class RobustReal
+  {
+  public:
+
+    typedef double type;
+  };
+
+  template <>
+  class RobustReal<long double>
+  {
+  public:
+
+    typedef long double type;
+  };
+
+}//end of namespace util
+
+// UTIL_ROBUST_REAL_H
+#endif
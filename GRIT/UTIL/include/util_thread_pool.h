@@ -0,0 +1,219 @@
+#ifndef UTIL_THREAD_POOL_H
+#define UTIL_THREAD_POOL_H
+
+#include <util_use_pthreads.h>
+
+#include <vector>
+#include <cassert>
+
+namespace util
+{
+
+  /**
+   * Persistent Thread Pool.
+   * Worker threads are created once and then wait for work, instead of
+   * creating and joining a thread for every task. A call to run() hands a
+   * batch of tasks to the workers and returns when all tasks are done, so
+   * the end of run() acts as a barrier. Workers keep their thread (and
+   * optionally their CPU core) for the lifetime of the pool, so caches
+   * stay warm between batches.
+   *
+   * Tasks have the same signature as a pthread start routine. The pool
+   * can be shared, calls to run() from different threads are served one
+   * batch at a time.
+   */
+  class ThreadPool
+  {
+  public:
+
+    typedef void * (*task_type)(void *);
+
+  protected:
+
+    std::vector<pthread_t>   m_threads;       ///< The worker threads.
+    bool                     m_pin_threads;   ///< If true, worker i only runs on CPU core i.
+
+    pthread_mutex_t          m_run_mutex;     ///< Serializes calls to run().
+    pthread_mutex_t          m_mutex;         ///< Protects all members below.
+    pthread_cond_t           m_work_ready;    ///< Signalled when a new batch starts, or the pool stops.
+    pthread_cond_t           m_work_done;     ///< Signalled when the last task of a batch is done.
+
+    task_type                m_task;          ///< The task function of the current batch.
+    std::vector<void *>      m_arguments;     ///< One argument per task of the current batch.
+    size_t                   m_next;          ///< Index of the next task to start.
+    size_t                   m_pending;       ///< Number of tasks not yet done.
+    unsigned int             m_batch;         ///< Number of batches started, workers use it to spot new work.
+    bool                     m_stop;          ///< True when the workers should exit.
+
+  protected:
+
+    static void * worker(void * pool)
+    {
+      static_cast<ThreadPool *>(pool)->work();
+
+      return 0;
+    }
+
+    void work()
+    {
+      unsigned int seen = 0u;
+
+      pthread_mutex_lock( &m_mutex );
+
+      for (;;)
+      {
+        while (!m_stop && m_batch == seen)
+          pthread_cond_wait( &m_work_ready, &m_mutex );
+
+        if (m_stop)
+          break;
+
+        seen = m_batch;
+
+        while (m_next < m_arguments.size())
+        {
+          void * const argument = m_arguments[m_next++];
+
+          pthread_mutex_unlock( &m_mutex );
+
+          m_task(argument);
+
+          pthread_mutex_lock( &m_mutex );
+
+          if (--m_pending == 0u)
+            pthread_cond_signal( &m_work_done );
+        }
+      }
+
+      pthread_mutex_unlock( &m_mutex );
+    }
+
+    void pin(size_t const & i)
+    {
+#ifdef __linux__
+      cpu_set_t cpus;
+
+      CPU_ZERO( &cpus );
+      CPU_SET( i % CPU_SETSIZE, &cpus );
+
+      pthread_setaffinity_np( m_threads[i], sizeof(cpu_set_t), &cpus );
+#endif
+    }
+
+  public:
+
+    /**
+     * No threads are created until the first call to run() or resize().
+     *
+     * @param pin_threads   If true, each worker is bound to one CPU core
+     *                      (only supported on Linux, ignored elsewhere).
+     */
+    ThreadPool(bool const & pin_threads = false)
+    : m_threads()
+    , m_pin_threads(pin_threads)
+    , m_task(0)
+    , m_arguments()
+    , m_next(0u)
+    , m_pending(0u)
+    , m_batch(0u)
+    , m_stop(false)
+    {
+      pthread_mutex_init( &m_run_mutex, NULL );
+      pthread_mutex_init( &m_mutex, NULL );
+      pthread_cond_init( &m_work_ready, NULL );
+      pthread_cond_init( &m_work_done, NULL );
+    }
+
+    ~ThreadPool()
+    {
+      pthread_mutex_lock( &m_mutex );
+      m_stop = true;
+      pthread_cond_broadcast( &m_work_ready );
+      pthread_mutex_unlock( &m_mutex );
+
+      for (size_t i = 0u; i < m_threads.size(); ++i)
+        pthread_join( m_threads[i], NULL );
+
+      pthread_cond_destroy( &m_work_done );
+      pthread_cond_destroy( &m_work_ready );
+      pthread_mutex_destroy( &m_mutex );
+      pthread_mutex_destroy( &m_run_mutex );
+    }
+
+  private:
+
+    ThreadPool(ThreadPool const &);
+    ThreadPool & operator=(ThreadPool const &);
+
+  public:
+
+    size_t size() const { return m_threads.size(); }
+
+    /**
+     * Makes sure the pool has at least n workers. Workers are never
+     * removed before the pool is destroyed.
+     */
+    void resize(size_t const & n)
+    {
+      pthread_mutex_lock( &m_run_mutex );
+
+      while (m_threads.size() < n)
+      {
+        m_threads.push_back( pthread_t() );
+
+        pthread_create( &m_threads.back(), NULL, worker, this );
+
+        if (m_pin_threads)
+          pin( m_threads.size() - 1u );
+      }
+
+      pthread_mutex_unlock( &m_run_mutex );
+    }
+
+    /**
+     * Calls task(arguments[i]) for every i on the workers, and waits until
+     * all calls have returned. Tasks are started in order, each by the
+     * next worker to become idle, so there can be many more tasks than
+     * workers.
+     *
+     * @param workers   The pool grows to at least this many workers. By
+     *                  default it grows to one worker per task.
+     */
+    void run(
+             task_type             const & task
+             , std::vector<void *> const & arguments
+             , size_t              const & workers = 0u
+             )
+    {
+      if (arguments.empty())
+        return;
+
+      resize( workers > 0u ? workers : arguments.size() );
+
+      pthread_mutex_lock( &m_run_mutex );
+      pthread_mutex_lock( &m_mutex );
+
+      assert( m_pending == 0u || !"ThreadPool::run(): previous batch not done");
+
+      m_task      = task;
+      m_arguments = arguments;
+      m_next      = 0u;
+      m_pending   = arguments.size();
+
+      ++m_batch;
+
+      pthread_cond_broadcast( &m_work_ready );
+
+      while (m_pending > 0u)
+        pthread_cond_wait( &m_work_done, &m_mutex );
+
+      pthread_mutex_unlock( &m_mutex );
+      pthread_mutex_unlock( &m_run_mutex );
+    }
+
+  };
+
+}//end of namespace util
+
+// UTIL_THREAD_POOL_H
+#endif
@@ -3,6 +3,7 @@
 
 #include <util_is_finite.h>
 #include <util_is_number.h>
+#include <util_robust_real.h>
 
 #include <cassert>
 #include <cmath>   // needed for std::fabs
@@ -18,8 +19,9 @@ namespace util
                                                     , V const & c
                                                     )
   {
-    typedef typename V::value_type   T;
-    typedef typename V::value_traits VT;
+    typedef typename V::value_type           T;
+    typedef typename V::value_traits         VT;
+    typedef typename RobustReal<T>::type     R;
 
     assert( is_finite(a[0]) || !"signed_triangle_area(): internal error");
     assert( is_finite(a[1]) || !"signed_triangle_area(): internal error");
@@ -35,7 +37,8 @@ namespace util
     assert( is_number(c[0]) || !"signed_triangle_area(): internal error");
     assert( is_number(c[1]) || !"signed_triangle_area(): internal error");
 
-    T const result = ((b[0] - a[0]) * (c[1] - a[1]) - (c[0] - a[0]) * (b[1] - a[1])) * VT::half();
+    // The sign of the area decides if a triangle is inverted, so it is computed in RobustReal precision
+    T const result = static_cast<T>( ((R(b[0]) - R(a[0])) * (R(c[1]) - R(a[1])) - (R(c[0]) - R(a[0])) * (R(b[1]) - R(a[1]))) * VT::half() );
 
     assert( is_finite(result) || !"signed_triangle_area(): internal error");
     assert( is_number(result) || !"signed_triangle_area(): internal error");
@@ -0,0 +1,165 @@
+#ifndef UTIL_VECTOR2_H
+#define UTIL_VECTOR2_H
+
+#include <OpenTissue/core/math/math_value_traits.h>
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+
+namespace util
+{
+
+  /**
+   * Compact 2D Vector.
+   * GRIT meshes live in the plane, so a coordinate only needs an x and a
+   * y component. This vector stores exactly those two values and offers
+   * the same interface as OpenTissue::math::Vector3, so it can be used
+   * as a drop-in coordinate type. The three-argument constructor accepts
+   * and ignores a z-value, and reading the z-component is not allowed.
+   */
+  template <typename T>
+  class Vector2
+  {
+  public:
+
+    typedef OpenTissue::math::ValueTraits<T>  value_traits;   ///< Same value traits as OpenTissue vectors.
+    typedef T                                 value_type;
+    typedef std::size_t                       index_type;
+
+  protected:
+
+    T m_data[2];   ///< The x and y components.
+
+  public:
+
+    Vector2()
+    {
+      m_data[0] = value_traits::zero();
+      m_data[1] = value_traits::zero();
+    }
+
+    explicit Vector2(T const & value)
+    {
+      m_data[0] = value;
+      m_data[1] = value;
+    }
+
+    template <typename T1, typename T2>
+    Vector2(T1 const & x, T2 const & y)
+    {
+      m_data[0] = static_cast<T>(x);
+      m_data[1] = static_cast<T>(y);
+    }
+
+    template <typename T1, typename T2, typename T3>
+    Vector2(T1 const & x, T2 const & y, T3 const & /*z*/)
+    {
+      m_data[0] = static_cast<T>(x);
+      m_data[1] = static_cast<T>(y);
+    }
+
+  public:
+
+    void clear()
+    {
+      m_data[0] = value_traits::zero();
+      m_data[1] = value_traits::zero();
+    }
+
+    std::size_t size() const { return 2u; }
+
+    T       & operator[](index_type const & i)       { assert(i < 2u || !"Vector2: index out of range"); return m_data[i]; }
+    T const & operator[](index_type const & i) const { assert(i < 2u || !"Vector2: index out of range"); return m_data[i]; }
+    T       & operator()(index_type const & i)       { assert(i < 2u || !"Vector2: index out of range"); return m_data[i]; }
+    T const & operator()(index_type const & i) const { assert(i < 2u || !"Vector2: index out of range"); return m_data[i]; }
+
+  public:
+
+    bool operator==(Vector2 const & v) const { return m_data[0] == v.m_data[0] && m_data[1] == v.m_data[1]; }
+    bool operator!=(Vector2 const & v) const { return m_data[0] != v.m_data[0] || m_data[1] != v.m_data[1]; }
+
+    Vector2 & operator+=(Vector2 const & v) { m_data[0] += v.m_data[0]; m_data[1] += v.m_data[1]; return *this; }
+    Vector2 & operator-=(Vector2 const & v) { m_data[0] -= v.m_data[0]; m_data[1] -= v.m_data[1]; return *this; }
+    Vector2 & operator*=(T const & s)       { m_data[0] *= s;           m_data[1] *= s;           return *this; }
+    Vector2 & operator/=(T const & s)       { m_data[0] /= s;           m_data[1] /= s;           return *this; }
+
+    Vector2 operator+(Vector2 const & v) const { return Vector2(m_data[0] + v.m_data[0], m_data[1] + v.m_data[1]); }
+    Vector2 operator-(Vector2 const & v) const { return Vector2(m_data[0] - v.m_data[0], m_data[1] - v.m_data[1]); }
+    Vector2 operator-()                  const { return Vector2(-m_data[0], -m_data[1]);                           }
+
+    /// Inner product, as for OpenTissue vectors.
+    T operator*(Vector2 const & v) const { return m_data[0]*v.m_data[0] + m_data[1]*v.m_data[1]; }
+
+  };
+
+  template <typename T, typename T2>
+  inline Vector2<T> operator*(Vector2<T> const & v, T2 const & s) { return Vector2<T>(v[0]*s, v[1]*s); }
+
+  template <typename T2, typename T>
+  inline Vector2<T> operator*(T2 const & s, Vector2<T> const & v) { return Vector2<T>(v[0]*s, v[1]*s); }
+
+  template <typename T, typename T2>
+  inline Vector2<T> operator/(Vector2<T> const & v, T2 const & s) { return Vector2<T>(v[0]/s, v[1]/s); }
+
+  template <typename T>
+  inline T dot(Vector2<T> const & a, Vector2<T> const & b) { return a[0]*b[0] + a[1]*b[1]; }
+
+  template <typename T>
+  inline T inner_prod(Vector2<T> const & a, Vector2<T> const & b) { return dot(a, b); }
+
+  /// The z-component of the cross product of a and b seen as 3D vectors.
+  template <typename T>
+  inline T cross(Vector2<T> const & a, Vector2<T> const & b) { return a[0]*b[1] - b[0]*a[1]; }
+
+  template <typename T>
+  inline T sqr_length(Vector2<T> const & v) { return dot(v, v); }
+
+  template <typename T>
+  inline T length(Vector2<T> const & v)
+  {
+    using std::sqrt;
+
+    return sqrt( dot(v, v) );
+  }
+
+  /// The largest absolute component, named as in OpenTissue.
+  template <typename T>
+  inline T norm_1(Vector2<T> const & v)
+  {
+    using std::fabs;
+
+    return fabs(v[0]) > fabs(v[1]) ? fabs(v[0]) : fabs(v[1]);
+  }
+
+  template <typename T>
+  inline T sqr_distance(Vector2<T> const & a, Vector2<T> const & b) { return sqr_length(b - a); }
+
+  template <typename T>
+  inline Vector2<T> unit(Vector2<T> const & v)
+  {
+    typedef typename Vector2<T>::value_traits VT;
+
+    T const l = length(v);
+
+    if (l <= VT::zero())
+      return Vector2<T>( VT::zero() );
+
+    T const inv = VT::one() / l;
+
+    return Vector2<T>( inv*v[0], inv*v[1] );
+  }
+
+  template <typename T>
+  inline std::ostream & operator<<(std::ostream & o, Vector2<T> const & v)
+  {
+    o << "[" << v[0] << "," << v[1] << "]";
+
+    return o;
+  }
+
+}//end of namespace util
+
+// UTIL_VECTOR2_H
+#endif
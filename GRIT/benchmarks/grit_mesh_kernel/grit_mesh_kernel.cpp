@@ -0,0 +1,201 @@
+#include <grit.h>
+#include <util.h>
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+//
+// Benchmark of the polymesh kernels that can be used by the OpenTissueMesh.
+// The benchmark builds a regular triangulated grid of resolution x
+// resolution vertices and then mimics the access pattern of the engine:
+// local star/closure queries, collecting all simplices of the mesh, copying
+// the mesh (as done when creating and merging subdomains) and removing and
+// re-inserting triangles (as done by the mesh operations).
+//
+
+typedef OpenTissue::math::BasicMathTypes<double,size_t>  math_types;
+
+typedef OpenTissue::polymesh::PolyMesh<
+  math_types
+, OpenTissue::mesh::DefaultVertexTraits<math_types>
+, OpenTissue::mesh::DefaultHalfEdgeTraits
+, OpenTissue::mesh::DefaultEdgeTraits
+, OpenTissue::mesh::DefaultFaceTraits
+, OpenTissue::mesh::DefaultMeshTraits
+, grit::PolyMeshListKernel
+>  list_mesh_type;
+
+typedef OpenTissue::polymesh::PolyMesh<
+  math_types
+, OpenTissue::mesh::DefaultVertexTraits<math_types>
+, OpenTissue::mesh::DefaultHalfEdgeTraits
+, OpenTissue::mesh::DefaultEdgeTraits
+, OpenTissue::mesh::DefaultFaceTraits
+, OpenTissue::mesh::DefaultMeshTraits
+, grit::PolyMeshVectorKernel
+>  vector_mesh_type;
+
+typedef math_types::vector3_type  V;
+
+class Timings
+{
+public:
+
+  float m_build;
+  float m_local;
+  float m_global;
+  float m_copy;
+  float m_churn;
+
+};
+
+template<typename mesh_type>
+class Grid
+{
+public:
+
+  unsigned int                             m_resolution;
+  grit::Simplex0AttributeVector<V>         m_coords;
+  grit::OpenTissueMesh<mesh_type>          m_mesh;
+  std::vector<grit::Simplex2>              m_triangles;
+
+public:
+
+  Grid(unsigned int const & resolution)
+  : m_resolution(resolution)
+  {
+    m_mesh.m_coords = &m_coords;
+  }
+
+  unsigned int idx(unsigned int const & i, unsigned int const & j) const
+  {
+    return j*m_resolution + i;
+  }
+
+  void build()
+  {
+    for (unsigned int j = 0u; j < m_resolution; ++j)
+      for (unsigned int i = 0u; i < m_resolution; ++i)
+      {
+        grit::Simplex0 const v = m_mesh.insert();
+
+        m_coords[v] = V(i, j, 0.0);
+      }
+
+    for (unsigned int j = 0u; j + 1u < m_resolution; ++j)
+      for (unsigned int i = 0u; i + 1u < m_resolution; ++i)
+      {
+        m_triangles.push_back( m_mesh.insert( grit::Simplex0(idx(i,j)), grit::Simplex0(idx(i+1u,j)),    grit::Simplex0(idx(i+1u,j+1u)) ) );
+        m_triangles.push_back( m_mesh.insert( grit::Simplex0(idx(i,j)), grit::Simplex0(idx(i+1u,j+1u)), grit::Simplex0(idx(i,j+1u))    ) );
+      }
+
+    for (unsigned int k = 0u; k < m_triangles.size(); ++k)
+      m_mesh.set_label( m_triangles[k], k % 2u );
+  }
+
+};
+
+template<typename mesh_type>
+Timings run(unsigned int const & resolution, unsigned int const & repeats, unsigned int & checksum)
+{
+  Timings timings;
+
+  util::Timer timer;
+
+  Grid<mesh_type> grid(resolution);
+
+  timer.start();
+  grid.build();
+  timings.m_build = timer.duration();
+
+  // Star and closure of every vertex, like the mesh operation tests
+  timer.start();
+  for (unsigned int r = 0u; r < repeats; ++r)
+    for (unsigned int v = 0u; v < resolution*resolution; ++v)
+    {
+      grit::SimplexSet const S = grid.m_mesh.star( grit::Simplex0(v) );
+      grit::SimplexSet const C = grid.m_mesh.closure( S );
+
+      checksum += S.size() + C.size();
+    }
+  timings.m_local = timer.duration();
+
+  // Collecting all simplices, like the decomposition and the algorithms
+  timer.start();
+  for (unsigned int r = 0u; r < repeats; ++r)
+  {
+    checksum += grid.m_mesh.get_all_simplices().size();
+  }
+  timings.m_global = timer.duration();
+
+  // Copying the mesh, like creating and merging subdomains
+  timer.start();
+  for (unsigned int r = 0u; r < repeats; ++r)
+  {
+    grit::OpenTissueMesh<mesh_type> const copy = grid.m_mesh;
+
+    checksum += copy.get_simplices(0u).size();
+  }
+  timings.m_copy = timer.duration();
+
+  // Removing and re-inserting triangles, like the mesh operations
+  timer.start();
+  for (unsigned int r = 0u; r < repeats; ++r)
+    for (unsigned int k = 0u; k < grid.m_triangles.size(); k += 7u)
+    {
+      grit::Simplex2 const t = grid.m_triangles[k];
+
+      grid.m_mesh.remove( t );
+
+      grit::Simplex2 const u = grid.m_mesh.insert( grit::Simplex0(t.get_idx0()), grit::Simplex0(t.get_idx1()), grit::Simplex0(t.get_idx2()) );
+
+      grid.m_mesh.set_label( u, k % 2u );
+
+      checksum += grid.m_mesh.star( grit::Simplex0(u.get_idx0()) ).size();
+    }
+  timings.m_churn = timer.duration();
+
+  return timings;
+}
+
+void print_result(std::string const & name, float const & list_time, float const & vector_time)
+{
+  std::cout << std::setw(16) << std::left << name
+            << " list: "       << std::setw(8) << std::right << list_time   << " ms"
+            << "   vector: "   << std::setw(8) << std::right << vector_time << " ms"
+            << "   speedup: "  << (vector_time > 0.0f ? list_time / vector_time : 0.0f)
+            << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  unsigned int const resolution = argc > 1 ? util::to_value<unsigned int>(argv[1]) : 100u;
+  unsigned int const repeats    = argc > 2 ? util::to_value<unsigned int>(argv[2]) : 10u;
+
+  std::cout << "Mesh kernel benchmark: "
+            << resolution*resolution                     << " vertices, "
+            << 2u*(resolution - 1u)*(resolution - 1u)    << " triangles, "
+            << repeats                                   << " repeats"
+            << std::endl;
+
+  unsigned int list_checksum   = 0u;
+  unsigned int vector_checksum = 0u;
+
+  Timings const list_timings   = run<list_mesh_type>(resolution, repeats, list_checksum);
+  Timings const vector_timings = run<vector_mesh_type>(resolution, repeats, vector_checksum);
+
+  print_result("build",          list_timings.m_build,  vector_timings.m_build);
+  print_result("local queries",  list_timings.m_local,  vector_timings.m_local);
+  print_result("all simplices",  list_timings.m_global, vector_timings.m_global);
+  print_result("mesh copy",      list_timings.m_copy,   vector_timings.m_copy);
+  print_result("remove/insert",  list_timings.m_churn,  vector_timings.m_churn);
+
+  if (list_checksum != vector_checksum)
+  {
+    std::cout << "ERROR: the two kernels did not produce the same results" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,226 @@
+#include <configuration.h>
+
+#include <grit.h>
+#include <glue.h>
+#include <elasticity.h>
+#include <util.h>
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+//
+// Benchmark of the value semantics of the GRIT, GLUE and ELASTICITY
+// containers. The benchmark counts heap allocations, and compares handing
+// over a SimplexSet, a glue::Phase and an elasticity::Object by copying
+// and by moving. It also reports the allocations made by one
+// engine.update() of the vortex-in-a-box tutorial and by one adaptive
+// elasticity time step on the object phase of the same mesh.
+//
+// The benchmark must be run from the bin folder, as it reads the
+// configuration file of the vortex-in-a-box tutorial.
+//
+
+static unsigned long allocations = 0ul;
+
+void * operator new(std::size_t size)
+{
+  ++allocations;
+
+  void * p = std::malloc(size ? size : 1u);
+
+  if (!p)
+    throw std::bad_alloc();
+
+  return p;
+}
+
+void * operator new[](std::size_t size)
+{
+  ++allocations;
+
+  void * p = std::malloc(size ? size : 1u);
+
+  if (!p)
+    throw std::bad_alloc();
+
+  return p;
+}
+
+void operator delete(void * p) noexcept                { std::free(p); }
+void operator delete[](void * p) noexcept              { std::free(p); }
+void operator delete(void * p, std::size_t) noexcept   { std::free(p); }
+void operator delete[](void * p, std::size_t) noexcept { std::free(p); }
+
+grit::engine2d_type  engine;
+grit::param_type     parameters;
+util::ConfigFile     settings;
+
+void print_result(std::string const & name, unsigned long const & copy_allocations, unsigned long const & move_allocations, unsigned int const & repeats)
+{
+  std::cout << std::setw(16) << std::left << name
+            << " copy: "  << std::setw(8) << std::right << copy_allocations / repeats << " allocations"
+            << "   move: " << std::setw(8) << std::right << move_allocations / repeats << " allocations"
+            << std::endl;
+}
+
+void print_result(std::string const & name, unsigned long const & count, unsigned int const & repeats)
+{
+  std::cout << std::setw(16) << std::left << name
+            << " "  << std::setw(8) << std::right << count / repeats << " allocations per call"
+            << std::endl;
+}
+
+template<typename T, typename F>
+unsigned long count_hand_over(T const & value, unsigned int const & repeats, F const & hand_over)
+{
+  unsigned long count = 0ul;
+
+  for (unsigned int r = 0u; r < repeats; ++r)
+  {
+    T source = value;   // Not counted, in real code the source is a temporary or a local
+
+    unsigned long const before = allocations;
+
+    T const target = hand_over(source);
+
+    count += allocations - before;
+  }
+
+  return count;
+}
+
+void vortex_step(unsigned int const & label)
+{
+  glue::Phase const phase = glue::make_phase(engine, label);
+
+  std::vector<double> px;
+  std::vector<double> py;
+
+  glue::get_sub_range_current(engine, phase, px, py );
+
+  std::vector<double> px_new( px.size() );
+  std::vector<double> py_new( py.size() );
+
+  double const pi = M_PI;
+
+  for (unsigned int n = 0u; n < px.size(); ++n)
+  {
+    double const x = px[n];
+    double const y = py[n];
+
+    double const u =   2.0 * std::cos( pi * y ) * std::sin( pi * y ) * std::sin( pi*x ) * std::sin( pi*x );
+    double const v = - 2.0 * std::cos( pi * x ) * std::sin( pi * x ) * std::sin( pi*y ) * std::sin( pi*y );
+
+    px_new[n] = px[n] + u*0.01;
+    py_new[n] = py[n] + v*0.01;
+  }
+
+  glue::set_sub_range_target(engine, phase, px_new, py_new);
+}
+
+elasticity::Object make_object(unsigned int const & label)
+{
+  elasticity::Object obj = glue::make_phase(engine, label);
+
+  glue::get_sub_range_current( engine, obj, obj.m_px, obj.m_py);
+
+  obj.m_px0 = obj.m_px;
+  obj.m_py0 = obj.m_py;
+  obj.m_vx.assign( obj.m_px.size(), 0.0 );
+  obj.m_vy.assign( obj.m_py.size(), 0.0 );
+
+  obj.m_px_new = obj.m_px;
+  obj.m_py_new = obj.m_py;
+  obj.m_vx_new = obj.m_vx;
+  obj.m_vy_new = obj.m_vy;
+
+  return obj;
+}
+
+int main(int argc, char** argv)
+{
+  unsigned int const repeats = argc > 1 ? util::to_value<unsigned int>(argv[1]) : 10u;
+
+  if(!settings.load("tutorial_vortex_in_a_box.cfg"))
+  {
+    std::cout << "ERROR: could not load tutorial_vortex_in_a_box.cfg, run the benchmark from the bin folder" << std::endl;
+    return 1;
+  }
+
+  util::LogInfo::on() = false;
+
+  parameters = grit::make_parameters_from_config_file(settings);
+  parameters.verbose() = false;
+
+  std::string  const txt_filename = settings.get_value("txt_filename", "circle_enright.txt");
+  unsigned int const label        = util::to_value<unsigned int>(settings.get_value("object_label","1"));
+
+  grit::init_engine_with_mesh_file( util::get_data_file_path(txt_filename), parameters, engine);
+
+  std::cout << "Move semantics benchmark: "
+            << repeats << " repeats"
+            << std::endl;
+
+  {
+    grit::SimplexSet const all = engine.mesh().get_all_simplices();
+
+    unsigned long const copies = count_hand_over(all, repeats, [](grit::SimplexSet & source) { return grit::SimplexSet( source );            });
+    unsigned long const moves  = count_hand_over(all, repeats, [](grit::SimplexSet & source) { return grit::SimplexSet( std::move(source) ); });
+
+    print_result("SimplexSet", copies, moves, repeats);
+  }
+
+  {
+    glue::Phase const phase = glue::make_phase(engine, label);
+
+    unsigned long const copies = count_hand_over(phase, repeats, [](glue::Phase & source) { return glue::Phase( source );            });
+    unsigned long const moves  = count_hand_over(phase, repeats, [](glue::Phase & source) { return glue::Phase( std::move(source) ); });
+
+    print_result("glue::Phase", copies, moves, repeats);
+  }
+
+  {
+    elasticity::Object const obj = make_object(label);
+
+    unsigned long const copies = count_hand_over(obj, repeats, [](elasticity::Object & source) { return elasticity::Object( source );            });
+    unsigned long const moves  = count_hand_over(obj, repeats, [](elasticity::Object & source) { return elasticity::Object( std::move(source) ); });
+
+    print_result("Object", copies, moves, repeats);
+  }
+
+  {
+    elasticity::Parameters params;
+
+    params.use_dirichlet() = false;
+    params.use_traction()  = false;
+
+    elasticity::Object obj = make_object(label);
+
+    unsigned long const before = allocations;
+
+    for (unsigned int r = 0u; r < repeats; ++r)
+      elasticity::compute_adaptive_time_step(params.dt(), obj, params);
+
+    print_result("elasticity step", allocations - before, repeats);
+  }
+
+  {
+    unsigned long const before = allocations;
+
+    for (unsigned int r = 0u; r < repeats; ++r)
+    {
+      vortex_step(label);
+
+      engine.update(parameters);
+    }
+
+    print_result("engine update", allocations - before, repeats);
+  }
+
+  return 0;
+}
@@ -0,0 +1,208 @@
+#include <grit.h>
+#include <util.h>
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+//
+// Benchmark of the SimplexSet storage backends. The benchmark mimics the
+// access pattern of the mesh operations: many small star/closure/link sized
+// sets are created, merged and subtracted, and a few large sets holding the
+// whole mesh are built by range insertion and searched.
+//
+// The mesh used is a regular triangulated grid of resolution x resolution
+// vertices.
+//
+
+typedef grit::BasicSimplexSet<grit::SimplexSetTreeStorage> tree_set_type;
+typedef grit::BasicSimplexSet<grit::SimplexSetFlatStorage> flat_set_type;
+
+class Grid
+{
+public:
+
+  unsigned int                m_resolution;
+  std::vector<grit::Simplex0> m_vertices;
+  std::vector<grit::Simplex1> m_edges;
+  std::vector<grit::Simplex2> m_triangles;
+
+public:
+
+  Grid(unsigned int const & resolution)
+  : m_resolution(resolution)
+  {
+    for (unsigned int j = 0u; j < m_resolution; ++j)
+      for (unsigned int i = 0u; i < m_resolution; ++i)
+        m_vertices.push_back( grit::Simplex0(idx(i,j)) );
+
+    for (unsigned int j = 0u; j + 1u < m_resolution; ++j)
+      for (unsigned int i = 0u; i + 1u < m_resolution; ++i)
+      {
+        m_triangles.push_back( grit::Simplex2( idx(i,j), idx(i+1u,j), idx(i+1u,j+1u) ) );
+        m_triangles.push_back( grit::Simplex2( idx(i,j), idx(i+1u,j+1u), idx(i,j+1u) ) );
+
+        m_edges.push_back( grit::Simplex1( idx(i,j), idx(i+1u,j)    ) );
+        m_edges.push_back( grit::Simplex1( idx(i,j), idx(i,j+1u)    ) );
+        m_edges.push_back( grit::Simplex1( idx(i,j), idx(i+1u,j+1u) ) );
+      }
+  }
+
+  unsigned int idx(unsigned int const & i, unsigned int const & j) const
+  {
+    return j*m_resolution + i;
+  }
+
+  template<typename simplex_set_type>
+  simplex_set_type star(unsigned int const & i, unsigned int const & j) const
+  {
+    simplex_set_type A;
+
+    unsigned int const v = idx(i,j);
+
+    A.insert( grit::Simplex0(v) );
+
+    A.insert( grit::Simplex1(v, idx(i+1u,j   )) );
+    A.insert( grit::Simplex1(v, idx(i+1u,j+1u)) );
+    A.insert( grit::Simplex1(v, idx(i   ,j+1u)) );
+    A.insert( grit::Simplex1(v, idx(i-1u,j   )) );
+    A.insert( grit::Simplex1(v, idx(i-1u,j-1u)) );
+    A.insert( grit::Simplex1(v, idx(i   ,j-1u)) );
+
+    A.insert( grit::Simplex2(v, idx(i+1u,j   ), idx(i+1u,j+1u)) );
+    A.insert( grit::Simplex2(v, idx(i+1u,j+1u), idx(i   ,j+1u)) );
+    A.insert( grit::Simplex2(v, idx(i   ,j+1u), idx(i-1u,j   )) );
+    A.insert( grit::Simplex2(v, idx(i-1u,j   ), idx(i-1u,j-1u)) );
+    A.insert( grit::Simplex2(v, idx(i-1u,j-1u), idx(i   ,j-1u)) );
+    A.insert( grit::Simplex2(v, idx(i   ,j-1u), idx(i+1u,j   )) );
+
+    return A;
+  }
+
+  template<typename simplex_set_type>
+  simplex_set_type closure(simplex_set_type const & A) const
+  {
+    simplex_set_type C = A;
+
+    for (typename simplex_set_type::simplex1_const_iterator e = A.begin1(); e != A.end1(); ++e)
+    {
+      C.insert( grit::Simplex0(e->get_idx0()) );
+      C.insert( grit::Simplex0(e->get_idx1()) );
+    }
+
+    for (typename simplex_set_type::simplex2_const_iterator t = A.begin2(); t != A.end2(); ++t)
+    {
+      C.insert( grit::Simplex1(t->get_idx0(), t->get_idx1()) );
+      C.insert( grit::Simplex1(t->get_idx1(), t->get_idx2()) );
+      C.insert( grit::Simplex1(t->get_idx2(), t->get_idx0()) );
+      C.insert( grit::Simplex0(t->get_idx0()) );
+      C.insert( grit::Simplex0(t->get_idx1()) );
+      C.insert( grit::Simplex0(t->get_idx2()) );
+    }
+
+    return C;
+  }
+
+};
+
+/**
+ * Computes the link of every interior vertex of the grid, and unions the
+ * stars of neighbouring vertices. This is the typical pattern of a mesh
+ * operation test.
+ */
+template<typename simplex_set_type>
+float local_queries(Grid const & grid, unsigned int const & repeats, unsigned int & checksum)
+{
+  util::Timer timer;
+
+  timer.start();
+
+  for (unsigned int r = 0u; r < repeats; ++r)
+    for (unsigned int j = 1u; j + 1u < grid.m_resolution; ++j)
+      for (unsigned int i = 1u; i + 2u < grid.m_resolution; ++i)
+      {
+        simplex_set_type const S    = grid.template star<simplex_set_type>(i, j);
+        simplex_set_type const T    = grid.template star<simplex_set_type>(i+1u, j);
+        simplex_set_type const link = grit::difference( grid.closure(S), S );
+        simplex_set_type const both = grit::set_union(S, T);
+        simplex_set_type const edge = grit::intersection(S, T);
+
+        checksum += link.size() + both.size() + edge.size();
+      }
+
+  return timer.duration();
+}
+
+/**
+ * Builds a set holding the whole mesh by range insertion and then looks up
+ * every simplex in it, like get_all_simplices() followed by filtering.
+ */
+template<typename simplex_set_type>
+float global_queries(Grid const & grid, unsigned int const & repeats, unsigned int & checksum)
+{
+  util::Timer timer;
+
+  timer.start();
+
+  for (unsigned int r = 0u; r < repeats; ++r)
+  {
+    simplex_set_type A;
+
+    A.insert( grid.m_vertices.begin(),  grid.m_vertices.end()  );
+    A.insert( grid.m_edges.begin(),     grid.m_edges.end()     );
+    A.insert( grid.m_triangles.begin(), grid.m_triangles.end() );
+
+    for (unsigned int k = 0u; k < grid.m_triangles.size(); ++k)
+      checksum += A.contains( grid.m_triangles[k] ) ? 1u : 0u;
+
+    simplex_set_type const B = grit::filter(A, 1u);
+
+    checksum += B.size();
+  }
+
+  return timer.duration();
+}
+
+void print_result(std::string const & name, float const & tree_time, float const & flat_time)
+{
+  std::cout << std::setw(16) << std::left << name
+            << " std::set: "   << std::setw(8) << std::right << tree_time << " ms"
+            << "   flat: "     << std::setw(8) << std::right << flat_time << " ms"
+            << "   speedup: "  << (flat_time > 0.0f ? tree_time / flat_time : 0.0f)
+            << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  unsigned int const resolution = argc > 1 ? util::to_value<unsigned int>(argv[1]) : 100u;
+  unsigned int const repeats    = argc > 2 ? util::to_value<unsigned int>(argv[2]) : 10u;
+
+  Grid const grid(resolution);
+
+  std::cout << "SimplexSet benchmark: "
+            << grid.m_vertices.size()  << " vertices, "
+            << grid.m_edges.size()     << " edges, "
+            << grid.m_triangles.size() << " triangles, "
+            << repeats                 << " repeats"
+            << std::endl;
+
+  unsigned int tree_checksum = 0u;
+  unsigned int flat_checksum = 0u;
+
+  float const tree_local  = local_queries<tree_set_type>(grid, repeats, tree_checksum);
+  float const flat_local  = local_queries<flat_set_type>(grid, repeats, flat_checksum);
+
+  float const tree_global = global_queries<tree_set_type>(grid, repeats, tree_checksum);
+  float const flat_global = global_queries<flat_set_type>(grid, repeats, flat_checksum);
+
+  print_result("local queries",      tree_local,  flat_local);
+  print_result("global queries",     tree_global, flat_global);
+
+  if (tree_checksum != flat_checksum)
+  {
+    std::cout << "ERROR: the two backends did not produce the same results" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,70 @@
+#include <grit.h>
+#include <util.h>
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <stdexcept>
+
+BOOST_AUTO_TEST_SUITE(grit);
+
+BOOST_AUTO_TEST_CASE(simplex2_attribute_vector_read_write)
+{
+  grit::Simplex2AttributeVector<unsigned int> labels;
+
+  labels[grit::Simplex2(0, 1, 2)] = 1u;
+  labels[grit::Simplex2(1, 2, 3)] = 2u;
+
+  BOOST_CHECK_EQUAL( labels.size(), 2u );
+  BOOST_CHECK_EQUAL( labels[grit::Simplex2(2, 0, 1)], 1u );
+  BOOST_CHECK_EQUAL( labels.has_value(grit::Simplex2(3, 2, 1)), true  );
+  BOOST_CHECK_EQUAL( labels.has_value(grit::Simplex2(3, 2, 0)), false );
+
+  grit::Simplex2AttributeVector<unsigned int> const & const_labels = labels;
+
+  BOOST_CHECK_EQUAL( const_labels[grit::Simplex2(1, 2, 3)], 2u );
+  BOOST_CHECK_THROW( const_labels[grit::Simplex2(4, 5, 6)], std::out_of_range );
+}
+
+BOOST_AUTO_TEST_CASE(simplex1_attribute_vector_recycles_slots)
+{
+  grit::Simplex1AttributeVector<double> values;
+
+  grit::Simplex1 const a(0, 1);
+  grit::Simplex1 const b(1, 2);
+  grit::Simplex1 const c(2, 3);
+
+  values[a] = 1.0;
+  values[b] = 2.0;
+
+  values.erase(a);
+
+  BOOST_CHECK_EQUAL( values.size(), 1u );
+  BOOST_CHECK_EQUAL( values.has_value(a), false );
+
+  // The slot of a is reused by c, which must not see the value of a
+  BOOST_CHECK_EQUAL( values[c], 0.0 );
+
+  values[c] = 3.0;
+
+  BOOST_CHECK_EQUAL( values.size(), 2u );
+  BOOST_CHECK_EQUAL( values[b], 2.0 );
+  BOOST_CHECK_EQUAL( values[c], 3.0 );
+
+  // Re-inserting an erased simplex starts from a default value
+  BOOST_CHECK_EQUAL( values[a], 0.0 );
+  BOOST_CHECK_EQUAL( values.size(), 3u );
+
+  values.clear();
+
+  BOOST_CHECK_EQUAL( values.size(), 0u );
+  BOOST_CHECK_EQUAL( values.has_value(b), false );
+
+  // Re-inserting after the clear starts from a default value
+  BOOST_CHECK_EQUAL( values[b], 0.0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END();
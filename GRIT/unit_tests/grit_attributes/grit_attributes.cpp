@@ -0,0 +1,222 @@
+#include <grit.h>
+#include <util.h>
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <stdexcept>
+
+typedef grit::default_grit_types::attributes_type         attributes_type;
+typedef grit::default_grit_types::attribute_manager_type  attribute_manager_type;
+
+BOOST_AUTO_TEST_SUITE(grit);
+
+BOOST_AUTO_TEST_CASE(attribute_handles)
+{
+  attributes_type attributes;
+
+  grit::AttributeHandle const a = attributes.create_attribute( "a", 0u);
+  grit::AttributeHandle const b = attributes.create_attribute( "b", 0u);
+  grit::AttributeHandle const e = attributes.create_attribute( "e", 1u);
+
+  BOOST_CHECK( a == attributes.get_attribute_handle( "a", 0u) );
+  BOOST_CHECK( b == attributes.get_attribute_handle( "b", 0u) );
+  BOOST_CHECK( e == attributes.get_attribute_handle( "e", 1u) );
+  BOOST_CHECK( attributes.get_attribute_handle( "e", 0u).is_null() );
+  BOOST_CHECK( attributes.get_attribute_handle( "c", 0u).is_null() );
+  BOOST_CHECK( attributes.exist_attribute( b) );
+
+  grit::Simplex0 const v(3);
+
+  attribute_manager_type::add_simplex0_label( v, 1u, attributes);
+  attribute_manager_type::add_simplex0_label( v, 2u, attributes);
+
+  //--- Values written through a handle are seen by the name API and vice versa
+  attributes.set_attribute_value( a, v, 2u, 5.0);
+  attributes.set_attribute_value( "b", v, 1u, 7.0);
+
+  BOOST_CHECK_EQUAL( attributes.get_attribute_value( "a", v, 2u), 5.0 );
+  BOOST_CHECK_EQUAL( attributes.get_attribute_value( b, v, 1u), 7.0 );
+  BOOST_CHECK_THROW( attributes.get_attribute_value( a, v, 3u), std::logic_error );
+  BOOST_CHECK_THROW( attributes.get_attribute_value( "c", v, 1u), std::logic_error );
+
+  grit::Simplex1 const s(1, 2);
+
+  BOOST_CHECK_EQUAL( attributes.exist_attribute_value( e, s), false );
+
+  attributes.set_attribute_value( e, s, 2.5);
+
+  BOOST_CHECK_EQUAL( attributes.exist_attribute_value( "e", grit::Simplex1(2, 1)), true );
+  BOOST_CHECK_EQUAL( attributes.get_attribute_value( "e", s), 2.5 );
+}
+
+BOOST_AUTO_TEST_CASE(destroy_attribute)
+{
+  attributes_type attributes;
+
+  grit::AttributeHandle const a = attributes.create_attribute( "a", 0u);
+  grit::AttributeHandle const t = attributes.create_attribute( "t", 2u);
+
+  attributes.create_attribute( "b", 0u);
+  attributes.create_attribute( "e", 1u);
+  attributes.create_attribute( "u", 2u);
+
+  grit::Simplex0 const v(3);
+  grit::Simplex2 const f(1, 2, 3);
+
+  attribute_manager_type::add_simplex0_label( v, 1u, attributes);
+
+  attributes.set_attribute_value( a, v, 1u, 5.0);
+  attributes.set_attribute_value( "b", v, 1u, 7.0);
+  attributes.set_attribute_value( t, f, 2.0);
+  attributes.set_attribute_value( "u", f, 3.0);
+
+  BOOST_CHECK( attributes.destroy_attribute( "b", 0u) );
+  BOOST_CHECK( attributes.destroy_attribute( "e", 1u) );
+  BOOST_CHECK( attributes.destroy_attribute( "u", 2u) );
+  BOOST_CHECK( !attributes.destroy_attribute( "u", 2u) );
+  BOOST_CHECK( !attributes.destroy_attribute( "a", 1u) );
+
+  BOOST_CHECK( !attributes.exist_attribute( "b", 0u) );
+  BOOST_CHECK( !attributes.exist_attribute( "e", 1u) );
+  BOOST_CHECK( !attributes.exist_attribute( "u", 2u) );
+  BOOST_CHECK_EQUAL( attributes.simplex0_attribute_names().size(), 1u );
+  BOOST_CHECK_EQUAL( attributes.simplex1_attribute_names().size(), 0u );
+  BOOST_CHECK_EQUAL( attributes.simplex2_attribute_names().size(), 1u );
+
+  //--- Attributes created before the removed ones keep their handles and values
+  BOOST_CHECK_EQUAL( attributes.get_attribute_value( a, v, 1u), 5.0 );
+  BOOST_CHECK_EQUAL( attributes.get_attribute_value( t, f), 2.0 );
+
+  //--- A removed attribute can be created again, without its old values
+  grit::AttributeHandle const b = attributes.create_attribute( "b", 0u);
+
+  BOOST_CHECK_EQUAL( attributes.get_attribute_value( b, v, 1u), 0.0 );
+}
+
+BOOST_AUTO_TEST_CASE(target_values)
+{
+  typedef grit::default_grit_types::vector3_type V;
+
+  attributes_type attributes;
+
+  grit::Simplex0 const v(3);
+
+  attribute_manager_type::add_simplex0_label( v, 1u, attributes);
+
+  attributes.set_current_value( v, V(1.0, 2.0, 0.0));
+
+  //--- Without target attributes the current value is used
+  BOOST_CHECK_EQUAL( attributes.get_target_value( v, 1u)[0u], 1.0 );
+
+  //--- The target attributes are created on first use, after other attributes
+  attributes.create_attribute( "a", 0u);
+  attributes.set_target_value( v, 1u, V(3.0, 4.0, 0.0));
+  attributes.set_attribute_value( "a", v, 1u, 9.0);
+
+  BOOST_CHECK( attributes.exist_attribute( "__target_x", 0u) );
+  BOOST_CHECK_EQUAL( attributes.get_target_value( v, 1u)[0u], 3.0 );
+  BOOST_CHECK_EQUAL( attributes.get_target_value( v, 1u)[1u], 4.0 );
+  BOOST_CHECK_EQUAL( attributes.get_attribute_value( "__target_y", v, 1u), 4.0 );
+
+  //--- Copied attribute names keep the targets, in the order of the source
+  attributes_type copy;
+
+  copy.create_attribute( "__target_y", 0u);
+  copy.create_attribute( "__target_x", 0u);
+
+  attribute_manager_type::copy_attribute_names( attributes, copy);
+  attribute_manager_type::add_simplex0_label( v, 1u, copy);
+
+  copy.set_attribute_value( "__target_x", v, 1u, 5.0);
+  copy.set_attribute_value( "__target_y", v, 1u, 6.0);
+
+  BOOST_CHECK_EQUAL( copy.get_target_value( v, 1u)[0u], 5.0 );
+  BOOST_CHECK_EQUAL( copy.get_target_value( v, 1u)[1u], 6.0 );
+}
+
+BOOST_AUTO_TEST_CASE(multi_attribute_table)
+{
+  typedef grit::Simplex0MultiAttributeTable<double> table_type;
+
+  table_type table;
+
+  unsigned int const a = table.add_column();
+  unsigned int const b = table.add_column();
+
+  grit::Simplex0 const v(0);
+  grit::Simplex0 const w(1);
+
+  //--- Growing v past its initial capacity moves its slots behind those of w
+  table.add_label( v, 4u);
+  table.add_label( w, 1u);
+  table.add_label( v, 5u);
+  table.add_label( v, 6u);
+
+  BOOST_CHECK_EQUAL( table.labels(v).size(), 3u );
+  BOOST_CHECK_EQUAL( table.labels(v)[2], 6u );
+  BOOST_CHECK_EQUAL( table.labels(w).size(), 1u );
+  BOOST_CHECK( table.labels(grit::Simplex0(7)).empty() );
+  BOOST_CHECK_EQUAL( table.slot( w, 4u), table_type::no_slot() );
+
+  table.value( a, table.slot( v, 4u)) = 1.0;
+  table.value( a, table.slot( v, 5u)) = 2.0;
+  table.value( b, table.slot( v, 6u)) = 3.0;
+  table.value( a, table.slot( w, 1u)) = 9.0;
+
+  //--- Erasing keeps the order of the remaining labels and values
+  table.erase_label( v, 4u);
+
+  BOOST_CHECK_EQUAL( table.labels(v).size(), 2u );
+  BOOST_CHECK_EQUAL( table.labels(v)[0], 5u );
+  BOOST_CHECK_EQUAL( table.value( a, table.slot( v, 5u)), 2.0 );
+  BOOST_CHECK_EQUAL( table.value( b, table.slot( v, 6u)), 3.0 );
+  BOOST_CHECK_EQUAL( table.value( a, table.slot( w, 1u)), 9.0 );
+
+  //--- Clearing labels keeps the values of the slots
+  table.clear_labels(v);
+  table.add_label( v, 8u);
+
+  BOOST_CHECK_EQUAL( table.value( a, table.slot( v, 8u)), 2.0 );
+
+  table.clear(v);
+  table.add_label( v, 8u);
+
+  BOOST_CHECK_EQUAL( table.value( a, table.slot( v, 8u)), 0.0 );
+
+  //--- Relocating and releasing many vertices triggers compaction, values must survive it
+  for (unsigned int i = 2u; i < 2000u; ++i)
+  {
+    grit::Simplex0 const s(i);
+
+    table.add_label( s, 1u);
+    table.value( a, table.slot( s, 1u)) = i;
+    table.add_label( s, 2u);
+    table.add_label( s, 3u);
+    table.value( b, table.slot( s, 3u)) = -1.0*i;
+  }
+
+  std::size_t const storage = table.slot_labels().size();
+
+  for (unsigned int i = 2u; i < 2000u; i += 2u)
+    table.release( grit::Simplex0(i) );
+
+  BOOST_CHECK( table.labels(grit::Simplex0(2)).empty() );
+  BOOST_CHECK( table.slot_labels().size() < storage );
+
+  for (unsigned int i = 3u; i < 2000u; i += 2u)
+  {
+    grit::Simplex0 const s(i);
+
+    BOOST_CHECK_EQUAL( table.labels(s).size(), 3u );
+    BOOST_CHECK_EQUAL( table.value( a, table.slot( s, 1u)), 1.0*i );
+    BOOST_CHECK_EQUAL( table.value( b, table.slot( s, 3u)), -1.0*i );
+  }
+
+  BOOST_CHECK_EQUAL( table.value( a, table.slot( w, 1u)), 9.0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,159 @@
+#include <grit.h>
+#include <util.h>  // needed for util::get_data_file_path
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <vector>
+#include <algorithm>
+
+typedef grit::default_grit_types::vector3_type  V;
+typedef grit::default_grit_types::real_type     T;
+
+//
+// Describes a triangle by its corner coordinates, its label and its
+// attribute value, so triangles can be compared across renumberings.
+//
+inline std::vector<T> describe(grit::engine2d_type const & engine, grit::Simplex2 const & s, grit::AttributeHandle const & h)
+{
+  std::vector<T> corners;
+
+  grit::Simplex0 const v[3] = { s.get_simplex0_idx0(), s.get_simplex0_idx1(), s.get_simplex0_idx2() };
+
+  std::vector< std::pair<T, T> > points;
+
+  for (unsigned int i = 0u; i < 3u; ++i)
+  {
+    V const & p = engine.attributes().get_current_value( v[i] );
+
+    points.push_back( std::make_pair( p[0], p[1] ) );
+  }
+
+  std::sort( points.begin(), points.end() );
+
+  for (unsigned int i = 0u; i < 3u; ++i)
+  {
+    corners.push_back( points[i].first  );
+    corners.push_back( points[i].second );
+  }
+
+  corners.push_back( engine.mesh().label(s) );
+  corners.push_back( engine.attributes().get_attribute_value(h, s) );
+
+  return corners;
+}
+
+inline std::vector< std::vector<T> > describe_all(grit::engine2d_type const & engine, grit::AttributeHandle const & h)
+{
+  grit::SimplexSet const all = engine.mesh().get_all_simplices();
+
+  std::vector< std::vector<T> > triangles;
+
+  for (grit::SimplexSet::simplex2_const_iterator it = all.begin2(); it != all.end2(); ++it)
+    triangles.push_back( describe(engine, *it, h) );
+
+  std::sort( triangles.begin(), triangles.end() );
+
+  return triangles;
+}
+
+BOOST_AUTO_TEST_SUITE(grit);
+
+BOOST_AUTO_TEST_CASE(compact_keeps_mesh_and_attributes)
+{
+  grit::engine2d_type  engine;
+  grit::param_type     parameters;
+
+  BOOST_CHECK_NO_THROW( grit::init_engine_with_mesh_file( util::get_data_file_path("small_circles.txt"), parameters, engine) );
+
+  grit::AttributeHandle const h0 = engine.attributes().create_attribute("x_plus_label", 0u);
+  grit::AttributeHandle const h2 = engine.attributes().create_attribute("x_sum", 2u);
+
+  grit::SimplexSet const before = engine.mesh().get_all_simplices();
+
+  unsigned int vertex_labels_before = 0u;
+
+  // Give every vertex one or two phase labels
+  typedef grit::default_grit_types::attribute_manager_type  AMT;
+
+  for (grit::SimplexSet::simplex0_const_iterator it = before.begin0(); it != before.end0(); ++it)
+  {
+    AMT::add_simplex0_label(*it, 1u, engine.attributes());
+
+    if (it->get_idx0() % 2u == 0u)
+      AMT::add_simplex0_label(*it, 2u, engine.attributes());
+  }
+
+  for (grit::SimplexSet::simplex0_const_iterator it = before.begin0(); it != before.end0(); ++it)
+  {
+    V const & p = engine.attributes().get_current_value(*it);
+
+    grit::engine2d_type::AMT::label_range const labels = engine.attributes().get_simplex0_labels(*it);
+
+    vertex_labels_before += labels.size();
+
+    for (unsigned int i = 0u; i < labels.size(); ++i)
+      engine.attributes().set_attribute_value(h0, *it, labels[i], p[0] + 10.0*labels[i]);
+  }
+
+  for (grit::SimplexSet::simplex2_const_iterator it = before.begin2(); it != before.end2(); ++it)
+  {
+    T const x = engine.attributes().get_current_value( it->get_simplex0_idx0() )[0]
+              + engine.attributes().get_current_value( it->get_simplex0_idx1() )[0]
+              + engine.attributes().get_current_value( it->get_simplex0_idx2() )[0];
+
+    engine.attributes().set_attribute_value(h2, *it, x);
+  }
+
+  std::vector< std::vector<T> > const triangles_before = describe_all(engine, h2);
+
+  engine.compact();
+
+  grit::SimplexSet const after = engine.mesh().get_all_simplices();
+
+  BOOST_CHECK_EQUAL( after.size(0u), before.size(0u) );
+  BOOST_CHECK_EQUAL( after.size(1u), before.size(1u) );
+  BOOST_CHECK_EQUAL( after.size(2u), before.size(2u) );
+
+  // Vertices are numbered consecutively from zero
+  unsigned int expected = 0u;
+
+  for (grit::SimplexSet::simplex0_const_iterator it = after.begin0(); it != after.end0(); ++it, ++expected)
+    BOOST_CHECK_EQUAL( it->get_idx0(), expected );
+
+  BOOST_CHECK( engine.attributes().current().size() == after.size(0u) );
+
+  // Labels and attributes moved along with the vertices and triangles
+  unsigned int vertex_labels_after = 0u;
+
+  for (grit::SimplexSet::simplex0_const_iterator it = after.begin0(); it != after.end0(); ++it)
+  {
+    V const & p = engine.attributes().get_current_value(*it);
+
+    grit::engine2d_type::AMT::label_range const labels = engine.attributes().get_simplex0_labels(*it);
+
+    vertex_labels_after += labels.size();
+
+    for (unsigned int i = 0u; i < labels.size(); ++i)
+      BOOST_CHECK_EQUAL( engine.attributes().get_attribute_value(h0, *it, labels[i]), p[0] + 10.0*labels[i] );
+  }
+
+  BOOST_CHECK_EQUAL( vertex_labels_after, vertex_labels_before );
+  BOOST_CHECK( vertex_labels_after > 0u );
+  BOOST_CHECK( describe_all(engine, h2) == triangles_before );
+
+  BOOST_CHECK( grit::is_manifold(engine.mesh()) );
+
+  // Compacting a compact mesh changes nothing
+  std::vector<V> coordinates( engine.attributes().current().begin(), engine.attributes().current().end() );
+
+  engine.compact();
+
+  BOOST_CHECK( std::vector<V>( engine.attributes().current().begin(), engine.attributes().current().end() ) == coordinates );
+  BOOST_CHECK( describe_all(engine, h2) == triangles_before );
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,622 @@
+#include <grit.h>
+#include <util.h>  // needed for util::get_data_file_path
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iterator>  // Needed for std::back_inserter
+#include <utility>   // Needed for std::pair
+#include <cmath>
+
+typedef grit::default_grit_types                    types;
+typedef types::real_type                            T;
+typedef types::domain_manager_type                  DMT;
+
+typedef grit::details::SlabDecomposition<types>       slab_type;
+typedef grit::details::BisectionDecomposition<types>  bisection_type;
+typedef grit::details::GraphDecomposition<types>      graph_type;
+
+//
+// Splits the mesh of the engine into subdomains and merges them back
+// unchanged. Checks that every triangle went to exactly one subdomain, and
+// returns the number of submesh boundary vertices in all subdomains.
+//
+template<typename decomposition_type>
+inline unsigned int check_round_trip(
+                                     grit::engine2d_type & engine
+                                     , unsigned int const & number_of_subdomains
+                                     , T const & max_imbalance
+                                     )
+{
+  grit::param_type parameters;
+
+  parameters.verbose()              = false;
+  parameters.number_of_subdomains() = number_of_subdomains;
+
+  grit::SimplexSet const before = engine.mesh().get_all_simplices();
+
+  decomposition_type decomposition;
+
+  DMT domains = decomposition.create_subdomains( parameters, engine.mesh(), engine.attributes() );
+
+  BOOST_CHECK_EQUAL( domains.number_of_domains(), number_of_subdomains );
+
+  size_t       triangles         = 0u;
+  unsigned int boundary_vertices = 0u;
+
+  T const average = T(before.size(2u)) / number_of_subdomains;
+
+  for (unsigned int i = 0u; i < domains.number_of_domains(); ++i)
+  {
+    grit::SimplexSet const all = domains.subdomain(i).mesh().get_all_simplices();
+
+    BOOST_CHECK( all.size(2u) > 0u );
+    BOOST_CHECK( all.size(2u) <= (T(1.0) + max_imbalance) * average + T(1.0) );
+
+    triangles += all.size(2u);
+
+    for (grit::SimplexSet::simplex0_const_iterator it = all.begin0(); it != all.end0(); ++it)
+      if (domains.subdomain(i).mesh().is_submesh_boundary(*it))
+        ++boundary_vertices;
+  }
+
+  BOOST_CHECK_EQUAL( triangles, before.size(2u) );
+
+  decomposition.merge_subdomains( domains, parameters, engine.mesh(), engine.attributes() );
+
+  grit::SimplexSet const after = engine.mesh().get_all_simplices();
+
+  BOOST_CHECK_EQUAL( after.size(0u), before.size(0u) );
+  BOOST_CHECK_EQUAL( after.size(1u), before.size(1u) );
+  BOOST_CHECK_EQUAL( after.size(2u), before.size(2u) );
+
+  return boundary_vertices;
+}
+
+//
+// Gives access to the partition of a decomposition.
+//
+template<typename decomposition_type>
+class Probe
+: public decomposition_type
+{
+public:
+
+  using decomposition_type::compute_work;
+
+  //
+  // Partitions the mesh of the engine and returns the estimated work of
+  // each part.
+  //
+  std::vector<T> work_per_part(grit::engine2d_type const & engine, grit::param_type const & parameters)
+  {
+    std::vector< std::vector<grit::Simplex2> > parts;
+
+    this->partition( parameters, engine.mesh(), engine.attributes(), parts );
+
+    std::vector<T> work_per_part;
+
+    for (size_t i = 0u; i < parts.size(); ++i)
+    {
+      std::vector<T> work;
+
+      this->compute_work( parameters, engine.mesh(), parts[i], work );
+
+      T sum = T(0.0);
+
+      for (size_t j = 0u; j < work.size(); ++j)
+        sum += work[j];
+
+      work_per_part.push_back( sum );
+    }
+
+    return work_per_part;
+  }
+};
+
+template<typename decomposition_type>
+inline void check_work_balance(
+                               grit::engine2d_type const & engine
+                               , grit::param_type const & parameters
+                               , T const & max_imbalance
+                               )
+{
+  Probe<decomposition_type> probe;
+
+  // Run twice, the second run uses shifted cuts
+  for (unsigned int run = 0u; run < 2u; ++run)
+  {
+    std::vector<T> const work = probe.work_per_part( engine, parameters );
+
+    BOOST_CHECK_EQUAL( work.size(), parameters.number_of_subdomains() );
+
+    T total = T(0.0);
+
+    for (size_t i = 0u; i < work.size(); ++i)
+      total += work[i];
+
+    T const average = total / work.size();
+
+    for (size_t i = 0u; i < work.size(); ++i)
+      BOOST_CHECK( std::fabs( work[i] - average ) <= max_imbalance * average + T(1.0) + parameters.interface_work() );
+  }
+}
+
+typedef std::pair<T, T>  point_type;
+
+//
+// Splits the mesh of the engine into subdomains and merges them back
+// unchanged. Returns the positions of the submesh boundary vertices,
+// positions stay the same when the mesh is renumbered by the merge.
+//
+template<typename decomposition_type>
+inline std::vector<point_type> frozen_positions(
+                                                grit::engine2d_type & engine
+                                                , grit::param_type const & parameters
+                                                , decomposition_type & decomposition
+                                                )
+{
+  DMT domains = decomposition.create_subdomains( parameters, engine.mesh(), engine.attributes() );
+
+  std::vector<point_type> positions;
+
+  for (unsigned int i = 0u; i < domains.number_of_domains(); ++i)
+  {
+    grit::SimplexSet const all = domains.subdomain(i).mesh().get_all_simplices();
+
+    for (grit::SimplexSet::simplex0_const_iterator it = all.begin0(); it != all.end0(); ++it)
+    {
+      if (!domains.subdomain(i).mesh().is_submesh_boundary(*it))
+        continue;
+
+      types::vector3_type const & p = domains.subdomain(i).attributes().get_current_value(*it);
+
+      positions.push_back( point_type( p[0], p[1] ) );
+    }
+  }
+
+  decomposition.merge_subdomains( domains, parameters, engine.mesh(), engine.attributes() );
+
+  std::sort( positions.begin(), positions.end() );
+  positions.erase( std::unique( positions.begin(), positions.end() ), positions.end() );
+
+  return positions;
+}
+
+//
+// Checks that at most a quarter of the vertices frozen on a submesh
+// boundary stay frozen in the next call.
+//
+template<typename decomposition_type>
+inline void check_alternation(grit::engine2d_type & engine, unsigned int const & number_of_subdomains)
+{
+  grit::param_type parameters;
+
+  parameters.verbose()              = false;
+  parameters.number_of_subdomains() = number_of_subdomains;
+
+  decomposition_type decomposition;
+
+  std::vector<point_type> previous = frozen_positions( engine, parameters, decomposition );
+
+  for (unsigned int run = 0u; run < 3u; ++run)
+  {
+    std::vector<point_type> const current = frozen_positions( engine, parameters, decomposition );
+
+    std::vector<point_type> both;
+
+    std::set_intersection( previous.begin(), previous.end(), current.begin(), current.end(), std::back_inserter(both) );
+
+    BOOST_CHECK( !current.empty() );
+    BOOST_CHECK_LE( 4u * both.size(), std::min( previous.size(), current.size() ) );
+
+    previous = current;
+  }
+}
+
+//
+// Checks that each decomposition keeps its own rotation, so a new
+// decomposition starts with the same cuts as the first call of another one.
+//
+template<typename decomposition_type>
+inline void check_independent_rotation(grit::engine2d_type & engine)
+{
+  grit::param_type parameters;
+
+  parameters.verbose()              = false;
+  parameters.number_of_subdomains() = 4u;
+
+  decomposition_type first;
+
+  std::vector<point_type> const expected = frozen_positions( engine, parameters, first );
+
+  decomposition_type second;
+
+  BOOST_CHECK( frozen_positions( engine, parameters, second ) == expected );
+}
+
+//
+// Hands the vertices of the mesh of the engine to regions, and checks that
+// no triangle or edge is in two regions, that exactly the shared vertices
+// are frozen, and that release() unfreezes them.
+//
+template<typename decomposition_type>
+inline void check_regions(grit::engine2d_type & engine, unsigned int const & number_of_regions)
+{
+  typedef grit::details::MeshRegions  regions_type;
+  typedef grit::details::InRegion     in_region_type;
+
+  grit::param_type parameters;
+
+  parameters.verbose()              = false;
+  parameters.number_of_subdomains() = number_of_regions;
+
+  decomposition_type decomposition;
+  regions_type       regions;
+
+  decomposition.create_regions( parameters, engine.mesh(), engine.attributes(), regions );
+
+  grit::SimplexSet const all = engine.mesh().get_all_simplices();
+
+  unsigned int shared = 0u;
+
+  for (grit::SimplexSet::simplex0_const_iterator it = all.begin0(); it != all.end0(); ++it)
+  {
+    unsigned int const owner = regions.owner(*it);
+
+    BOOST_CHECK( owner < number_of_regions || owner == regions_type::shared );
+    BOOST_CHECK_EQUAL( engine.mesh().is_submesh_boundary(*it), owner == regions_type::shared );
+
+    if (owner == regions_type::shared)
+      ++shared;
+  }
+
+  if (number_of_regions > 1u)
+    BOOST_CHECK( shared > 0u );
+  else
+    BOOST_CHECK_EQUAL( shared, 0u );
+
+  for (grit::SimplexSet::simplex2_const_iterator it = all.begin2(); it != all.end2(); ++it)
+  {
+    unsigned int const owners[3] = {
+      regions.owner( it->get_simplex0_idx0() )
+      , regions.owner( it->get_simplex0_idx1() )
+      , regions.owner( it->get_simplex0_idx2() )
+    };
+
+    unsigned int region = regions_type::shared;
+
+    for (unsigned int k = 0u; k < 3u; ++k)
+    {
+      if (owners[k] == regions_type::shared)
+        continue;
+
+      BOOST_CHECK( region == regions_type::shared || region == owners[k] );
+
+      region = owners[k];
+    }
+
+    unsigned int inside = 0u;
+
+    for (unsigned int i = 0u; i < number_of_regions; ++i)
+      if (in_region_type( regions, i )(*it))
+        ++inside;
+
+    BOOST_CHECK_LE( inside, 1u );
+  }
+
+  for (grit::SimplexSet::simplex1_const_iterator it = all.begin1(); it != all.end1(); ++it)
+  {
+    unsigned int inside = 0u;
+
+    for (unsigned int i = 0u; i < number_of_regions; ++i)
+      if (in_region_type( regions, i )(*it))
+        ++inside;
+
+    BOOST_CHECK_LE( inside, 1u );
+  }
+
+  regions.release( engine.mesh() );
+
+  for (grit::SimplexSet::simplex0_const_iterator it = all.begin0(); it != all.end0(); ++it)
+    BOOST_CHECK( !engine.mesh().is_submesh_boundary(*it) );
+}
+
+//
+// The total area of the triangles of the mesh of the engine.
+//
+inline T total_area(grit::engine2d_type const & engine)
+{
+  grit::SimplexSet const all = engine.mesh().get_all_simplices();
+
+  T area = T(0.0);
+
+  for (grit::SimplexSet::simplex2_const_iterator it = all.begin2(); it != all.end2(); ++it)
+  {
+    types::vector3_type const & a = engine.attributes().get_current_value( it->get_simplex0_idx0() );
+    types::vector3_type const & b = engine.attributes().get_current_value( it->get_simplex0_idx1() );
+    types::vector3_type const & c = engine.attributes().get_current_value( it->get_simplex0_idx2() );
+
+    area += T(0.5) * std::fabs( (b[0]-a[0])*(c[1]-a[1]) - (c[0]-a[0])*(b[1]-a[1]) );
+  }
+
+  return area;
+}
+
+BOOST_AUTO_TEST_SUITE(grit);
+
+BOOST_AUTO_TEST_CASE(recursive_bisection_balances_weights)
+{
+  std::vector<T> x;
+  std::vector<T> y;
+  std::vector<T> weights;
+
+  for (unsigned int i = 0u; i < 40u; ++i)
+  {
+    for (unsigned int j = 0u; j < 10u; ++j)
+    {
+      x.push_back( T(i) );
+      y.push_back( T(j) );
+      weights.push_back( i < 10u ? T(3.0) : T(1.0) );
+    }
+  }
+
+  for (unsigned int inertial = 0u; inertial < 2u; ++inertial)
+  {
+    for (unsigned int number_of_parts = 1u; number_of_parts <= 7u; ++number_of_parts)
+    {
+      std::vector<unsigned int> parts;
+
+      grit::details::recursive_bisection( x, y, weights, number_of_parts, inertial == 1u, false, parts);
+
+      BOOST_CHECK_EQUAL( parts.size(), x.size() );
+
+      std::vector<T> part_weights( number_of_parts, T(0.0) );
+
+      for (size_t i = 0u; i < parts.size(); ++i)
+      {
+        BOOST_CHECK( parts[i] < number_of_parts );
+
+        part_weights[ parts[i] ] += weights[i];
+      }
+
+      // 600 in total, every cut is off by at most one point
+      for (unsigned int p = 0u; p < number_of_parts; ++p)
+        BOOST_CHECK_CLOSE( part_weights[p], T(600.0) / number_of_parts, 5.0 );
+    }
+  }
+
+  // The long side of the 40 x 10 grid is cut first
+  std::vector<unsigned int> parts;
+
+  grit::details::recursive_bisection( x, y, std::vector<T>( x.size(), T(1.0) ), 2u, false, false, parts);
+
+  for (size_t i = 0u; i < parts.size(); ++i)
+    BOOST_CHECK_EQUAL( parts[i], x[i] < T(20.0) ? 0u : 1u );
+}
+
+BOOST_AUTO_TEST_CASE(decompositions_round_trip)
+{
+  grit::engine2d_type  engine;
+  grit::param_type     parameters;
+
+  BOOST_CHECK_NO_THROW( grit::init_engine_with_mesh_file( util::get_data_file_path("small_circles.txt"), parameters, engine) );
+
+  unsigned int const number_of_subdomains[4] = { 1u, 2u, 5u, 8u };
+
+  for (unsigned int k = 0u; k < 4u; ++k)
+  {
+    // Run twice, the second run uses shifted cuts
+    for (unsigned int run = 0u; run < 2u; ++run)
+    {
+      check_round_trip<slab_type>(      engine, number_of_subdomains[k], T(0.0) );
+      check_round_trip<bisection_type>( engine, number_of_subdomains[k], T(0.0) );
+      check_round_trip<graph_type>(     engine, number_of_subdomains[k], T(0.1) );
+    }
+  }
+
+  // Compact subdomains have shorter boundaries than thin slabs
+  unsigned int const slab      = check_round_trip<slab_type>(      engine, 16u, T(0.0) );
+  unsigned int const bisection = check_round_trip<bisection_type>( engine, 16u, T(0.0) );
+  unsigned int const graph     = check_round_trip<graph_type>(     engine, 16u, T(0.1) );
+
+  BOOST_CHECK_LT( bisection, slab );
+  BOOST_CHECK_LT( graph,     slab );
+}
+
+BOOST_AUTO_TEST_CASE(decompositions_balance_work)
+{
+  grit::engine2d_type  engine;
+  grit::param_type     parameters;
+
+  BOOST_CHECK_NO_THROW( grit::init_engine_with_mesh_file( util::get_data_file_path("small_circles.txt"), parameters, engine) );
+
+  parameters.number_of_subdomains() = 6u;
+  parameters.interface_work()       = 4.0;
+
+  // Triangles at the interface count as more work
+  grit::SimplexSet const all = engine.mesh().get_all_simplices();
+
+  std::vector<T> work;
+
+  Probe<slab_type>().compute_work( parameters, engine.mesh(), std::vector<grit::Simplex2>( all.begin2(), all.end2() ), work );
+
+  BOOST_CHECK( std::count( work.begin(), work.end(), T(5.0) ) > 0u );
+  BOOST_CHECK( std::count( work.begin(), work.end(), T(1.0) ) > 0u );
+  BOOST_CHECK_EQUAL( std::count( work.begin(), work.end(), T(1.0) ) + std::count( work.begin(), work.end(), T(5.0) ), all.size(2u) );
+
+  check_work_balance<slab_type>(      engine, parameters, T(0.0) );
+  check_work_balance<bisection_type>( engine, parameters, T(0.0) );
+  check_work_balance<graph_type>(     engine, parameters, T(0.1) );
+}
+
+BOOST_AUTO_TEST_CASE(graph_partition_keeps_cut_low)
+{
+  // A grid of 60 x 30 cells, the best cut goes straight across the short
+  // side of the grid
+  std::vector<grit::Simplex2> triangles;
+  std::vector<T>              x;
+  std::vector<T>              y;
+
+  unsigned int const n = 30u;
+
+  for (unsigned int i = 0u; i < 2u*n; ++i)
+  {
+    for (unsigned int j = 0u; j < n; ++j)
+    {
+      unsigned int const a = i*(n+1u) + j;
+      unsigned int const b = a + 1u;
+      unsigned int const c = a + n + 1u;
+      unsigned int const d = c + 1u;
+
+      triangles.push_back( grit::Simplex2( grit::Simplex0(a), grit::Simplex0(b), grit::Simplex0(d) ) );
+      triangles.push_back( grit::Simplex2( grit::Simplex0(a), grit::Simplex0(d), grit::Simplex0(c) ) );
+
+      x.push_back( T(i) + T(0.7) ); y.push_back( T(j) + T(0.3) );
+      x.push_back( T(i) + T(0.3) ); y.push_back( T(j) + T(0.7) );
+    }
+  }
+
+  grit::details::FaceGraph<T> graph;
+
+  grit::details::make_face_graph( triangles, x, y, std::vector<T>( triangles.size(), T(1.0) ), graph );
+
+  BOOST_CHECK_EQUAL( graph.size(), triangles.size() );
+
+  // All edges except the 6n boundary edges are shared, and stored twice
+  BOOST_CHECK_EQUAL( graph.m_neighbours.size(), 3u*triangles.size() - 6u*n );
+
+  for (unsigned int rotated = 0u; rotated < 2u; ++rotated)
+  {
+    std::vector<unsigned int> parts;
+
+    grit::details::graph_partition( graph, 2u, rotated == 1u, parts );
+
+    unsigned int cut   = 0u;
+    unsigned int count = 0u;
+
+    for (size_t u = 0u; u < graph.size(); ++u)
+    {
+      count += parts[u];
+
+      for (unsigned int j = graph.m_offsets[u]; j < graph.m_offsets[u + 1u]; ++j)
+        if (parts[ graph.m_neighbours[j] ] != parts[u])
+          ++cut;
+    }
+
+    BOOST_CHECK_CLOSE( T(count), T(graph.size()) / T(2.0), 5.0 );
+
+    // Each cut edge is counted from both sides, a straight cut across the
+    // short side crosses n edges
+    BOOST_CHECK_LE( cut, 2u * (n + n/2u) );
+  }
+}
+
+BOOST_AUTO_TEST_CASE(decompositions_move_submesh_boundaries)
+{
+  grit::engine2d_type  engine;
+  grit::param_type     parameters;
+
+  BOOST_CHECK_NO_THROW( grit::init_engine_with_mesh_file( util::get_data_file_path("rectangle.txt"), parameters, engine) );
+
+  unsigned int const number_of_subdomains[3] = { 2u, 4u, 8u };
+
+  for (unsigned int k = 0u; k < 3u; ++k)
+  {
+    check_alternation<slab_type>(      engine, number_of_subdomains[k] );
+    check_alternation<bisection_type>( engine, number_of_subdomains[k] );
+    check_alternation<graph_type>(     engine, number_of_subdomains[k] );
+  }
+}
+
+BOOST_AUTO_TEST_CASE(decompositions_rotate_independently)
+{
+  grit::engine2d_type  engine;
+  grit::param_type     parameters;
+
+  BOOST_CHECK_NO_THROW( grit::init_engine_with_mesh_file( util::get_data_file_path("rectangle.txt"), parameters, engine) );
+
+  check_independent_rotation<bisection_type>( engine );
+}
+
+BOOST_AUTO_TEST_CASE(decompositions_create_regions)
+{
+  grit::engine2d_type  engine;
+  grit::param_type     parameters;
+
+  BOOST_CHECK_NO_THROW( grit::init_engine_with_mesh_file( util::get_data_file_path("small_circles.txt"), parameters, engine) );
+
+  unsigned int const number_of_regions[4] = { 1u, 2u, 5u, 8u };
+
+  for (unsigned int k = 0u; k < 4u; ++k)
+  {
+    check_regions<slab_type>(      engine, number_of_regions[k] );
+    check_regions<bisection_type>( engine, number_of_regions[k] );
+    check_regions<graph_type>(     engine, number_of_regions[k] );
+  }
+}
+
+BOOST_AUTO_TEST_CASE(in_place_run_keeps_mesh_valid)
+{
+  grit::engine2d_type  engine;
+  grit::param_type     parameters;
+
+  BOOST_CHECK_NO_THROW( grit::init_engine_with_mesh_file( util::get_data_file_path("small_circles.txt"), parameters, engine) );
+
+  grit::SimplexSet const before = engine.mesh().get_all_simplices();
+
+  T length = T(0.0);
+
+  for (grit::SimplexSet::simplex1_const_iterator it = before.begin1(); it != before.end1(); ++it)
+  {
+    types::vector3_type const d = engine.attributes().get_current_value( it->get_simplex0_idx1() )
+                                - engine.attributes().get_current_value( it->get_simplex0_idx0() );
+
+    length += std::sqrt( d[0]*d[0] + d[1]*d[1] );
+  }
+
+  length /= before.size(1u);
+
+  // Only refinement runs, it splits every edge longer than the average
+  std::vector<unsigned int> labels;
+
+  grit::compute_phase_labels( engine.mesh(), labels );
+
+  parameters.verbose()              = false;
+  parameters.number_of_subdomains() = 4u;
+  parameters.run_in_place()         = true;
+
+  parameters.set_max_iterations( "scheduler", 0u, 2u );
+  parameters.set_max_iterations( "algorithm", 0u, 1u );
+
+  for (size_t i = 0u; i < labels.size(); ++i)
+  {
+    parameters.set_max_iterations(  "refinement", labels[i], 1u );
+    parameters.set_lower_threshold( "refinement", labels[i], length );
+    parameters.set_upper_threshold( "refinement", labels[i], T(1e10) );
+  }
+
+  T const area = total_area( engine );
+
+  std::vector<std::string> const names = engine.attributes().simplex0_attribute_names();
+
+  engine.update( parameters );
+
+  grit::SimplexSet const after = engine.mesh().get_all_simplices();
+
+  BOOST_CHECK( grit::is_manifold( engine.mesh() ) );
+  BOOST_CHECK_GT( after.size(2u), before.size(2u) );
+  BOOST_CHECK_CLOSE( total_area( engine ), area, 1e-8 );
+  BOOST_CHECK( engine.attributes().simplex0_attribute_names() == names );
+
+  for (grit::SimplexSet::simplex0_const_iterator it = after.begin0(); it != after.end0(); ++it)
+    BOOST_CHECK( !engine.mesh().is_submesh_boundary(*it) );
+}
+
+BOOST_AUTO_TEST_SUITE_END();
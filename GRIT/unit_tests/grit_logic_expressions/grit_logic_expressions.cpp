@@ -111,6 +111,51 @@ BOOST_AUTO_TEST_CASE(logic_expression_testing)
 
 }
 
+BOOST_AUTO_TEST_CASE(concrete_mesh_expressions_match_interface_expressions)
+{
+  typedef grit::default_grit_types::mesh_impl  MI;
+
+  grit::engine2d_type        engine;
+  grit::param_type           parameters;
+  std::string           const txt_filename = util::get_data_file_path("unit_test.txt");
+
+  grit::init_engine_with_mesh_file(txt_filename,parameters,engine);
+
+  MI                  const & mesh      = engine.mesh();
+  grit::InterfaceMesh const & interface = mesh;
+
+  grit::SimplexSet const all = mesh.get_all_simplices();
+
+  for (grit::SimplexSet::simplex0_const_iterator s = all.begin0(); s != all.end0(); ++s)
+  {
+    BOOST_CHECK_EQUAL( test_func( grit::BasicIsBoundary<MI>(mesh)        , *s), test_func( grit::IsBoundary(interface)        , *s) );
+    BOOST_CHECK_EQUAL( test_func( grit::BasicIsInterface<MI>(mesh)       , *s), test_func( grit::IsInterface(interface)       , *s) );
+    BOOST_CHECK_EQUAL( test_func( grit::BasicIsSubmeshBoundary<MI>(mesh) , *s), test_func( grit::IsSubmeshBoundary(interface) , *s) );
+    BOOST_CHECK_EQUAL( test_func( grit::BasicIsManifold<MI>(mesh)        , *s), test_func( grit::IsManifold(interface)        , *s) );
+    BOOST_CHECK_EQUAL( test_func( grit::BasicIsValid<MI>(mesh)           , *s), test_func( grit::IsValid(interface)           , *s) );
+  }
+
+  for (grit::SimplexSet::simplex1_const_iterator s = all.begin1(); s != all.end1(); ++s)
+  {
+    BOOST_CHECK_EQUAL( test_func( grit::BasicIsBoundary<MI>(mesh)        , *s), test_func( grit::IsBoundary(interface)        , *s) );
+    BOOST_CHECK_EQUAL( test_func( grit::BasicIsInterface<MI>(mesh)       , *s), test_func( grit::IsInterface(interface)       , *s) );
+    BOOST_CHECK_EQUAL( test_func( grit::BasicIsSubmeshBoundary<MI>(mesh) , *s), test_func( grit::IsSubmeshBoundary(interface) , *s) );
+    BOOST_CHECK_EQUAL( test_func( grit::BasicIsManifold<MI>(mesh)        , *s), test_func( grit::IsManifold(interface)        , *s) );
+    BOOST_CHECK_EQUAL( test_func( grit::BasicIsValid<MI>(mesh)           , *s), test_func( grit::IsValid(interface)           , *s) );
+  }
+
+  for (grit::SimplexSet::simplex2_const_iterator s = all.begin2(); s != all.end2(); ++s)
+  {
+    unsigned int const label = interface.label(*s);
+
+    BOOST_CHECK_EQUAL( test_func( grit::BasicInPhase<MI>(mesh, label)    , *s), test_func( grit::InPhase(interface, label)    , *s) );
+    BOOST_CHECK_EQUAL( test_func( grit::BasicIsValid<MI>(mesh)           , *s), test_func( grit::IsValid(interface)           , *s) );
+  }
+
+  BOOST_CHECK_EQUAL( grit::compute_interface(mesh).size(1u), grit::compute_interface(interface).size(1u) );
+  BOOST_CHECK_EQUAL( grit::compute_boundary(mesh).size(1u) , grit::compute_boundary(interface).size(1u)  );
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 
 
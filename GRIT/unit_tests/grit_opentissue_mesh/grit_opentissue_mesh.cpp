@@ -0,0 +1,476 @@
+#include <grit.h>
+#include <util.h>  // needed for util::get_data_file_path
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <stdexcept>
+#include <vector>
+#include <algorithm>  // Needed for std::equal
+#include <iterator>   // Needed for std::distance
+
+typedef grit::default_grit_types::mesh_impl               MI;
+typedef grit::default_grit_types::vector3_type            V;
+typedef grit::default_grit_types::attribute_manager_type  AMT;
+
+//
+// Splits the interior edge e at its midpoint, the new triangles take
+// their labels from the triangles they replace.
+//
+inline grit::Simplex0 split_edge(grit::engine2d_type & engine, grit::param_type const & parameters, grit::Simplex1 const & e)
+{
+  MI & mesh = engine.mesh();
+
+  grit::Simplex0 const a = e.get_simplex0_idx0();
+  grit::Simplex0 const b = e.get_simplex0_idx1();
+
+  grit::SimplexSet const S = mesh.star(e);
+
+  grit::Simplex0 const m = mesh.insert();
+
+  mesh.submesh_boundary(m) = false;
+
+  util::MonotonicArena arena;
+
+  grit::Simplex2LUT parents = grit::SimplexLUTTypes<grit::Simplex2>::make(arena);
+
+  grit::SimplexSet old_simplices;
+  grit::SimplexSet new_simplices;
+
+  new_simplices.insert(m);
+
+  for (grit::SimplexSet::simplex2_const_iterator it = S.begin2(); it != S.end2(); ++it)
+  {
+    grit::SimplexSet const opposite = grit::difference( grit::filter( mesh.closure(*it), 0u ), mesh.closure(e) );
+
+    grit::Simplex0 const c = *opposite.begin0();
+
+    grit::Simplex2 const t0(a, m, c);
+    grit::Simplex2 const t1(m, b, c);
+
+    old_simplices.insert(*it);
+    new_simplices.insert(t0);
+    new_simplices.insert(t1);
+
+    parents[t0] = *it;
+    parents[t1] = *it;
+  }
+
+  AMT::insert( new_simplices, engine.attributes() );
+
+  V const & p = engine.attributes().get_current_value(a);
+  V const & q = engine.attributes().get_current_value(b);
+
+  engine.attributes().set_current_value( m, V( (p[0] + q[0])/2.0, (p[1] + q[1])/2.0, 0.0 ) );
+
+  mesh.replace( old_simplices, new_simplices, parents, parameters );
+
+  AMT::remove( old_simplices, engine.attributes() );
+
+  return m;
+}
+
+//
+// Collapses vertex b of the interior edge (a, b) into a. The triangles
+// around b that do not contain a are rebuilt around a and keep their
+// labels.
+//
+inline void collapse_edge(grit::engine2d_type & engine, grit::param_type const & parameters, grit::Simplex0 const & a, grit::Simplex0 const & b)
+{
+  MI & mesh = engine.mesh();
+
+  grit::SimplexSet const S = mesh.star(b);
+
+  util::MonotonicArena arena;
+
+  grit::Simplex2LUT parents = grit::SimplexLUTTypes<grit::Simplex2>::make(arena);
+
+  grit::SimplexSet old_simplices;
+  grit::SimplexSet new_simplices;
+
+  old_simplices.insert(b);
+
+  for (grit::SimplexSet::simplex2_const_iterator it = S.begin2(); it != S.end2(); ++it)
+  {
+    old_simplices.insert(*it);
+
+    grit::Simplex0 const v[3] = { it->get_simplex0_idx0(), it->get_simplex0_idx1(), it->get_simplex0_idx2() };
+
+    if (v[0] == a || v[1] == a || v[2] == a)
+      continue;
+
+    grit::Simplex2 const t( v[0] == b ? a : v[0], v[1] == b ? a : v[1], v[2] == b ? a : v[2] );
+
+    new_simplices.insert(t);
+
+    parents[t] = *it;
+  }
+
+  AMT::insert( new_simplices, engine.attributes() );
+
+  mesh.replace( old_simplices, new_simplices, parents, parameters );
+
+  AMT::remove( old_simplices, engine.attributes() );
+}
+
+//
+// Returns an interior edge (a, b) where b is not on the boundary, that
+// can be collapsed without changing the topology of the mesh. If
+// near_interface is true b must be on the interface.
+//
+inline grit::Simplex1 find_collapsible_edge(MI const & mesh, bool const & near_interface)
+{
+  grit::SimplexSet const all = mesh.get_all_simplices();
+
+  for (grit::SimplexSet::simplex1_const_iterator it = all.begin1(); it != all.end1(); ++it)
+  {
+    grit::Simplex0 const a = it->get_simplex0_idx0();
+    grit::Simplex0 const b = it->get_simplex0_idx1();
+
+    if (grit::filter( mesh.star(*it), 2u ).size(2u) != 2u)
+      continue;
+
+    if (mesh.is_boundary(b) || (near_interface && !mesh.is_interface(b)))
+      continue;
+
+    grit::SimplexSet const shared = grit::intersection( grit::filter( mesh.link(a), 0u ), grit::filter( mesh.link(b), 0u ) );
+
+    if (shared.size(0u) == 2u)
+      return *it;
+  }
+
+  BOOST_FAIL( "find_collapsible_edge(): no such edge" );
+
+  return grit::Simplex1();
+}
+
+inline grit::Simplex1 find_interface_edge(MI const & mesh)
+{
+  grit::SimplexSet const all = mesh.get_all_simplices();
+
+  for (grit::SimplexSet::simplex1_const_iterator it = all.begin1(); it != all.end1(); ++it)
+  {
+    if (mesh.is_interface(*it))
+      return *it;
+  }
+
+  BOOST_FAIL( "find_interface_edge(): no such edge" );
+
+  return grit::Simplex1();
+}
+
+template<typename iterator>
+inline bool is_equal(iterator first0, iterator last0, iterator first1, iterator last1)
+{
+  return std::distance(first0, last0) == std::distance(first1, last1) && std::equal(first0, last0, first1);
+}
+
+inline bool is_equal(grit::SimplexSet const & A, grit::SimplexSet const & B)
+{
+  return is_equal( A.begin0(), A.end0(), B.begin0(), B.end0() )
+      && is_equal( A.begin1(), A.end1(), B.begin1(), B.end1() )
+      && is_equal( A.begin2(), A.end2(), B.begin2(), B.end2() );
+}
+
+//
+// Compares the phases kept by the mesh with phases computed from scratch.
+//
+inline void check_phases(MI const & mesh, std::vector<unsigned int> const & labels)
+{
+  grit::SimplexSet const triangles = grit::filter( mesh.get_all_simplices(), 2u );
+
+  for (size_t i = 0u; i < labels.size(); ++i)
+  {
+    grit::SimplexSet const faces = grit::filter( triangles, grit::BasicInPhase<MI>(mesh, labels[i]) );
+    grit::SimplexSet const phase = mesh.closure( faces );
+
+    BOOST_CHECK( is_equal( mesh.get_simplices(labels[i]), faces ) );
+    BOOST_CHECK( is_equal( mesh.get_phase(labels[i])    , phase ) );
+  }
+}
+
+//
+// Classifies an edge from the labels of its triangles and the submesh
+// boundary flags of its vertices, without using anything the mesh caches.
+//
+inline void classify(MI const & mesh, grit::Simplex1 const & e, bool & interface, bool & boundary, bool & submesh_boundary)
+{
+  grit::SimplexSet const F = grit::filter( mesh.star(e), 2u );
+
+  interface        = false;
+  boundary         = false;
+  submesh_boundary = false;
+
+  if (F.size(2u) == 2u)
+  {
+    grit::SimplexSet::simplex2_const_iterator t = F.begin2();
+
+    unsigned int const label = mesh.label(*t++);
+
+    interface = mesh.label(*t) != label;
+  }
+  else
+  {
+    submesh_boundary = mesh.is_submesh_boundary(e.get_simplex0_idx0()) && mesh.is_submesh_boundary(e.get_simplex0_idx1());
+    boundary         = !submesh_boundary;
+  }
+}
+
+//
+// Compares the classification cached by the mesh with a classification
+// computed from scratch.
+//
+inline void check_classification(MI const & mesh)
+{
+  grit::SimplexSet const all = mesh.get_all_simplices();
+
+  for (grit::SimplexSet::simplex1_const_iterator e = all.begin1(); e != all.end1(); ++e)
+  {
+    bool interface, boundary, submesh_boundary;
+
+    classify(mesh, *e, interface, boundary, submesh_boundary);
+
+    BOOST_CHECK_EQUAL( mesh.is_interface(*e)       , interface        );
+    BOOST_CHECK_EQUAL( mesh.is_boundary(*e)        , boundary         );
+    BOOST_CHECK_EQUAL( mesh.is_submesh_boundary(*e), submesh_boundary );
+  }
+
+  for (grit::SimplexSet::simplex0_const_iterator v = all.begin0(); v != all.end0(); ++v)
+  {
+    grit::SimplexSet const E = grit::filter( mesh.star(*v), 1u );
+
+    bool is_interface = false;
+    bool is_boundary  = false;
+
+    for (grit::SimplexSet::simplex1_const_iterator e = E.begin1(); e != E.end1(); ++e)
+    {
+      bool interface, boundary, submesh_boundary;
+
+      classify(mesh, *e, interface, boundary, submesh_boundary);
+
+      is_interface = is_interface || interface;
+      is_boundary  = is_boundary  || boundary;
+    }
+
+    BOOST_CHECK_EQUAL( mesh.is_interface(*v), is_interface );
+    BOOST_CHECK_EQUAL( mesh.is_boundary(*v) , is_boundary  );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(grit);
+
+BOOST_AUTO_TEST_CASE(label_of_missing_face_throws)
+{
+  grit::engine2d_type  engine;
+  grit::param_type     parameters;
+
+  grit::init_engine_with_mesh_file( util::get_data_file_path("unit_test.txt"), parameters, engine);
+
+  MI       & mesh       = engine.mesh();
+  MI const & const_mesh = engine.mesh();
+
+  // The corners of the unit test mesh do not form a triangle
+  grit::Simplex2 const missing(0u, 3u, 19u);
+
+  BOOST_CHECK( !mesh.is_valid_simplex(missing) );
+
+  BOOST_CHECK_THROW( mesh.set_label(missing, 1u), std::out_of_range );
+  BOOST_CHECK_THROW( const_mesh.label(missing)  , std::out_of_range );
+}
+
+BOOST_AUTO_TEST_CASE(load_from_txt_skips_labels_of_missing_triangles)
+{
+  grit::engine2d_type  engine;
+  grit::param_type     parameters;
+
+  BOOST_CHECK_NO_THROW( grit::init_engine_with_mesh_file( util::get_data_file_path("simple_rectangle.txt"), parameters, engine) );
+
+  MI const & mesh = engine.mesh();
+
+  grit::SimplexSet const all = mesh.get_all_simplices();
+
+  BOOST_CHECK_EQUAL( all.size(2u), 24u );
+
+  // The file labels "9 15 14", which is not a triangle, instead of "9 13 14",
+  // so that triangle keeps label zero and all others have label one
+  grit::Simplex2 const unlabeled(8u, 12u, 13u);
+
+  for (grit::SimplexSet::simplex2_const_iterator it = all.begin2(); it != all.end2(); ++it)
+    BOOST_CHECK_EQUAL( mesh.label(*it), (*it == unlabeled) ? 0u : 1u );
+}
+
+BOOST_AUTO_TEST_CASE(replace_uses_ambient_label_without_parent_face)
+{
+  grit::engine2d_type  engine;
+  grit::param_type     parameters;
+
+  grit::init_engine_with_mesh_file( util::get_data_file_path("unit_test.txt"), parameters, engine);
+
+  parameters.use_ambient()   = true;
+  parameters.ambient_label() = 7u;
+
+  MI & mesh = engine.mesh();
+
+  grit::SimplexSet const all = mesh.get_all_simplices();
+
+  grit::SimplexSet::simplex2_const_iterator it = all.begin2();
+
+  grit::Simplex2 const t = *it++;
+  grit::Simplex2 const u = *it++;
+  grit::Simplex2 const v = *it++;
+
+  unsigned int const label_t = mesh.label(t);
+
+  util::MonotonicArena arena;
+
+  grit::Simplex2LUT parents = grit::SimplexLUTTypes<grit::Simplex2>::make(arena);
+
+  parents[t] = t;
+  parents[u] = grit::Simplex2(0u, 3u, 19u);   // Not a triangle of the mesh
+
+  grit::SimplexSet replaced;
+
+  replaced.insert(t);
+  replaced.insert(u);
+  replaced.insert(v);
+
+  mesh.replace(replaced, replaced, parents, parameters);
+
+  BOOST_CHECK( mesh.is_valid_simplex(t) );
+  BOOST_CHECK( mesh.is_valid_simplex(u) );
+  BOOST_CHECK( mesh.is_valid_simplex(v) );
+
+  BOOST_CHECK_EQUAL( mesh.label(t), label_t );
+  BOOST_CHECK_EQUAL( mesh.label(u), 7u );
+  BOOST_CHECK_EQUAL( mesh.label(v), 7u );
+}
+
+BOOST_AUTO_TEST_CASE(phases_follow_relabels_and_replace)
+{
+  grit::engine2d_type  engine;
+  grit::param_type     parameters;
+
+  grit::init_engine_with_mesh_file( util::get_data_file_path("unit_test.txt"), parameters, engine);
+
+  MI & mesh = engine.mesh();
+
+  std::vector<unsigned int> labels;
+
+  labels.push_back(0u);
+  labels.push_back(1u);
+  labels.push_back(2u);
+
+  check_phases(mesh, labels);
+
+  grit::SimplexSet const all = mesh.get_all_simplices();
+
+  grit::SimplexSet::simplex2_const_iterator it = all.begin2();
+
+  grit::Simplex2 const t = *it++;
+  grit::Simplex2 const u = *it++;
+
+  unsigned int const label_t = mesh.label(t);
+
+  mesh.set_label(t, 2u);
+  mesh.set_label(u, 2u);
+
+  check_phases(mesh, labels);
+
+  // Phase queries in between must not hide later changes
+  mesh.set_label(t, label_t);
+
+  check_phases(mesh, labels);
+
+  // Reading labels through a non-const mesh changes nothing
+  for (grit::SimplexSet::simplex2_const_iterator s = all.begin2(); s != all.end2(); ++s)
+    mesh.label(*s);
+
+  check_phases(mesh, labels);
+
+  split_edge(engine, parameters, find_interface_edge(mesh));
+
+  BOOST_CHECK_EQUAL( mesh.get_all_simplices().size(2u), all.size(2u) + 2u );
+
+  check_phases(mesh, labels);
+
+  grit::Simplex1 const e = find_collapsible_edge(mesh, true);
+
+  collapse_edge(engine, parameters, e.get_simplex0_idx0(), e.get_simplex0_idx1());
+
+  BOOST_CHECK_EQUAL( mesh.get_all_simplices().size(2u), all.size(2u) );
+  BOOST_CHECK( !mesh.is_valid_simplex(e.get_simplex0_idx1()) );
+
+  check_phases(mesh, labels);
+
+  BOOST_CHECK( grit::is_manifold(mesh) );
+}
+
+BOOST_AUTO_TEST_CASE(classification_follows_changes)
+{
+  grit::engine2d_type  engine;
+  grit::param_type     parameters;
+
+  grit::init_engine_with_mesh_file( util::get_data_file_path("unit_test.txt"), parameters, engine);
+
+  MI & mesh = engine.mesh();
+
+  grit::SimplexSet const all = mesh.get_all_simplices();
+
+  // Every vertex gets a submesh boundary flag, as in a subdomain
+  for (grit::SimplexSet::simplex0_const_iterator v = all.begin0(); v != all.end0(); ++v)
+    mesh.submesh_boundary(*v) = false;
+
+  check_classification(mesh);
+
+  // Relabeling a face inside phase zero makes its inner edges interface edges
+  grit::SimplexSet::simplex2_const_iterator t = all.begin2();
+
+  while (mesh.label(*t) != 0u || mesh.is_interface( grit::filter( mesh.closure(*t), 1u ) ))
+    ++t;
+
+  mesh.set_label(*t, 2u);
+
+  BOOST_CHECK( mesh.is_interface( grit::filter( mesh.closure(*t), 1u ) ) );
+
+  check_classification(mesh);
+
+  mesh.set_label(*t, 0u);
+
+  check_classification(mesh);
+
+  // A boundary edge becomes a submesh boundary edge once both its vertices are flagged
+  grit::SimplexSet::simplex1_const_iterator e = all.begin1();
+
+  while (!mesh.is_boundary(*e))
+    ++e;
+
+  mesh.submesh_boundary(e->get_simplex0_idx0()) = true;
+
+  check_classification(mesh);
+
+  mesh.submesh_boundary(e->get_simplex0_idx1()) = true;
+
+  BOOST_CHECK( mesh.is_submesh_boundary(*e) );
+  BOOST_CHECK( !mesh.is_boundary(*e) );
+
+  check_classification(mesh);
+
+  mesh.submesh_boundary(e->get_simplex0_idx0()) = false;
+
+  check_classification(mesh);
+
+  split_edge(engine, parameters, find_interface_edge(mesh));
+
+  check_classification(mesh);
+
+  grit::Simplex1 const c = find_collapsible_edge(mesh, true);
+
+  collapse_edge(engine, parameters, c.get_simplex0_idx0(), c.get_simplex0_idx1());
+
+  check_classification(mesh);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
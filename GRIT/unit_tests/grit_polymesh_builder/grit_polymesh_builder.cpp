@@ -0,0 +1,235 @@
+#include <grit.h>
+#include <util.h>
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <random>
+
+typedef OpenTissue::math::BasicMathTypes<double,size_t>  math_types;
+typedef math_types::vector3_type                          V;
+
+typedef OpenTissue::polymesh::PolyMesh<
+  math_types
+, OpenTissue::mesh::DefaultVertexTraits<math_types>
+, OpenTissue::mesh::DefaultHalfEdgeTraits
+, OpenTissue::mesh::DefaultEdgeTraits
+, OpenTissue::mesh::DefaultFaceTraits
+, OpenTissue::mesh::DefaultMeshTraits
+, grit::PolyMeshListKernel
+>  list_mesh_type;
+
+typedef OpenTissue::polymesh::PolyMesh<
+  math_types
+, OpenTissue::mesh::DefaultVertexTraits<math_types>
+, OpenTissue::mesh::DefaultHalfEdgeTraits
+, OpenTissue::mesh::DefaultEdgeTraits
+, OpenTissue::mesh::DefaultFaceTraits
+, OpenTissue::mesh::DefaultMeshTraits
+, grit::PolyMeshVectorKernel
+>  vector_mesh_type;
+
+//
+// A grid of n x n cells with two counter clockwise triangles per cell, where
+// the cells for which is_hole() is true are left out. The triangles are
+// shuffled, so the faces are not added in any particular order.
+//
+inline bool is_hole(unsigned int const & i, unsigned int const & j)
+{
+  return (i == 2u && j == 2u) || (i == 5u && (j == 4u || j == 5u)) || (i == 6u && j == 5u);
+}
+
+inline std::vector<unsigned int> make_grid_triangles(unsigned int const & n, unsigned int const & seed)
+{
+  std::vector< std::vector<unsigned int> > triangles;
+
+  for (unsigned int i = 0u; i < n; ++i)
+  {
+    for (unsigned int j = 0u; j < n; ++j)
+    {
+      if (is_hole(i, j))
+        continue;
+
+      unsigned int const a = i*(n+1u) + j;
+      unsigned int const b = a + 1u;
+      unsigned int const c = a + n + 1u;
+      unsigned int const d = c + 1u;
+
+      std::vector<unsigned int> t0(3u), t1(3u);
+
+      t0[0] = a; t0[1] = b; t0[2] = d;
+      t1[0] = a; t1[1] = d; t1[2] = c;
+
+      triangles.push_back(t0);
+      triangles.push_back(t1);
+    }
+  }
+
+  std::mt19937 generator(seed);
+
+  std::shuffle(triangles.begin(), triangles.end(), generator);
+
+  std::vector<unsigned int> corners;
+
+  for (size_t t = 0u; t < triangles.size(); ++t)
+    corners.insert(corners.end(), triangles[t].begin(), triangles[t].end());
+
+  return corners;
+}
+
+template<typename mesh_type>
+inline void add_vertices(mesh_type & mesh, unsigned int const & n)
+{
+  for (unsigned int i = 0u; i <= n; ++i)
+    for (unsigned int j = 0u; j <= n; ++j)
+      mesh.add_vertex( V(j, i, 0.0) );
+}
+
+template<typename mesh_type>
+inline void check_same_connectivity(mesh_type const & A, mesh_type const & B)
+{
+  BOOST_CHECK_EQUAL( A.size_vertices(),  B.size_vertices()  );
+  BOOST_CHECK_EQUAL( A.size_halfedges(), B.size_halfedges() );
+  BOOST_CHECK_EQUAL( A.size_edges(),     B.size_edges()     );
+  BOOST_CHECK_EQUAL( A.size_faces(),     B.size_faces()     );
+
+  typename mesh_type::const_halfedge_iterator a = A.halfedge_begin();
+  typename mesh_type::const_halfedge_iterator b = B.halfedge_begin();
+
+  for (; a != A.halfedge_end() && b != B.halfedge_end(); ++a, ++b)
+  {
+    BOOST_CHECK( a->get_handle()             == b->get_handle()             );
+    BOOST_CHECK( a->get_destination_handle() == b->get_destination_handle() );
+    BOOST_CHECK( a->get_twin_handle()        == b->get_twin_handle()        );
+    BOOST_CHECK( a->get_next_handle()        == b->get_next_handle()        );
+    BOOST_CHECK( a->get_edge_handle()        == b->get_edge_handle()        );
+    BOOST_CHECK( a->get_face_handle()        == b->get_face_handle()        );
+  }
+
+  typename mesh_type::const_face_iterator f = A.face_begin();
+  typename mesh_type::const_face_iterator g = B.face_begin();
+
+  for (; f != A.face_end() && g != B.face_end(); ++f, ++g)
+    BOOST_CHECK( f->get_border_halfedge_handle() == g->get_border_halfedge_handle() );
+
+  // A vertex may point to any of its outgoing halfedges, but on the
+  // boundary it must point to the boundary halfedge
+  typename mesh_type::const_vertex_iterator v = A.vertex_begin();
+  typename mesh_type::const_vertex_iterator w = B.vertex_begin();
+
+  for (; v != A.vertex_end() && w != B.vertex_end(); ++v, ++w)
+  {
+    typename mesh_type::const_halfedge_iterator h = A.get_halfedge_iterator( v->get_outgoing_halfedge_handle() );
+    typename mesh_type::const_halfedge_iterator k = B.get_halfedge_iterator( w->get_outgoing_halfedge_handle() );
+
+    BOOST_CHECK_EQUAL( h->get_face_handle().is_null(), k->get_face_handle().is_null() );
+
+    if (k->get_face_handle().is_null())
+      BOOST_CHECK( h->get_handle() == k->get_handle() );
+
+    BOOST_CHECK( A.get_halfedge_iterator( h->get_twin_handle() )->get_destination_handle() == v->get_handle() );
+  }
+}
+
+template<typename mesh_type>
+inline void check_builder_matches_add_face(unsigned int const & seed)
+{
+  typedef typename mesh_type::vertex_handle                   vertex_handle;
+  typedef typename mesh_type::face_handle                     face_handle;
+  typedef grit::details::PolyMeshBuilder<mesh_type>           builder_type;
+
+  unsigned int const n = 8u;
+
+  std::vector<unsigned int> const triangles = make_grid_triangles(n, seed);
+
+  mesh_type A;
+  mesh_type B;
+
+  add_vertices(A, n);
+  add_vertices(B, n);
+
+  std::vector<vertex_handle> corners;
+
+  for (size_t c = 0u; c < triangles.size(); ++c)
+    corners.push_back( vertex_handle( triangles[c] ) );
+
+  std::vector<face_handle> faces;
+
+  BOOST_CHECK( builder_type::build(A, corners, faces) );
+  BOOST_CHECK_EQUAL( faces.size(), triangles.size() / 3u );
+
+  for (size_t t = 0u; t < triangles.size() / 3u; ++t)
+  {
+    face_handle const face = B.add_face( corners[3u*t], corners[3u*t + 1u], corners[3u*t + 2u] );
+
+    BOOST_CHECK( face == faces[t] );
+  }
+
+  check_same_connectivity(A, B);
+
+  // Faces added to the built mesh connect the same way as in a mesh
+  // built face by face
+  face_handle const fa = A.add_face( vertex_handle(2u*(n+1u) + 2u), vertex_handle(2u*(n+1u) + 3u), vertex_handle(3u*(n+1u) + 3u) );
+  face_handle const fb = B.add_face( vertex_handle(2u*(n+1u) + 2u), vertex_handle(2u*(n+1u) + 3u), vertex_handle(3u*(n+1u) + 3u) );
+
+  BOOST_CHECK( !fa.is_null() );
+  BOOST_CHECK( fa == fb );
+
+  check_same_connectivity(A, B);
+}
+
+BOOST_AUTO_TEST_SUITE(grit);
+
+BOOST_AUTO_TEST_CASE(build_matches_add_face_list_kernel)
+{
+  for (unsigned int seed = 1u; seed <= 5u; ++seed)
+    check_builder_matches_add_face<list_mesh_type>(seed);
+}
+
+BOOST_AUTO_TEST_CASE(build_matches_add_face_vector_kernel)
+{
+  for (unsigned int seed = 1u; seed <= 5u; ++seed)
+    check_builder_matches_add_face<vector_mesh_type>(seed);
+}
+
+BOOST_AUTO_TEST_CASE(build_rejects_inconsistent_input)
+{
+  typedef vector_mesh_type::vertex_handle   vertex_handle;
+  typedef vector_mesh_type::face_handle     face_handle;
+  typedef grit::details::PolyMeshBuilder<vector_mesh_type>  builder_type;
+
+  vector_mesh_type mesh;
+
+  add_vertices(mesh, 1u);
+
+  std::vector<vertex_handle> corners;
+  std::vector<face_handle>   faces;
+
+  // Two triangles with opposite orientation share the directed edge 0->1
+  corners.push_back( vertex_handle(0u) ); corners.push_back( vertex_handle(1u) ); corners.push_back( vertex_handle(3u) );
+  corners.push_back( vertex_handle(0u) ); corners.push_back( vertex_handle(1u) ); corners.push_back( vertex_handle(2u) );
+
+  BOOST_CHECK( !builder_type::build(mesh, corners, faces) );
+  BOOST_CHECK_EQUAL( mesh.size_halfedges(), 0u );
+  BOOST_CHECK_EQUAL( mesh.size_faces(),     0u );
+
+  // A repeated vertex
+  corners.resize(3u);
+  corners[2] = vertex_handle(0u);
+
+  BOOST_CHECK( !builder_type::build(mesh, corners, faces) );
+
+  // A mesh with faces is never rebuilt
+  corners[2] = vertex_handle(3u);
+
+  BOOST_CHECK(  builder_type::build(mesh, corners, faces) );
+  BOOST_CHECK( !builder_type::build(mesh, corners, faces) );
+  BOOST_CHECK_EQUAL( mesh.size_faces(), 1u );
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,99 @@
+#include <grit.h>
+#include <util.h>
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <vector>
+
+typedef OpenTissue::math::BasicMathTypes<double,size_t>  math_types;
+
+typedef OpenTissue::polymesh::PolyMesh<
+  math_types
+, OpenTissue::mesh::DefaultVertexTraits<math_types>
+, OpenTissue::mesh::DefaultHalfEdgeTraits
+, OpenTissue::mesh::DefaultEdgeTraits
+, OpenTissue::mesh::DefaultFaceTraits
+, OpenTissue::mesh::DefaultMeshTraits
+, grit::PolyMeshVectorKernel
+>  mesh_type;
+
+typedef math_types::vector3_type     V;
+typedef mesh_type::vertex_handle     vertex_handle;
+typedef mesh_type::face_handle       face_handle;
+
+BOOST_AUTO_TEST_SUITE(grit);
+
+BOOST_AUTO_TEST_CASE(handles_are_never_reused)
+{
+  mesh_type mesh;
+
+  std::vector<vertex_handle> vertices;
+
+  for (unsigned int i = 0u; i < 200u; ++i)
+    vertices.push_back( mesh.add_vertex( V(i, i % 3u, 0.0) ) );
+
+  BOOST_CHECK_EQUAL( mesh.size_vertices(), 200u );
+
+  for (unsigned int i = 0u; i < 200u; i += 2u)
+    BOOST_CHECK( mesh.remove_vertex( vertices[i] ) );
+
+  BOOST_CHECK_EQUAL( mesh.size_vertices(), 100u );
+
+  // Freed records are recycled, but the new vertices get new handles
+  vertex_handle const v = mesh.add_vertex( V(1.0, 2.0, 3.0) );
+
+  BOOST_CHECK_EQUAL( v.get_idx(), 200u );
+  BOOST_CHECK( mesh.is_valid_vertex_handle( v ) );
+  BOOST_CHECK( !mesh.is_valid_vertex_handle( vertices[0] ) );
+  BOOST_CHECK( mesh.get_vertex_handle( 0u ) == mesh_type::null_vertex_handle() );
+  BOOST_CHECK( mesh.get_vertex_handle( 1u ) == vertices[1] );
+  BOOST_CHECK_EQUAL( mesh.get_vertex_iterator( v )->m_coord(2), 3.0 );
+
+  // Iteration visits every live vertex exactly once
+  unsigned int count = 0u;
+
+  for (mesh_type::vertex_iterator it = mesh.vertex_begin(); it != mesh.vertex_end(); ++it)
+  {
+    BOOST_CHECK( mesh.is_valid_vertex_handle( it->get_handle() ) );
+    ++count;
+  }
+
+  BOOST_CHECK_EQUAL( count, 101u );
+}
+
+BOOST_AUTO_TEST_CASE(copy_keeps_handles)
+{
+  mesh_type mesh;
+
+  vertex_handle const v0 = mesh.add_vertex( V(0.0, 0.0, 0.0) );
+  vertex_handle const v1 = mesh.add_vertex( V(1.0, 0.0, 0.0) );
+  vertex_handle const v2 = mesh.add_vertex( V(1.0, 1.0, 0.0) );
+  vertex_handle const v3 = mesh.add_vertex( V(0.0, 1.0, 0.0) );
+
+  face_handle const f0 = mesh.add_face( v0, v1, v2 );
+  face_handle const f1 = mesh.add_face( v0, v2, v3 );
+
+  mesh.remove_face( f0 );
+
+  mesh_type const copy = mesh;
+
+  BOOST_CHECK_EQUAL( copy.size_vertices(), mesh.size_vertices() );
+  BOOST_CHECK_EQUAL( copy.size_edges(),    mesh.size_edges()    );
+  BOOST_CHECK_EQUAL( copy.size_faces(),    1u                   );
+
+  BOOST_CHECK( !copy.is_valid_face_handle( f0 ) );
+  BOOST_CHECK(  copy.is_valid_face_handle( f1 ) );
+
+  // The features of the copy must belong to the copy
+  mesh_type::const_face_iterator f = copy.get_face_iterator( f1 );
+
+  BOOST_CHECK( f->get_handle() == f1 );
+  BOOST_CHECK( f->get_owner() == &copy );
+  BOOST_CHECK_EQUAL( valency( *f ), 3u );
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,107 @@
+#include <grit.h>
+#include <util.h>
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <functional>
+#include <limits>
+
+BOOST_AUTO_TEST_SUITE(grit);
+
+BOOST_AUTO_TEST_CASE(simplex1_keeps_original_order)
+{
+  grit::Simplex1 const a(7, 3);
+  grit::Simplex1 const b(3, 7);
+
+  BOOST_CHECK_EQUAL( a.get_idx0(), 7u );
+  BOOST_CHECK_EQUAL( a.get_idx1(), 3u );
+  BOOST_CHECK_EQUAL( a.get_key0(), 3u );
+  BOOST_CHECK_EQUAL( a.get_key1(), 7u );
+
+  BOOST_CHECK( a == b );
+  BOOST_CHECK( !(a < b) && !(b < a) );
+  BOOST_CHECK( grit::Simplex1(3, 6) < a );
+  BOOST_CHECK( grit::Simplex1(8, 2) < a );
+
+  grit::Simplex1 c = a;
+  c.reverse();
+
+  BOOST_CHECK_EQUAL( c.get_idx0(), 3u );
+  BOOST_CHECK_EQUAL( c.get_idx1(), 7u );
+  BOOST_CHECK_EQUAL( a.get_reversed().get_idx0(), 3u );
+  BOOST_CHECK_EQUAL( a.get_local_index(grit::Simplex0(3)), 1u );
+
+  BOOST_CHECK( grit::Simplex1().is_null() );
+}
+
+BOOST_AUTO_TEST_CASE(simplex2_keeps_original_winding)
+{
+  unsigned int const permutations[6][3] = {
+    {1, 5, 9}, {1, 9, 5}, {5, 1, 9}, {5, 9, 1}, {9, 1, 5}, {9, 5, 1}
+  };
+
+  std::hash<grit::Simplex2> const h;
+
+  grit::Simplex2 const reference(1, 5, 9);
+
+  for (unsigned int i = 0u; i < 6u; ++i)
+  {
+    grit::Simplex2 const s(permutations[i][0], permutations[i][1], permutations[i][2]);
+
+    BOOST_CHECK_EQUAL( s.get_idx0(), permutations[i][0] );
+    BOOST_CHECK_EQUAL( s.get_idx1(), permutations[i][1] );
+    BOOST_CHECK_EQUAL( s.get_idx2(), permutations[i][2] );
+
+    BOOST_CHECK_EQUAL( s.get_key0(), 1u );
+    BOOST_CHECK_EQUAL( s.get_key1(), 5u );
+    BOOST_CHECK_EQUAL( s.get_key2(), 9u );
+
+    BOOST_CHECK( s == reference );
+    BOOST_CHECK_EQUAL( h(s), h(reference) );
+  }
+
+  BOOST_CHECK( grit::Simplex2(1, 5, 8) < reference );
+  BOOST_CHECK( reference > grit::Simplex2(9, 0, 5) );
+
+  // Repeated indices must still map to a valid permutation
+  grit::Simplex2 const degenerate(4, 2, 4);
+
+  BOOST_CHECK_EQUAL( degenerate.get_idx0(), 4u );
+  BOOST_CHECK_EQUAL( degenerate.get_idx1(), 2u );
+  BOOST_CHECK_EQUAL( degenerate.get_idx2(), 4u );
+
+  BOOST_CHECK( grit::Simplex2().is_null() );
+}
+
+BOOST_AUTO_TEST_CASE(simplex_index_width)
+{
+  typedef grit::Simplex::index_type index_type;
+
+#ifdef GRIT_USE_64BIT_SIMPLEX_INDEX
+  BOOST_CHECK_EQUAL( sizeof(index_type), 8u );
+#else
+  BOOST_CHECK_EQUAL( sizeof(index_type), 4u );
+#endif
+
+  // The simplices must not carry more than their indices and the winding
+  BOOST_CHECK_EQUAL( sizeof(grit::Simplex0), sizeof(index_type) );
+  BOOST_CHECK( sizeof(grit::Simplex1) <= 3u*sizeof(index_type) );
+  BOOST_CHECK( sizeof(grit::Simplex2) <= 4u*sizeof(index_type) );
+
+  // The largest index is reserved for unset simplices
+  index_type const largest = std::numeric_limits<index_type>::max() - 1u;
+
+  grit::Simplex2 const s(largest, 0u, largest - 1u);
+
+  BOOST_CHECK_EQUAL( s.get_idx0(), largest );
+  BOOST_CHECK_EQUAL( s.get_key0(), 0u );
+  BOOST_CHECK_EQUAL( s.get_key2(), largest );
+  BOOST_CHECK( !s.is_null() );
+  BOOST_CHECK( !grit::Simplex0(largest).is_null() );
+}
+
+BOOST_AUTO_TEST_SUITE_END();
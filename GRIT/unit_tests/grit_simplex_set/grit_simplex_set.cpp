@@ -0,0 +1,142 @@
+#include <grit.h>
+#include <util.h>
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <vector>
+#include <cstdlib>
+
+typedef grit::BasicSimplexSet<grit::SimplexSetTreeStorage> tree_set_type;
+typedef grit::BasicSimplexSet<grit::SimplexSetFlatStorage> flat_set_type;
+
+template<typename iterator0, typename iterator1>
+bool same_range(iterator0 a, iterator0 const & a_end, iterator1 b, iterator1 const & b_end)
+{
+  for (; a != a_end && b != b_end; ++a, ++b)
+  {
+    if (*a < *b || *b < *a)
+      return false;
+  }
+  return a == a_end && b == b_end;
+}
+
+bool same_sets(tree_set_type const & A, flat_set_type const & B)
+{
+  return same_range(A.begin0(), A.end0(), B.begin0(), B.end0())
+      && same_range(A.begin1(), A.end1(), B.begin1(), B.end1())
+      && same_range(A.begin2(), A.end2(), B.begin2(), B.end2());
+}
+
+/**
+ * Fills a tree and a flat simplex set with the same randomly
+ * generated simplices, inserted one at a time in random order.
+ */
+void make_random_sets(unsigned int const & count, unsigned int const & max_idx, tree_set_type & A, flat_set_type & B)
+{
+  for (unsigned int i = 0u; i < count; ++i)
+  {
+    unsigned int const i0 = std::rand() % max_idx;
+    unsigned int const i1 = std::rand() % max_idx;
+    unsigned int const i2 = std::rand() % max_idx;
+
+    A.insert(grit::Simplex0(i0));
+    B.insert(grit::Simplex0(i0));
+
+    if (i0 != i1)
+    {
+      A.insert(grit::Simplex1(i0, i1));
+      B.insert(grit::Simplex1(i0, i1));
+    }
+
+    if (i0 != i1 && i1 != i2 && i0 != i2)
+    {
+      A.insert(grit::Simplex2(i0, i1, i2));
+      B.insert(grit::Simplex2(i0, i1, i2));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(grit);
+
+BOOST_AUTO_TEST_CASE(flat_set_insert_and_remove)
+{
+  flat_set_type A;
+
+  A.insert(grit::Simplex0(5));
+  A.insert(grit::Simplex0(1));
+  A.insert(grit::Simplex0(3));
+  A.insert(grit::Simplex0(3));
+
+  BOOST_CHECK_EQUAL( A.size(0), 3u );
+  BOOST_CHECK_EQUAL( A.begin0()->get_idx0(), 1u );
+  BOOST_CHECK_EQUAL( A.contains(grit::Simplex0(3)), true  );
+  BOOST_CHECK_EQUAL( A.contains(grit::Simplex0(4)), false );
+
+  BOOST_CHECK_EQUAL( A.remove(grit::Simplex0(3)), true  );
+  BOOST_CHECK_EQUAL( A.remove(grit::Simplex0(3)), false );
+  BOOST_CHECK_EQUAL( A.size(0), 2u );
+
+  // Simplices with different vertex order are the same simplex
+  A.insert(grit::Simplex1(2, 7));
+  A.insert(grit::Simplex1(7, 2));
+  A.insert(grit::Simplex2(1, 2, 3));
+  A.insert(grit::Simplex2(3, 2, 1));
+
+  BOOST_CHECK_EQUAL( A.size(1), 1u );
+  BOOST_CHECK_EQUAL( A.size(2), 1u );
+  BOOST_CHECK_EQUAL( A.contains(grit::Simplex2(2, 3, 1)), true );
+}
+
+BOOST_AUTO_TEST_CASE(flat_set_grows_beyond_inline_storage)
+{
+  flat_set_type A;
+
+  for (unsigned int i = 0u; i < 1000u; ++i)
+    A.insert(grit::Simplex0((i * 7919u) % 1000u));
+
+  BOOST_CHECK_EQUAL( A.size(0), 1000u );
+
+  unsigned int expected = 0u;
+  for (flat_set_type::simplex0_const_iterator s = A.begin0(); s != A.end0(); ++s, ++expected)
+    BOOST_CHECK_EQUAL( s->get_idx0(), expected );
+}
+
+BOOST_AUTO_TEST_CASE(flat_and_tree_backends_agree)
+{
+  std::srand(42);
+
+  for (unsigned int trial = 0u; trial < 20u; ++trial)
+  {
+    tree_set_type A_tree, B_tree;
+    flat_set_type A_flat, B_flat;
+
+    make_random_sets(50u + trial * 10u, 40u, A_tree, A_flat);
+    make_random_sets(50u + trial * 10u, 40u, B_tree, B_flat);
+
+    BOOST_CHECK( same_sets(A_tree, A_flat) );
+    BOOST_CHECK( same_sets(B_tree, B_flat) );
+
+    BOOST_CHECK( same_sets( grit::set_union(A_tree, B_tree)   , grit::set_union(A_flat, B_flat)    ) );
+    BOOST_CHECK( same_sets( grit::difference(A_tree, B_tree)  , grit::difference(A_flat, B_flat)   ) );
+    BOOST_CHECK( same_sets( grit::intersection(A_tree, B_tree), grit::intersection(A_flat, B_flat) ) );
+    BOOST_CHECK( same_sets( grit::filter(A_tree, 1u)          , grit::filter(A_flat, 1u)           ) );
+
+    std::vector<grit::Simplex2> S2(B_tree.begin2(), B_tree.end2());
+
+    A_tree.insert(S2.begin(), S2.end());
+    A_flat.insert(S2.begin(), S2.end());
+
+    BOOST_CHECK( same_sets(A_tree, A_flat) );
+
+    A_tree.insert(B_tree);
+    A_flat.insert(B_flat);
+
+    BOOST_CHECK( same_sets(A_tree, A_flat) );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,146 @@
+#include <grit.h>
+#include <util.h>
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <cmath>
+
+typedef util::Vector2<double>  V;
+
+//
+// Stand-in for the attribute manager, only current coordinates are needed.
+//
+class Coordinates
+{
+public:
+
+  std::vector<V> m_current;
+
+  V const & get_current_value(grit::Simplex0 const & s) const
+  {
+    return m_current[s.get_idx0()];
+  }
+};
+
+inline Coordinates make_random_coordinates(unsigned int const & n, double const & size, unsigned int const & seed)
+{
+  std::mt19937                           generator(seed);
+  std::uniform_real_distribution<double> uniform(-size, size);
+
+  Coordinates coordinates;
+
+  for (unsigned int i = 0u; i < n; ++i)
+    coordinates.m_current.push_back( V( uniform(generator), uniform(generator) ) );
+
+  return coordinates;
+}
+
+inline grit::SimplexSet make_vertices(unsigned int const & n)
+{
+  grit::SimplexSet S;
+
+  for (unsigned int i = 0u; i < n; ++i)
+    S.insert( grit::Simplex0(i) );
+
+  return S;
+}
+
+inline bool is_close(V const & a, V const & b, double const & radius)
+{
+  return std::fabs(a[0] - b[0]) < radius && std::fabs(a[1] - b[1]) < radius;
+}
+
+BOOST_AUTO_TEST_SUITE(grit);
+
+BOOST_AUTO_TEST_CASE(query_matches_brute_force)
+{
+  unsigned int const n           = 2000u;
+  Coordinates  const coordinates = make_random_coordinates(n, 10.0, 7u);
+
+  double const radii[3] = { 0.05, 0.3, 1.7 };
+
+  for (unsigned int r = 0u; r < 3u; ++r)
+  {
+    grit::SpatialHash<V> grid(0.3);
+
+    grid.insert( make_vertices(n), coordinates );
+
+    BOOST_CHECK_EQUAL( grid.size(), n );
+
+    for (unsigned int i = 0u; i < n; i += 13u)
+    {
+      V const & p = coordinates.m_current[i];
+
+      std::vector<grit::Simplex0> result;
+
+      grid.query(p, radii[r], result);
+
+      std::vector<unsigned int> found;
+
+      for (size_t k = 0u; k < result.size(); ++k)
+        found.push_back( result[k].get_idx0() );
+
+      std::sort(found.begin(), found.end());
+
+      std::vector<unsigned int> expected;
+
+      for (unsigned int j = 0u; j < n; ++j)
+        if (is_close(p, coordinates.m_current[j], radii[r]))
+          expected.push_back(j);
+
+      BOOST_CHECK( found == expected );
+      BOOST_CHECK_EQUAL( grid.has_within(p, radii[r]), true );
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(negative_coordinates_and_cell_borders)
+{
+  grit::SpatialHash<V> grid(1.0);
+
+  grid.insert( grit::Simplex0(0u), V( -1.0,  0.0) );
+  grid.insert( grit::Simplex0(1u), V(  0.0,  0.0) );
+  grid.insert( grit::Simplex0(2u), V( -0.5, -2.0) );
+
+  BOOST_CHECK_EQUAL( grid.has_within( V(-0.999,  0.0 ), 0.01 ), true  );
+  BOOST_CHECK_EQUAL( grid.has_within( V(-0.5,    0.0 ), 0.5  ), false );
+  BOOST_CHECK_EQUAL( grid.has_within( V(-0.5,    0.0 ), 0.51 ), true  );
+  BOOST_CHECK_EQUAL( grid.has_within( V(-0.5,   -1.01), 1.0  ), true  );
+  BOOST_CHECK_EQUAL( grid.has_within( V( 5.0,    5.0 ), 1.0  ), false );
+
+  grid.clear();
+
+  BOOST_CHECK_EQUAL( grid.size(), 0u );
+  BOOST_CHECK_EQUAL( grid.has_within( V(-1.0, 0.0), 0.01 ), false );
+}
+
+BOOST_AUTO_TEST_CASE(has_multiple_vertices_matches_brute_force)
+{
+  unsigned int const n           = 3000u;
+  Coordinates        coordinates = make_random_coordinates(n, 100.0, 11u);
+  grit::SimplexSet   const S     = make_vertices(n);
+
+  double const threshold = 1e-3;
+
+  bool expected = false;
+
+  for (unsigned int i = 0u; i < n && !expected; ++i)
+    for (unsigned int j = i + 1u; j < n && !expected; ++j)
+      expected = is_close(coordinates.m_current[i], coordinates.m_current[j], threshold);
+
+  BOOST_CHECK_EQUAL( grit::details::has_multiple_vertices<V>(S, coordinates, threshold), expected );
+
+  coordinates.m_current[n - 1u] = coordinates.m_current[0u] + V(0.5*threshold, -0.5*threshold);
+
+  BOOST_CHECK_EQUAL( grit::details::has_multiple_vertices<V>(S, coordinates, threshold), true  );
+  BOOST_CHECK_EQUAL( grit::details::has_multiple_vertices<V>(S, coordinates, 0.0),       false );
+}
+
+BOOST_AUTO_TEST_SUITE_END();
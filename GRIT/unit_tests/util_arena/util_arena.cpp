@@ -0,0 +1,84 @@
+#include <util_arena.h>
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <map>
+#include <functional>
+#include <utility>
+
+BOOST_AUTO_TEST_SUITE(arena);
+
+typedef util::ArenaAllocator< std::pair<int const, int> >              allocator_type;
+typedef std::map<int, int, std::less<int>, allocator_type>            map_type;
+
+BOOST_AUTO_TEST_CASE(reset_reuses_memory)
+{
+  util::MonotonicArena arena(256u);
+
+  void * first = arena.allocate(24u);
+  void * second = arena.allocate(24u);
+
+  BOOST_CHECK( first != second );
+
+  // Allocations larger than a block get their own block
+  void * large = arena.allocate(1000u);
+
+  BOOST_CHECK( large != 0 );
+
+  std::size_t const capacity = arena.capacity();
+
+  BOOST_CHECK( capacity >= 256u + 1000u );
+
+  arena.reset();
+
+  BOOST_CHECK_EQUAL( arena.allocate(24u), first );
+
+  arena.allocate(24u);
+  arena.allocate(1000u);
+
+  BOOST_CHECK_EQUAL( arena.capacity(), capacity );
+}
+
+BOOST_AUTO_TEST_CASE(map_with_arena)
+{
+  util::MonotonicArena arena(128u);
+
+  for (int r = 0; r < 3; ++r)
+  {
+    arena.reset();
+
+    std::less<int> const less;
+
+    map_type lut( less, allocator_type(&arena) );
+
+    for (int i = 0; i < 100; ++i)
+      lut[i] = 2*i;
+
+    BOOST_CHECK_EQUAL( lut.size(), 100u );
+    BOOST_CHECK_EQUAL( lut[42], 84 );
+
+    map_type copy = lut;
+
+    BOOST_CHECK( copy.get_allocator() == lut.get_allocator() );
+    BOOST_CHECK_EQUAL( copy[99], 198 );
+  }
+}
+
+BOOST_AUTO_TEST_CASE(map_without_arena)
+{
+  map_type lut;
+
+  for (int i = 0; i < 10; ++i)
+    lut[i] = i;
+
+  lut.erase(5);
+
+  BOOST_CHECK_EQUAL( lut.size(), 9u );
+  BOOST_CHECK( lut.get_allocator().m_arena == 0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END();
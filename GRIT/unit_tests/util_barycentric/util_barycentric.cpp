@@ -1,8 +1,11 @@
 #include <OpenTissue/core/math/math_vector3.h>
 
 #include <util_barycentric.h>
+#include <util_vector2.h>
 #include <util_barycentric_inside.h>
 
+#include <utility>   // needed for std::swap
+
 #define BOOST_AUTO_TEST_MAIN
 #include <boost/test/auto_unit_test.hpp>
 #include <boost/test/unit_test_suite.hpp>
@@ -11,6 +14,7 @@
 
 typedef double                       T;
 typedef OpenTissue::math::Vector3<T> V;
+typedef util::Vector2<T>             V2;
 
 
 BOOST_AUTO_TEST_SUITE(barycentric);
@@ -142,4 +146,60 @@ BOOST_AUTO_TEST_CASE(tetrahedron_outside)
 
 
 
+BOOST_AUTO_TEST_CASE(line_vector2_matches_vector3)
+{
+  V  x1 = V( 0.1, 0.3, 0.0);
+  V  x2 = V( 1.7, 0.9, 0.0);
+  V  p  = V( 0.6, 0.2, 0.0);
+
+  T w1 = 0.0;
+  T w2 = 0.0;
+
+  util::barycentric(x1, x2, p, w1, w2);
+
+  T u1 = 0.0;
+  T u2 = 0.0;
+
+  util::barycentric( V2(x1[0], x1[1]), V2(x2[0], x2[1]), V2(p[0], p[1]), u1, u2);
+
+  BOOST_CHECK_EQUAL(w1, u1);
+  BOOST_CHECK_EQUAL(w2, u2);
+}
+
+
+BOOST_AUTO_TEST_CASE(triangle_vector2_matches_vector3)
+{
+  V x1 = V( 0.1, 0.3, 0.0);
+  V x2 = V( 1.7, 0.9, 0.0);
+  V x3 = V( 0.4, 1.3, 0.0);
+
+  // Test points inside and outside, and with both orientations of the triangle
+  for (unsigned int i = 0u; i < 2u; ++i)
+  {
+    for (unsigned int j = 0u; j < 3u; ++j)
+    {
+      V const p = V( 0.7*j - 0.3, 0.6, 0.0);
+
+      T w1 = 0.0;
+      T w2 = 0.0;
+      T w3 = 0.0;
+
+      util::barycentric(x1, x2, x3, p, w1, w2, w3);
+
+      T u1 = 0.0;
+      T u2 = 0.0;
+      T u3 = 0.0;
+
+      util::barycentric( V2(x1[0], x1[1]), V2(x2[0], x2[1]), V2(x3[0], x3[1]), V2(p[0], p[1]), u1, u2, u3);
+
+      BOOST_CHECK_EQUAL(w1, u1);
+      BOOST_CHECK_EQUAL(w2, u2);
+      BOOST_CHECK_EQUAL(w3, u3);
+    }
+
+    std::swap(x2, x3);
+  }
+}
+
+
 BOOST_AUTO_TEST_SUITE_END();
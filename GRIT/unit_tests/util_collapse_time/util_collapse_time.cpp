@@ -1,6 +1,7 @@
 #include <OpenTissue/core/math/math_vector3.h>
 
 #include <util_collapse_time.h>
+#include <util_vector2.h>
 
 #define BOOST_AUTO_TEST_MAIN
 #include <boost/test/auto_unit_test.hpp>
@@ -141,4 +142,28 @@ BOOST_AUTO_TEST_CASE(tetrahedron_outside)
 */
 
 
+BOOST_AUTO_TEST_CASE(single_precision_is_computed_in_double)
+{
+  typedef util::Vector2<float>  VF;
+  typedef util::Vector2<double> VD;
+
+  // A thin triangle moving so that it almost keeps its area. With float
+  // input the result must be the double precision result rounded once.
+  float const x[6] = { 0.0f, 0.0f, 1.0f, 1.0e-4f, 0.5f, 2.0e-4f };
+  float const u[6] = { 0.0f, 0.0f, 1.0e-3f, -1.0e-4f, 5.0e-4f, -1.0e-4f };
+
+  float const tf = util::collapse_time(
+                                       VF(x[0], x[1]), VF(x[2], x[3]), VF(x[4], x[5])
+                                       , VF(u[0], u[1]), VF(u[2], u[3]), VF(u[4], u[5])
+                                       );
+
+  double const td = util::collapse_time(
+                                        VD(x[0], x[1]), VD(x[2], x[3]), VD(x[4], x[5])
+                                        , VD(u[0], u[1]), VD(u[2], u[3]), VD(u[4], u[5])
+                                        );
+
+  BOOST_CHECK_EQUAL(tf, static_cast<float>(td));
+}
+
+
 BOOST_AUTO_TEST_SUITE_END();
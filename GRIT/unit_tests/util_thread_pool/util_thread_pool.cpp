@@ -0,0 +1,157 @@
+#include <util_thread_pool.h>
+
+#define BOOST_AUTO_TEST_MAIN
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(thread_pool);
+
+//
+// A task that records the thread it ran on and how often it ran.
+//
+class Task
+{
+public:
+
+  unsigned int  m_calls;
+  pthread_t     m_thread;
+
+  Task()
+  : m_calls(0u)
+  {}
+};
+
+inline void * run_task(void * argument)
+{
+  Task * task = static_cast<Task *>(argument);
+
+  task->m_calls  += 1u;
+  task->m_thread  = pthread_self();
+
+  return 0;
+}
+
+inline std::vector<void *> make_arguments(std::vector<Task> & tasks)
+{
+  std::vector<void *> arguments;
+
+  for (size_t i = 0u; i < tasks.size(); ++i)
+    arguments.push_back( &tasks[i] );
+
+  return arguments;
+}
+
+BOOST_AUTO_TEST_CASE(every_task_runs_once_per_batch)
+{
+  util::ThreadPool pool;
+
+  BOOST_CHECK_EQUAL( pool.size(), 0u );
+
+  std::vector<Task> tasks(8u);
+
+  for (unsigned int batch = 1u; batch <= 50u; ++batch)
+  {
+    pool.run( run_task, make_arguments(tasks) );
+
+    for (size_t i = 0u; i < tasks.size(); ++i)
+      BOOST_CHECK_EQUAL( tasks[i].m_calls, batch );
+  }
+
+  BOOST_CHECK_EQUAL( pool.size(), 8u );
+
+  // The workers are reused, smaller batches do not create threads
+  std::vector<Task> few(3u);
+
+  pool.run( run_task, make_arguments(few) );
+
+  BOOST_CHECK_EQUAL( pool.size(), 8u );
+
+  for (size_t i = 0u; i < few.size(); ++i)
+  {
+    BOOST_CHECK_EQUAL( few[i].m_calls, 1u );
+    BOOST_CHECK( !pthread_equal( few[i].m_thread, pthread_self() ) );
+  }
+}
+
+BOOST_AUTO_TEST_CASE(more_tasks_than_workers)
+{
+  util::ThreadPool pool;
+
+  std::vector<Task> tasks(37u);
+
+  pool.run( run_task, make_arguments(tasks), 3u );
+
+  BOOST_CHECK_EQUAL( pool.size(), 3u );
+
+  for (size_t i = 0u; i < tasks.size(); ++i)
+    BOOST_CHECK_EQUAL( tasks[i].m_calls, 1u );
+}
+
+//
+// Runs a batch on a shared pool from a separate thread.
+//
+class SharedRun
+{
+public:
+
+  util::ThreadPool  * m_pool;
+  std::vector<Task>   m_tasks;
+};
+
+inline void * run_shared(void * argument)
+{
+  SharedRun * shared = static_cast<SharedRun *>(argument);
+
+  for (unsigned int batch = 0u; batch < 100u; ++batch)
+    shared->m_pool->run( run_task, make_arguments(shared->m_tasks) );
+
+  return 0;
+}
+
+BOOST_AUTO_TEST_CASE(shared_pool_serves_concurrent_callers)
+{
+  util::ThreadPool pool;
+
+  SharedRun a;
+  SharedRun b;
+
+  a.m_pool = &pool;
+  b.m_pool = &pool;
+  a.m_tasks.resize(4u);
+  b.m_tasks.resize(6u);
+
+  pthread_t ta;
+  pthread_t tb;
+
+  pthread_create( &ta, NULL, run_shared, &a );
+  pthread_create( &tb, NULL, run_shared, &b );
+
+  pthread_join( ta, NULL );
+  pthread_join( tb, NULL );
+
+  for (size_t i = 0u; i < a.m_tasks.size(); ++i)
+    BOOST_CHECK_EQUAL( a.m_tasks[i].m_calls, 100u );
+
+  for (size_t i = 0u; i < b.m_tasks.size(); ++i)
+    BOOST_CHECK_EQUAL( b.m_tasks[i].m_calls, 100u );
+
+  BOOST_CHECK_EQUAL( pool.size(), 6u );
+}
+
+BOOST_AUTO_TEST_CASE(pinned_pool_runs_tasks)
+{
+  util::ThreadPool pool(true);
+
+  std::vector<Task> tasks(2u);
+
+  pool.run( run_task, make_arguments(tasks) );
+
+  BOOST_CHECK_EQUAL( tasks[0].m_calls, 1u );
+  BOOST_CHECK_EQUAL( tasks[1].m_calls, 1u );
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -256,7 +256,7 @@ PYBIND11_MODULE( pygrit, m )
          return BufData(
                         const_cast<grit::Simplex0*>(self.m_vertices.data())  //Raw pointer to vertices
                         , sizeof(grit::Simplex0)     // Number of bytes for 1 Simplex0 type
-                        , std::string("@L")       // 1 unsigned long
+                        , std::string(sizeof(grit::Simplex::index_type) == 4u ? "@I" : "@Q")  // 1 unsigned index
                         , self.m_vertices.size()   // Number of vertices
                         );
 